@@ -29,6 +29,8 @@ namespace Model
 
     InvokeAgentHandler::InvokeAgentHandler() : EventStreamHandler()
     {
+        SetPayloadBorrowing(true);
+
         m_onInitialResponse = [&](const InvokeAgentInitialResponse&)
         {
             AWS_LOGSTREAM_TRACE(INVOKEAGENT_HANDLER_CLASS_TAG,
@@ -62,15 +64,14 @@ namespace Model
             return;
         }
 
-        const auto& headers = GetEventHeaders();
-        auto messageTypeHeaderIter = headers.find(MESSAGE_TYPE_HEADER);
-        if (messageTypeHeaderIter == headers.end())
+        const EventHeaderValue* messageTypeHeader = GetKnownHeader(Aws::Utils::Event::Message::KnownHeader::MESSAGE_TYPE);
+        if (!messageTypeHeader)
         {
             AWS_LOGSTREAM_WARN(INVOKEAGENT_HANDLER_CLASS_TAG, "Header: " << MESSAGE_TYPE_HEADER << " not found in the message.");
             return;
         }
 
-        switch (Aws::Utils::Event::Message::GetMessageTypeForName(messageTypeHeaderIter->second.GetEventHeaderValueAsString()))
+        switch (GetMessageType())
         {
         case Aws::Utils::Event::Message::MessageType::EVENT:
             HandleEventInMessage();
@@ -83,21 +84,20 @@ namespace Model
         }
         default:
             AWS_LOGSTREAM_WARN(INVOKEAGENT_HANDLER_CLASS_TAG,
-                "Unexpected message type: " << messageTypeHeaderIter->second.GetEventHeaderValueAsString());
+                "Unexpected message type: " << messageTypeHeader->GetEventHeaderValueAsString());
             break;
         }
     }
 
     void InvokeAgentHandler::HandleEventInMessage()
     {
-        const auto& headers = GetEventHeaders();
-        auto eventTypeHeaderIter = headers.find(EVENT_TYPE_HEADER);
-        if (eventTypeHeaderIter == headers.end())
+        const EventHeaderValue* eventTypeHeader = GetKnownHeader(Aws::Utils::Event::Message::KnownHeader::EVENT_TYPE);
+        if (!eventTypeHeader)
         {
             AWS_LOGSTREAM_WARN(INVOKEAGENT_HANDLER_CLASS_TAG, "Header: " << EVENT_TYPE_HEADER << " not found in the message.");
             return;
         }
-        switch (InvokeAgentEventMapper::GetInvokeAgentEventTypeForName(eventTypeHeaderIter->second.GetEventHeaderValueAsString()))
+        switch (InvokeAgentEventMapper::GetInvokeAgentEventTypeForName(eventTypeHeader->GetEventHeaderValueAsString()))
         {
         
         case InvokeAgentEventType::INITIAL_RESPONSE: 
@@ -140,7 +140,7 @@ namespace Model
         }
         default:
             AWS_LOGSTREAM_WARN(INVOKEAGENT_HANDLER_CLASS_TAG,
-                "Unexpected event type: " << eventTypeHeaderIter->second.GetEventHeaderValueAsString());
+                "Unexpected event type: " << eventTypeHeader->GetEventHeaderValueAsString());
             break;
         }
     }
@@ -127,6 +127,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::BatchExecuteStatement, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for BatchExecuteStatement that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename BatchExecuteStatementRequestT = Model::BatchExecuteStatementRequest>
+        auto BatchExecuteStatementAwaitable(const BatchExecuteStatementRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::BatchExecuteStatement, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>BatchGetItem</code> operation returns the attributes of one or more
          * items from one or more tables. You identify requested items by primary key.</p>
@@ -197,6 +208,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::BatchGetItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for BatchGetItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename BatchGetItemRequestT = Model::BatchGetItemRequest>
+        auto BatchGetItemAwaitable(const BatchGetItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::BatchGetItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>BatchWriteItem</code> operation puts or deletes multiple items in
          * one or more tables. A single call to <code>BatchWriteItem</code> can transmit up
@@ -285,6 +307,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::BatchWriteItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for BatchWriteItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename BatchWriteItemRequestT = Model::BatchWriteItemRequest>
+        auto BatchWriteItemAwaitable(const BatchWriteItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::BatchWriteItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Creates a backup for an existing table.</p> <p> Each time you create an
          * on-demand backup, the entire table data is backed up. There is no limit to the
@@ -327,6 +360,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::CreateBackup, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for CreateBackup that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename CreateBackupRequestT = Model::CreateBackupRequest>
+        auto CreateBackupAwaitable(const CreateBackupRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::CreateBackup, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Creates a global table from an existing table. A global table creates a
          * replication relationship between two or more DynamoDB tables with the same table
@@ -388,6 +432,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::CreateGlobalTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for CreateGlobalTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename CreateGlobalTableRequestT = Model::CreateGlobalTableRequest>
+        auto CreateGlobalTableAwaitable(const CreateGlobalTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::CreateGlobalTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>CreateTable</code> operation adds a new table to your account. In
          * an Amazon Web Services account, table names must be unique within each Region.
@@ -427,6 +482,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::CreateTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for CreateTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename CreateTableRequestT = Model::CreateTableRequest>
+        auto CreateTableAwaitable(const CreateTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::CreateTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Deletes an existing backup of a table.</p> <p>You can call
          * <code>DeleteBackup</code> at a maximum rate of 10 times per
@@ -454,6 +520,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DeleteBackup, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DeleteBackup that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DeleteBackupRequestT = Model::DeleteBackupRequest>
+        auto DeleteBackupAwaitable(const DeleteBackupRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DeleteBackup, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Deletes a single item in a table by primary key. You can perform a
          * conditional delete operation that deletes the item if it exists, or if it has an
@@ -488,6 +565,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DeleteItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DeleteItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DeleteItemRequestT = Model::DeleteItemRequest>
+        auto DeleteItemAwaitable(const DeleteItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DeleteItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>DeleteTable</code> operation deletes a table and all of its items.
          * After a <code>DeleteTable</code> request, the specified table is in the
@@ -532,6 +620,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DeleteTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DeleteTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DeleteTableRequestT = Model::DeleteTableRequest>
+        auto DeleteTableAwaitable(const DeleteTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DeleteTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Describes an existing backup of a table.</p> <p>You can call
          * <code>DescribeBackup</code> at a maximum rate of 10 times per
@@ -559,6 +658,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeBackup, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeBackup that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeBackupRequestT = Model::DescribeBackupRequest>
+        auto DescribeBackupAwaitable(const DescribeBackupRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeBackup, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Checks the status of continuous backups and point in time recovery on the
          * specified table. Continuous backups are <code>ENABLED</code> on all tables at
@@ -594,6 +704,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeContinuousBackups, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeContinuousBackups that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeContinuousBackupsRequestT = Model::DescribeContinuousBackupsRequest>
+        auto DescribeContinuousBackupsAwaitable(const DescribeContinuousBackupsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeContinuousBackups, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns information about contributor insights for a given table or global
          * secondary index.</p><p><h3>See Also:</h3>   <a
@@ -620,6 +741,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeContributorInsights, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeContributorInsights that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeContributorInsightsRequestT = Model::DescribeContributorInsightsRequest>
+        auto DescribeContributorInsightsAwaitable(const DescribeContributorInsightsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeContributorInsights, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns the regional endpoint information. For more information on policy
          * permissions, please see <a
@@ -648,6 +780,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeEndpoints, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeEndpoints that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeEndpointsRequestT = Model::DescribeEndpointsRequest>
+        auto DescribeEndpointsAwaitable(const DescribeEndpointsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeEndpoints, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Describes an existing table export.</p><p><h3>See Also:</h3>   <a
          * href="http://docs.aws.amazon.com/goto/WebAPI/dynamodb-2012-08-10/DescribeExport">AWS
@@ -673,6 +816,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeExport, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeExport that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeExportRequestT = Model::DescribeExportRequest>
+        auto DescribeExportAwaitable(const DescribeExportRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeExport, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns information about the specified global table.</p>  <p>This
          * operation only applies to <a
@@ -710,6 +864,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeGlobalTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeGlobalTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeGlobalTableRequestT = Model::DescribeGlobalTableRequest>
+        auto DescribeGlobalTableAwaitable(const DescribeGlobalTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeGlobalTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Describes Region-specific settings for a global table.</p> 
          * <p>This operation only applies to <a
@@ -747,6 +912,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeGlobalTableSettings, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeGlobalTableSettings that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeGlobalTableSettingsRequestT = Model::DescribeGlobalTableSettingsRequest>
+        auto DescribeGlobalTableSettingsAwaitable(const DescribeGlobalTableSettingsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeGlobalTableSettings, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> Represents the properties of the import. </p><p><h3>See Also:</h3>   <a
          * href="http://docs.aws.amazon.com/goto/WebAPI/dynamodb-2012-08-10/DescribeImport">AWS
@@ -772,6 +948,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeImport, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeImport that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeImportRequestT = Model::DescribeImportRequest>
+        auto DescribeImportAwaitable(const DescribeImportRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeImport, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns information about the status of Kinesis streaming.</p><p><h3>See
          * Also:</h3>   <a
@@ -798,6 +985,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeKinesisStreamingDestination, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeKinesisStreamingDestination that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeKinesisStreamingDestinationRequestT = Model::DescribeKinesisStreamingDestinationRequest>
+        auto DescribeKinesisStreamingDestinationAwaitable(const DescribeKinesisStreamingDestinationRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeKinesisStreamingDestination, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns the current provisioned-capacity quotas for your Amazon Web Services
          * account in a Region, both for the Region as a whole and for any one DynamoDB
@@ -864,6 +1062,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeLimits, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeLimits that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeLimitsRequestT = Model::DescribeLimitsRequest>
+        auto DescribeLimitsAwaitable(const DescribeLimitsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeLimits, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns information about the table, including the current status of the
          * table, when it was created, the primary key schema, and any indexes on the
@@ -900,6 +1109,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeTableRequestT = Model::DescribeTableRequest>
+        auto DescribeTableAwaitable(const DescribeTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Describes auto scaling settings across replicas of the global table at
          * once.</p>  <p>This operation only applies to <a
@@ -929,6 +1149,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeTableReplicaAutoScaling, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeTableReplicaAutoScaling that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeTableReplicaAutoScalingRequestT = Model::DescribeTableReplicaAutoScalingRequest>
+        auto DescribeTableReplicaAutoScalingAwaitable(const DescribeTableReplicaAutoScalingRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeTableReplicaAutoScaling, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Gives a description of the Time to Live (TTL) status on the specified table.
          * </p><p><h3>See Also:</h3>   <a
@@ -955,6 +1186,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DescribeTimeToLive, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DescribeTimeToLive that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DescribeTimeToLiveRequestT = Model::DescribeTimeToLiveRequest>
+        auto DescribeTimeToLiveAwaitable(const DescribeTimeToLiveRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DescribeTimeToLive, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Stops replication from the DynamoDB table to the Kinesis data stream. This is
          * done without deleting either of the resources.</p><p><h3>See Also:</h3>   <a
@@ -981,6 +1223,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::DisableKinesisStreamingDestination, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for DisableKinesisStreamingDestination that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename DisableKinesisStreamingDestinationRequestT = Model::DisableKinesisStreamingDestinationRequest>
+        auto DisableKinesisStreamingDestinationAwaitable(const DisableKinesisStreamingDestinationRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::DisableKinesisStreamingDestination, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Starts table data replication to the specified Kinesis data stream at a
          * timestamp chosen during the enable workflow. If this operation doesn't return
@@ -1009,6 +1262,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::EnableKinesisStreamingDestination, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for EnableKinesisStreamingDestination that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename EnableKinesisStreamingDestinationRequestT = Model::EnableKinesisStreamingDestinationRequest>
+        auto EnableKinesisStreamingDestinationAwaitable(const EnableKinesisStreamingDestinationRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::EnableKinesisStreamingDestination, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>This operation allows you to perform reads and singleton writes on data
          * stored in DynamoDB, using PartiQL.</p> <p>For PartiQL reads (<code>SELECT</code>
@@ -1046,6 +1310,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ExecuteStatement, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ExecuteStatement that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ExecuteStatementRequestT = Model::ExecuteStatementRequest>
+        auto ExecuteStatementAwaitable(const ExecuteStatementRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ExecuteStatement, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>This operation allows you to perform transactional reads or writes on data
          * stored in DynamoDB, using PartiQL.</p>  <p>The entire transaction must
@@ -1078,6 +1353,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ExecuteTransaction, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ExecuteTransaction that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ExecuteTransactionRequestT = Model::ExecuteTransactionRequest>
+        auto ExecuteTransactionAwaitable(const ExecuteTransactionRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ExecuteTransaction, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Exports table data to an S3 bucket. The table must have point in time
          * recovery enabled, and you can export data from any time within the point in time
@@ -1105,6 +1391,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ExportTableToPointInTime, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ExportTableToPointInTime that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ExportTableToPointInTimeRequestT = Model::ExportTableToPointInTimeRequest>
+        auto ExportTableToPointInTimeAwaitable(const ExportTableToPointInTimeRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ExportTableToPointInTime, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>GetItem</code> operation returns a set of attributes for the item
          * with the given primary key. If there is no matching item, <code>GetItem</code>
@@ -1134,9 +1431,24 @@ namespace DynamoDB
         template<typename GetItemRequestT = Model::GetItemRequest>
         void GetItemAsync(const GetItemRequestT& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const
         {
+            if (m_clientConfiguration.releaseExecutorBetweenAttempts)
+            {
+                return GetItemWithTimedRetries(request, handler, context);
+            }
             return SubmitAsync(&DynamoDBClient::GetItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for GetItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename GetItemRequestT = Model::GetItemRequest>
+        auto GetItemAwaitable(const GetItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::GetItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> Imports table data from an S3 bucket. </p><p><h3>See Also:</h3>   <a
          * href="http://docs.aws.amazon.com/goto/WebAPI/dynamodb-2012-08-10/ImportTable">AWS
@@ -1162,6 +1474,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ImportTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ImportTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ImportTableRequestT = Model::ImportTableRequest>
+        auto ImportTableAwaitable(const ImportTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ImportTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>List DynamoDB backups that are associated with an Amazon Web Services account
          * and weren't made with Amazon Web Services Backup. To list these backups for a
@@ -1198,6 +1521,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListBackups, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListBackups that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListBackupsRequestT = Model::ListBackupsRequest>
+        auto ListBackupsAwaitable(const ListBackupsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListBackups, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns a list of ContributorInsightsSummary for a table and all its global
          * secondary indexes.</p><p><h3>See Also:</h3>   <a
@@ -1224,6 +1558,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListContributorInsights, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListContributorInsights that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListContributorInsightsRequestT = Model::ListContributorInsightsRequest>
+        auto ListContributorInsightsAwaitable(const ListContributorInsightsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListContributorInsights, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Lists completed exports within the past 90 days.</p><p><h3>See Also:</h3>  
          * <a
@@ -1250,6 +1595,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListExports, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListExports that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListExportsRequestT = Model::ListExportsRequest>
+        auto ListExportsAwaitable(const ListExportsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListExports, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Lists all global tables that have a replica in the specified Region.</p>
          *  <p>This operation only applies to <a
@@ -1287,6 +1643,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListGlobalTables, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListGlobalTables that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListGlobalTablesRequestT = Model::ListGlobalTablesRequest>
+        auto ListGlobalTablesAwaitable(const ListGlobalTablesRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListGlobalTables, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> Lists completed imports within the past 90 days. </p><p><h3>See Also:</h3>  
          * <a
@@ -1313,6 +1680,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListImports, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListImports that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListImportsRequestT = Model::ListImportsRequest>
+        auto ListImportsAwaitable(const ListImportsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListImports, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Returns an array of table names associated with the current account and
          * endpoint. The output from <code>ListTables</code> is paginated, with each page
@@ -1340,6 +1718,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListTables, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListTables that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListTablesRequestT = Model::ListTablesRequest>
+        auto ListTablesAwaitable(const ListTablesRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListTables, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>List all tags on an Amazon DynamoDB resource. You can call ListTagsOfResource
          * up to 10 times per second, per account.</p> <p>For an overview on tagging
@@ -1370,6 +1759,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::ListTagsOfResource, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for ListTagsOfResource that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ListTagsOfResourceRequestT = Model::ListTagsOfResourceRequest>
+        auto ListTagsOfResourceAwaitable(const ListTagsOfResourceRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::ListTagsOfResource, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Creates a new item, or replaces an old item with a new item. If an item that
          * has the same primary key as the new item already exists in the specified table,
@@ -1412,9 +1812,24 @@ namespace DynamoDB
         template<typename PutItemRequestT = Model::PutItemRequest>
         void PutItemAsync(const PutItemRequestT& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const
         {
+            if (m_clientConfiguration.releaseExecutorBetweenAttempts)
+            {
+                return PutItemWithTimedRetries(request, handler, context);
+            }
             return SubmitAsync(&DynamoDBClient::PutItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for PutItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename PutItemRequestT = Model::PutItemRequest>
+        auto PutItemAwaitable(const PutItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::PutItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>You must provide the name of the partition key attribute and a single value
          * for that attribute. <code>Query</code> returns all items with that partition key
@@ -1484,6 +1899,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::Query, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for Query that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename QueryRequestT = Model::QueryRequest>
+        auto QueryAwaitable(const QueryRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::Query, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Creates a new table from an existing backup. Any number of users can execute
          * up to 50 concurrent restores (any type of restore) in a given account. </p>
@@ -1516,6 +1942,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::RestoreTableFromBackup, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for RestoreTableFromBackup that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename RestoreTableFromBackupRequestT = Model::RestoreTableFromBackupRequest>
+        auto RestoreTableFromBackupAwaitable(const RestoreTableFromBackupRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::RestoreTableFromBackup, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Restores the specified table to the specified point in time within
          * <code>EarliestRestorableDateTime</code> and
@@ -1558,6 +1995,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::RestoreTableToPointInTime, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for RestoreTableToPointInTime that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename RestoreTableToPointInTimeRequestT = Model::RestoreTableToPointInTimeRequest>
+        auto RestoreTableToPointInTimeAwaitable(const RestoreTableToPointInTimeRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::RestoreTableToPointInTime, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>Scan</code> operation returns one or more items and item attributes
          * by accessing every item in a table or a secondary index. To have DynamoDB return
@@ -1623,6 +2071,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::Scan, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for Scan that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename ScanRequestT = Model::ScanRequest>
+        auto ScanAwaitable(const ScanRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::Scan, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Associate a set of tags with an Amazon DynamoDB resource. You can then
          * activate these user-defined tags so that they appear on the Billing and Cost
@@ -1655,6 +2114,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::TagResource, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for TagResource that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename TagResourceRequestT = Model::TagResourceRequest>
+        auto TagResourceAwaitable(const TagResourceRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::TagResource, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> <code>TransactGetItems</code> is a synchronous operation that atomically
          * retrieves multiple items from one or more tables (but not from indexes) in a
@@ -1694,6 +2164,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::TransactGetItems, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for TransactGetItems that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename TransactGetItemsRequestT = Model::TransactGetItemsRequest>
+        auto TransactGetItemsAwaitable(const TransactGetItemsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::TransactGetItems, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> <code>TransactWriteItems</code> is a synchronous write operation that groups
          * up to 100 action requests. These actions can target items in different tables,
@@ -1758,6 +2239,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::TransactWriteItems, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for TransactWriteItems that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename TransactWriteItemsRequestT = Model::TransactWriteItemsRequest>
+        auto TransactWriteItemsAwaitable(const TransactWriteItemsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::TransactWriteItems, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Removes the association of tags from an Amazon DynamoDB resource. You can
          * call <code>UntagResource</code> up to five times per second, per account. </p>
@@ -1788,6 +2280,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UntagResource, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UntagResource that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UntagResourceRequestT = Model::UntagResourceRequest>
+        auto UntagResourceAwaitable(const UntagResourceRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UntagResource, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p> <code>UpdateContinuousBackups</code> enables or disables point in time
          * recovery for the specified table. A successful
@@ -1824,6 +2327,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateContinuousBackups, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateContinuousBackups that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateContinuousBackupsRequestT = Model::UpdateContinuousBackupsRequest>
+        auto UpdateContinuousBackupsAwaitable(const UpdateContinuousBackupsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateContinuousBackups, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Updates the status for contributor insights for a specific table or index.
          * CloudWatch Contributor Insights for DynamoDB graphs display the partition key
@@ -1856,6 +2370,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateContributorInsights, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateContributorInsights that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateContributorInsightsRequestT = Model::UpdateContributorInsightsRequest>
+        auto UpdateContributorInsightsAwaitable(const UpdateContributorInsightsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateContributorInsights, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Adds or removes replicas in the specified global table. The global table must
          * already exist to be able to use this operation. Any replica to be added must be
@@ -1911,6 +2436,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateGlobalTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateGlobalTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateGlobalTableRequestT = Model::UpdateGlobalTableRequest>
+        auto UpdateGlobalTableAwaitable(const UpdateGlobalTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateGlobalTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Updates settings for a global table.</p>  <p>This operation only
          * applies to <a
@@ -1948,6 +2484,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateGlobalTableSettings, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateGlobalTableSettings that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateGlobalTableSettingsRequestT = Model::UpdateGlobalTableSettingsRequest>
+        auto UpdateGlobalTableSettingsAwaitable(const UpdateGlobalTableSettingsRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateGlobalTableSettings, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Edits an existing item's attributes, or adds a new item to the table if it
          * does not already exist. You can put, delete, or add attribute values. You can
@@ -1979,6 +2526,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateItem, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateItem that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateItemRequestT = Model::UpdateItemRequest>
+        auto UpdateItemAwaitable(const UpdateItemRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateItem, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The command to update the Kinesis stream destination.</p><p><h3>See
          * Also:</h3>   <a
@@ -2005,6 +2563,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateKinesisStreamingDestination, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateKinesisStreamingDestination that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateKinesisStreamingDestinationRequestT = Model::UpdateKinesisStreamingDestinationRequest>
+        auto UpdateKinesisStreamingDestinationAwaitable(const UpdateKinesisStreamingDestinationRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateKinesisStreamingDestination, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Modifies the provisioned throughput settings, global secondary indexes, or
          * DynamoDB Streams settings for a given table.</p>  <p>This operation
@@ -2045,6 +2614,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateTable, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateTable that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateTableRequestT = Model::UpdateTableRequest>
+        auto UpdateTableAwaitable(const UpdateTableRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateTable, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>Updates auto scaling settings on your global tables at once.</p> 
          * <p>This operation only applies to <a
@@ -2074,6 +2654,17 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateTableReplicaAutoScaling, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateTableReplicaAutoScaling that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateTableReplicaAutoScalingRequestT = Model::UpdateTableReplicaAutoScalingRequest>
+        auto UpdateTableReplicaAutoScalingAwaitable(const UpdateTableReplicaAutoScalingRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateTableReplicaAutoScaling, request, resumeExecutor);
+        }
+#endif
+
         /**
          * <p>The <code>UpdateTimeToLive</code> method enables or disables Time to Live
          * (TTL) for the specified table. A successful <code>UpdateTimeToLive</code> call
@@ -2120,14 +2711,29 @@ namespace DynamoDB
             return SubmitAsync(&DynamoDBClient::UpdateTimeToLive, request, handler, context);
         }
 
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * An Awaitable wrapper for UpdateTimeToLive that can be co_awaited from a coroutine, see Aws::Client::OperationAwaitable.
+         */
+        template<typename UpdateTimeToLiveRequestT = Model::UpdateTimeToLiveRequest>
+        auto UpdateTimeToLiveAwaitable(const UpdateTimeToLiveRequestT& request, Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+        {
+            return SubmitAwaitable(&DynamoDBClient::UpdateTimeToLive, request, resumeExecutor);
+        }
+#endif
+
 
       void OverrideEndpoint(const Aws::String& endpoint);
       std::shared_ptr<DynamoDBEndpointProviderBase>& accessEndpointProvider();
     private:
       friend class Aws::Client::ClientWithAsyncTemplateMethods<DynamoDBClient>;
       void init(const DynamoDBClientConfiguration& clientConfiguration);
+      Aws::Endpoint::DiscoverEndpointOutcome DiscoverEndpoint() const;
+      Aws::Endpoint::ResolveEndpointOutcome ResolveOperationEndpoint(const Aws::AmazonWebServiceRequest& request) const;
+      void GetItemWithTimedRetries(const Model::GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
+      void PutItemWithTimedRetries(const Model::PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
 
-      mutable Aws::Utils::ConcurrentCache<Aws::String, Aws::String> m_endpointsCache;
+      mutable Aws::Endpoint::EndpointDiscoveryCache m_endpointsCache;
       DynamoDBClientConfiguration m_clientConfiguration;
       std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
       std::shared_ptr<DynamoDBEndpointProviderBase> m_endpointProvider;
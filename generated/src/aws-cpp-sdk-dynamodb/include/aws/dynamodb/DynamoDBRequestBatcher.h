@@ -0,0 +1,180 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/dynamodb/DynamoDB_EXPORTS.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/TimerQueue.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+namespace DynamoDB
+{
+  struct AWS_DYNAMODB_API DynamoDBRequestBatcherConfiguration
+  {
+    /**
+     * Time a request waits for others to join its batch before the batch is sent.
+     */
+    std::chrono::milliseconds maxBatchDelay = std::chrono::milliseconds(2);
+    /**
+     * Keys sent in one BatchGetItem request, at most 100 (larger values are clamped).
+     */
+    size_t maxGetBatchSize = 100;
+    /**
+     * Items sent in one BatchWriteItem request, at most 25 (larger values are clamped).
+     */
+    size_t maxWriteBatchSize = 25;
+    /**
+     * Times an unprocessed key or item is sent again before its caller gets a ProvisionedThroughputExceeded error.
+     */
+    size_t maxUnprocessedRetries = 8;
+    /**
+     * Back-off before sending unprocessed keys or items again, doubled at each attempt with full jitter.
+     */
+    std::chrono::milliseconds unprocessedRetryBaseDelay = std::chrono::milliseconds(25);
+    std::chrono::milliseconds maxUnprocessedRetryDelay = std::chrono::milliseconds(1000);
+    /**
+     * Key attribute names (partition key, then sort key) by table name. The key schema of the other tables is read with
+     * DescribeTable.
+     */
+    Aws::Map<Aws::String, Aws::Vector<Aws::String>> keySchemas;
+    /**
+     * Time during which the puts to a table are sent individually after DescribeTable failed for it, before the key
+     * schema is read again.
+     */
+    std::chrono::milliseconds keySchemaRetryDelay = std::chrono::milliseconds(60000);
+  };
+
+  /**
+   * Coalesces concurrent GetItem, PutItem and DeleteItem calls into BatchGetItem and BatchWriteItem requests.
+   *
+   * Requests to the same table are collected until a batch is full or maxBatchDelay elapsed, then sent through the
+   * async methods of the client. Keys and items the service leaves unprocessed are sent again, with back-off, and the
+   * future of each call completes with its own outcome.
+   *
+   * Only requests which the batch operations can express are coalesced: reads without projection and writes without
+   * condition, return values or consumed capacity. Others are sent individually. Identical reads pending in the same
+   * batch are sent once and share their outcome.
+   *
+   * Writes are tracked by item key, the key schema of a table being taken from the configuration or read with
+   * DescribeTable on its first PutItem (if that fails, puts to the table are sent individually until
+   * keySchemaRetryDelay elapsed). A write to a key which already has a write pending in the
+   * current batch replaces it, last write wins, and the callers of both get the outcome of the last one. A write to a
+   * key whose previous write is in flight, or waiting to be retried, is held back until that write completes, so that
+   * the writes to a key are applied in the order they were made. Only the writes the service reports as unprocessed
+   * are sent again. When the service rejects a batch as invalid, its requests are sent again individually so that each
+   * caller gets its own outcome. Writes sent individually from the start are not ordered with the batched ones.
+   *
+   * This class is thread-safe. The destructor waits for the pending requests to complete.
+   */
+  class AWS_DYNAMODB_API DynamoDBRequestBatcher
+  {
+  public:
+    DynamoDBRequestBatcher(const std::shared_ptr<DynamoDBClient>& client,
+                           const DynamoDBRequestBatcherConfiguration& configuration = DynamoDBRequestBatcherConfiguration());
+    ~DynamoDBRequestBatcher();
+
+    DynamoDBRequestBatcher(const DynamoDBRequestBatcher&) = delete;
+    DynamoDBRequestBatcher& operator=(const DynamoDBRequestBatcher&) = delete;
+
+    Model::GetItemOutcomeCallable GetItemCallable(const Model::GetItemRequest& request);
+    Model::PutItemOutcomeCallable PutItemCallable(const Model::PutItemRequest& request);
+    Model::DeleteItemOutcomeCallable DeleteItemCallable(const Model::DeleteItemRequest& request);
+
+    /**
+     * Sends the pending batches without waiting for them to fill up.
+     */
+    void Flush();
+
+  private:
+    struct GetEntry
+    {
+      Aws::Map<Aws::String, Model::AttributeValue> key;
+      Aws::Vector<std::shared_ptr<std::promise<Model::GetItemOutcome>>> waiters;
+      size_t attempts = 0;
+    };
+
+    struct GetBatch
+    {
+      Aws::String tableName;
+      bool consistentRead = false;
+      // entries by serialized key
+      Aws::Map<Aws::String, GetEntry> entries;
+    };
+
+    struct WriteEntry
+    {
+      // serialized item key
+      Aws::String key;
+      Model::WriteRequest writeRequest;
+      Aws::Vector<std::shared_ptr<std::promise<Model::PutItemOutcome>>> putWaiters;
+      Aws::Vector<std::shared_ptr<std::promise<Model::DeleteItemOutcome>>> deleteWaiters;
+      size_t attempts = 0;
+    };
+
+    struct WriteBatch
+    {
+      Aws::String tableName;
+      // entries by serialized item key
+      Aws::Map<Aws::String, WriteEntry> entries;
+    };
+
+    void EnqueueGet(const Aws::String& tableName, bool consistentRead, GetEntry&& entry);
+    void EnqueueWrite(const Aws::String& tableName, WriteEntry&& entry);
+    void RequeueWrite(const Aws::String& tableName, WriteEntry&& entry);
+    void CompleteWrite(const Aws::String& tableName, const Aws::String& key);
+    std::shared_ptr<WriteBatch> AddToWriteBatch(const Aws::String& tableName, WriteEntry&& entry);
+    bool GetKeyNames(const Aws::String& tableName, Aws::Vector<Aws::String>& keyNames);
+    void FlushGetBatch(const Aws::String& groupKey, const std::weak_ptr<GetBatch>& batch);
+    void FlushWriteBatch(const Aws::String& tableName, const std::weak_ptr<WriteBatch>& batch);
+    void SendGetBatch(const std::shared_ptr<GetBatch>& batch);
+    void SendWriteBatch(const std::shared_ptr<WriteBatch>& batch);
+    void OnGetBatchCompleted(const std::shared_ptr<GetBatch>& batch, const Model::BatchGetItemOutcome& outcome);
+    void OnWriteBatchCompleted(const std::shared_ptr<WriteBatch>& batch, const Model::BatchWriteItemOutcome& outcome);
+    void RetryGetEntries(const Aws::String& tableName, bool consistentRead, Aws::Vector<GetEntry>&& entries);
+    void RetryWriteEntries(const Aws::String& tableName, Aws::Vector<WriteEntry>&& entries);
+    static void FailGetEntry(const GetEntry& entry, const DynamoDBError& error);
+    static void FailWriteEntry(const WriteEntry& entry, const DynamoDBError& error);
+    static void ReplaceWrite(WriteEntry& write, WriteEntry&& replacement);
+    void SendGetIndividually(const Aws::String& tableName, bool consistentRead, const GetEntry& entry);
+    void SendWriteIndividually(const Aws::String& tableName, const WriteEntry& entry);
+    std::chrono::milliseconds GetRetryDelay(size_t attempts) const;
+    void BeginOperation();
+    void EndOperation();
+
+    std::shared_ptr<DynamoDBClient> m_client;
+    const DynamoDBRequestBatcherConfiguration m_configuration;
+
+    std::mutex m_mutex;
+    std::condition_variable m_operationsDone;
+    // pending batches by table and read consistency, and by table
+    Aws::Map<Aws::String, std::shared_ptr<GetBatch>> m_getBatches;
+    Aws::Map<Aws::String, std::shared_ptr<WriteBatch>> m_writeBatches;
+    // key attribute names by table
+    Aws::Map<Aws::String, Aws::Vector<Aws::String>> m_keySchemas;
+    // time until which the key schema is not read again, by table for which DescribeTable failed
+    Aws::Map<Aws::String, std::chrono::steady_clock::time_point> m_keySchemaFailures;
+    // table and item key of the writes pending, in flight or waiting to be retried
+    Aws::Set<Aws::String> m_activeWrites;
+    // the last write made to an active key while its previous write was already sent, by table and item key
+    Aws::Map<Aws::String, WriteEntry> m_deferredWrites;
+    // pending and in flight batches, individual requests and unprocessed requests waiting out their back-off
+    size_t m_operations = 0;
+
+    Aws::Utils::Threading::TimerQueue m_timer;
+  };
+
+} // namespace DynamoDB
+} // namespace Aws
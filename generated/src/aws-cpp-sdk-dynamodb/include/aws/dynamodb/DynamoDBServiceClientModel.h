@@ -14,6 +14,7 @@
 #include <aws/core/http/HttpTypes.h>
 #include <aws/dynamodb/DynamoDBEndpointProvider.h>
 #include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/endpoint/EndpointDiscoveryCache.h>
 #include <future>
 #include <functional>
 /* End of generic header includes */
@@ -10,6 +10,8 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/Array.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 namespace Aws
 {
@@ -162,6 +164,9 @@ public:
 
     Aws::String SerializeAttribute() const;
     Aws::Utils::Json::JsonValue Jsonize() const;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const;
+    /// reads the value starting at the current token of the reader, which is left on the value's last token
+    void DeserializeFrom(Aws::Utils::Json::JsonReader& reader);
     ValueType GetType() const;
 
 private:
@@ -61,6 +61,7 @@ public:
     virtual bool operator == (const AttributeValueValue& other) const = 0;
 
     virtual Aws::Utils::Json::JsonValue Jsonize() const = 0;
+    virtual void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const = 0;
 
     virtual ValueType GetType() const = 0;
 };
@@ -75,6 +76,7 @@ public:
     bool IsDefault() const override { return m_s.empty(); }
     bool operator == (const AttributeValueValue& other) const override { return GetType() == other.GetType() && m_s == other.GetS(); }
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::STRING; }
 
 private:
@@ -91,6 +93,7 @@ public:
     bool IsDefault() const override { return m_n.empty(); }
     bool operator == (const AttributeValueValue& other) const override { return GetType() == other.GetType() && m_n == other.GetN(); };
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::NUMBER; }
 
 private:
@@ -107,6 +110,7 @@ public:
     bool IsDefault() const override { return m_b.GetLength() == 0; }
     bool operator == (const AttributeValueValue& other) const override { return GetType() == other.GetType() && m_b == other.GetB(); }
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::BYTEBUFFER; }
 
 private:
@@ -124,6 +128,7 @@ public:
     bool IsDefault() const override { return m_sS.empty(); }
     bool operator == (const AttributeValueValue& other) const override;
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::STRING_SET; }
 
 private:
@@ -141,6 +146,7 @@ public:
     bool IsDefault() const override { return m_nS.empty(); }
     bool operator == (const AttributeValueValue& other) const override;
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::NUMBER_SET; }
 
 private:
@@ -158,6 +164,7 @@ public:
     bool IsDefault() const override { return m_bS.empty(); }
     bool operator == (const AttributeValueValue& other) const override;
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::BYTEBUFFER_SET; }
 
 private:
@@ -175,6 +182,7 @@ public:
     bool IsDefault() const override { return m_m.empty(); }
     bool operator == (const AttributeValueValue& other) const override;
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::ATTRIBUTE_MAP; }
 
 private:
@@ -192,6 +200,7 @@ public:
     bool IsDefault() const override { return m_l.empty(); }
     bool operator == (const AttributeValueValue& other) const override;
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::ATTRIBUTE_LIST; }
 
 private:
@@ -208,6 +217,7 @@ public:
     bool IsDefault() const override { return m_bool == false; }
     bool operator == (const AttributeValueValue& other) const override { return GetType() == other.GetType() && m_bool == other.GetBool(); }
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::BOOL; }
 
 private:
@@ -224,6 +234,7 @@ public:
     bool IsDefault() const override { return m_null == false; }
     bool operator == (const AttributeValueValue& other) const override { return GetType() == other.GetType() && m_null == other.GetNull(); }
     Aws::Utils::Json::JsonValue Jsonize() const override;
+    void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const override;
     ValueType GetType() const override { return ValueType::NULLVALUE; }
 
 private:
@@ -14,6 +14,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -34,6 +35,7 @@ namespace Model
     AWS_DYNAMODB_API Capacity(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API Capacity& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_DYNAMODB_API void DeserializeFrom(Aws::Utils::Json::JsonReader& reader);
 
 
     /**
@@ -18,6 +18,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -38,6 +39,7 @@ namespace Model
     AWS_DYNAMODB_API DeleteRequest(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API DeleteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_DYNAMODB_API void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const;
 
 
     /**
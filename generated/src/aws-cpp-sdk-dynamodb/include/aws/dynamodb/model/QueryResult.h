@@ -23,6 +23,10 @@ namespace Json
 {
   class JsonValue;
 } // namespace Json
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace DynamoDB
 {
@@ -40,6 +44,17 @@ namespace Model
     AWS_DYNAMODB_API QueryResult();
     AWS_DYNAMODB_API QueryResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     AWS_DYNAMODB_API QueryResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Reads the result directly from the response body with Aws::Utils::Json::JsonReader, without building a JSON DOM.
+     */
+    AWS_DYNAMODB_API QueryResult(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    AWS_DYNAMODB_API QueryResult& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    /**
+     * False when the response body read from the ResponseStream was malformed or truncated, the client then returns
+     * an error instead of this partial result.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -381,6 +396,8 @@ namespace Model
     ConsumedCapacity m_consumedCapacity;
 
     Aws::String m_requestId;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
@@ -17,6 +17,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonWriter;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -40,6 +41,7 @@ namespace Model
     AWS_DYNAMODB_API WriteRequest(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API WriteRequest& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_DYNAMODB_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_DYNAMODB_API void SerializeTo(Aws::Utils::Json::JsonWriter& writer) const;
 
 
     /**
@@ -0,0 +1,883 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/dynamodb/DynamoDBRequestBatcher.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/DeleteItemRequest.h>
+#include <aws/dynamodb/model/DescribeTableRequest.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/PutItemRequest.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils::Json;
+
+static const char ALLOCATION_TAG[] = "DynamoDBRequestBatcher";
+// Limits of BatchGetItem and BatchWriteItem.
+static const size_t MAX_GET_BATCH_SIZE = 100;
+static const size_t MAX_WRITE_BATCH_SIZE = 25;
+
+namespace
+{
+  Aws::String SerializeKey(const Aws::Map<Aws::String, AttributeValue>& key)
+  {
+    JsonValue json;
+    for (const auto& attribute : key)
+    {
+      json.WithObject(attribute.first, attribute.second.Jsonize());
+    }
+    return json.View().WriteCompact();
+  }
+
+  Aws::String GetItemKey(const Aws::Vector<Aws::String>& keyNames, const Aws::Map<Aws::String, AttributeValue>& item)
+  {
+    Aws::Map<Aws::String, AttributeValue> key;
+    for (const auto& keyName : keyNames)
+    {
+      auto attribute = item.find(keyName);
+      if (attribute != item.end())
+      {
+        key.emplace(attribute->first, attribute->second);
+      }
+    }
+    return SerializeKey(key);
+  }
+
+  Aws::String GetWriteRequestKey(const Aws::Vector<Aws::String>& keyNames, const WriteRequest& writeRequest)
+  {
+    return writeRequest.PutRequestHasBeenSet() ? GetItemKey(keyNames, writeRequest.GetPutRequest().GetItem()) :
+                                                 SerializeKey(writeRequest.GetDeleteRequest().GetKey());
+  }
+
+  Aws::String GetWriteId(const Aws::String& tableName, const Aws::String& key)
+  {
+    // table names cannot contain '/'
+    return tableName + "/" + key;
+  }
+
+  DynamoDBRequestBatcherConfiguration ClampConfiguration(DynamoDBRequestBatcherConfiguration configuration)
+  {
+    configuration.maxGetBatchSize = (std::max)((std::min)(configuration.maxGetBatchSize, MAX_GET_BATCH_SIZE), static_cast<size_t>(1));
+    configuration.maxWriteBatchSize = (std::max)((std::min)(configuration.maxWriteBatchSize, MAX_WRITE_BATCH_SIZE), static_cast<size_t>(1));
+    return configuration;
+  }
+
+  bool HasNoConsumedCapacity(ReturnConsumedCapacity value)
+  {
+    return value == ReturnConsumedCapacity::NOT_SET || value == ReturnConsumedCapacity::NONE;
+  }
+
+  bool HasNoItemCollectionMetrics(ReturnItemCollectionMetrics value)
+  {
+    return value == ReturnItemCollectionMetrics::NOT_SET || value == ReturnItemCollectionMetrics::NONE;
+  }
+
+  bool HasNoReturnValues(ReturnValue value)
+  {
+    return value == ReturnValue::NOT_SET || value == ReturnValue::NONE;
+  }
+
+  bool IsBatchable(const GetItemRequest& request)
+  {
+    return !request.GetKey().empty() &&
+           !request.AttributesToGetHasBeenSet() &&
+           !request.ProjectionExpressionHasBeenSet() &&
+           !request.ExpressionAttributeNamesHasBeenSet() &&
+           HasNoConsumedCapacity(request.GetReturnConsumedCapacity());
+  }
+
+  bool IsBatchable(const PutItemRequest& request)
+  {
+    return !request.GetItem().empty() &&
+           !request.ExpectedHasBeenSet() &&
+           !request.ConditionalOperatorHasBeenSet() &&
+           !request.ConditionExpressionHasBeenSet() &&
+           !request.ExpressionAttributeNamesHasBeenSet() &&
+           !request.ExpressionAttributeValuesHasBeenSet() &&
+           !request.ReturnValuesOnConditionCheckFailureHasBeenSet() &&
+           HasNoReturnValues(request.GetReturnValues()) &&
+           HasNoConsumedCapacity(request.GetReturnConsumedCapacity()) &&
+           HasNoItemCollectionMetrics(request.GetReturnItemCollectionMetrics());
+  }
+
+  bool IsBatchable(const DeleteItemRequest& request)
+  {
+    return !request.GetKey().empty() &&
+           !request.ExpectedHasBeenSet() &&
+           !request.ConditionalOperatorHasBeenSet() &&
+           !request.ConditionExpressionHasBeenSet() &&
+           !request.ExpressionAttributeNamesHasBeenSet() &&
+           !request.ExpressionAttributeValuesHasBeenSet() &&
+           !request.ReturnValuesOnConditionCheckFailureHasBeenSet() &&
+           HasNoReturnValues(request.GetReturnValues()) &&
+           HasNoConsumedCapacity(request.GetReturnConsumedCapacity()) &&
+           HasNoItemCollectionMetrics(request.GetReturnItemCollectionMetrics());
+  }
+
+  Aws::String GetBatchKey(const Aws::String& tableName, bool consistentRead)
+  {
+    return (consistentRead ? "1" : "0") + tableName;
+  }
+
+  DynamoDBError GetUnprocessedError(size_t attempts)
+  {
+    return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::PROVISIONED_THROUGHPUT_EXCEEDED,
+      "ProvisionedThroughputExceededException",
+      "Request was left unprocessed by " + Aws::Utils::StringUtils::to_string(attempts) + " batch requests",
+      true);
+  }
+}
+
+DynamoDBRequestBatcher::DynamoDBRequestBatcher(const std::shared_ptr<DynamoDBClient>& client,
+                                               const DynamoDBRequestBatcherConfiguration& configuration) :
+  m_client(client),
+  m_configuration(ClampConfiguration(configuration)),
+  m_keySchemas(m_configuration.keySchemas)
+{
+}
+
+DynamoDBRequestBatcher::~DynamoDBRequestBatcher()
+{
+  Flush();
+  {
+    std::unique_lock<std::mutex> locker(m_mutex);
+    m_operationsDone.wait(locker, [this] { return m_operations == 0; });
+  }
+  m_timer.Stop();
+}
+
+GetItemOutcomeCallable DynamoDBRequestBatcher::GetItemCallable(const GetItemRequest& request)
+{
+  if (!IsBatchable(request))
+  {
+    return m_client->GetItemCallable(request);
+  }
+
+  auto promise = Aws::MakeShared<std::promise<GetItemOutcome>>(ALLOCATION_TAG);
+  auto future = promise->get_future();
+  GetEntry entry;
+  entry.key = request.GetKey();
+  entry.waiters.push_back(std::move(promise));
+  EnqueueGet(request.GetTableName(), request.GetConsistentRead(), std::move(entry));
+  return future;
+}
+
+PutItemOutcomeCallable DynamoDBRequestBatcher::PutItemCallable(const PutItemRequest& request)
+{
+  Aws::Vector<Aws::String> keyNames;
+  if (!IsBatchable(request) || !GetKeyNames(request.GetTableName(), keyNames))
+  {
+    return m_client->PutItemCallable(request);
+  }
+
+  auto promise = Aws::MakeShared<std::promise<PutItemOutcome>>(ALLOCATION_TAG);
+  auto future = promise->get_future();
+  PutRequest putRequest;
+  putRequest.SetItem(request.GetItem());
+  WriteEntry entry;
+  entry.key = GetItemKey(keyNames, request.GetItem());
+  entry.writeRequest.SetPutRequest(std::move(putRequest));
+  entry.putWaiters.push_back(std::move(promise));
+  EnqueueWrite(request.GetTableName(), std::move(entry));
+  return future;
+}
+
+DeleteItemOutcomeCallable DynamoDBRequestBatcher::DeleteItemCallable(const DeleteItemRequest& request)
+{
+  if (!IsBatchable(request))
+  {
+    return m_client->DeleteItemCallable(request);
+  }
+
+  auto promise = Aws::MakeShared<std::promise<DeleteItemOutcome>>(ALLOCATION_TAG);
+  auto future = promise->get_future();
+  DeleteRequest deleteRequest;
+  deleteRequest.SetKey(request.GetKey());
+  WriteEntry entry;
+  entry.key = SerializeKey(request.GetKey());
+  entry.writeRequest.SetDeleteRequest(std::move(deleteRequest));
+  entry.deleteWaiters.push_back(std::move(promise));
+  EnqueueWrite(request.GetTableName(), std::move(entry));
+  return future;
+}
+
+void DynamoDBRequestBatcher::Flush()
+{
+  Aws::Vector<std::shared_ptr<GetBatch>> getBatches;
+  Aws::Vector<std::shared_ptr<WriteBatch>> writeBatches;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    for (auto& batch : m_getBatches)
+    {
+      getBatches.push_back(std::move(batch.second));
+    }
+    for (auto& batch : m_writeBatches)
+    {
+      writeBatches.push_back(std::move(batch.second));
+    }
+    m_getBatches.clear();
+    m_writeBatches.clear();
+  }
+
+  for (const auto& batch : getBatches)
+  {
+    SendGetBatch(batch);
+  }
+  for (const auto& batch : writeBatches)
+  {
+    SendWriteBatch(batch);
+  }
+}
+
+void DynamoDBRequestBatcher::EnqueueGet(const Aws::String& tableName, bool consistentRead, GetEntry&& entry)
+{
+  const Aws::String groupKey = GetBatchKey(tableName, consistentRead);
+  const Aws::String key = SerializeKey(entry.key);
+  std::shared_ptr<GetBatch> fullBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto& batch = m_getBatches[groupKey];
+    if (!batch)
+    {
+      // a batch counts as an operation from its creation, so that the destructor waits for its flush timer
+      batch = Aws::MakeShared<GetBatch>(ALLOCATION_TAG);
+      ++m_operations;
+      batch->tableName = tableName;
+      batch->consistentRead = consistentRead;
+      std::weak_ptr<GetBatch> pendingBatch = batch;
+      m_timer.Schedule(m_configuration.maxBatchDelay, [this, groupKey, pendingBatch]() { FlushGetBatch(groupKey, pendingBatch); });
+    }
+
+    auto pending = batch->entries.find(key);
+    if (pending != batch->entries.end())
+    {
+      pending->second.waiters.insert(pending->second.waiters.end(), entry.waiters.begin(), entry.waiters.end());
+      return;
+    }
+    batch->entries.emplace(key, std::move(entry));
+    if (batch->entries.size() < m_configuration.maxGetBatchSize)
+    {
+      return;
+    }
+    fullBatch = std::move(batch);
+    m_getBatches.erase(groupKey);
+  }
+  SendGetBatch(fullBatch);
+}
+
+void DynamoDBRequestBatcher::EnqueueWrite(const Aws::String& tableName, WriteEntry&& entry)
+{
+  std::shared_ptr<WriteBatch> fullBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto batch = m_writeBatches.find(tableName);
+    if (batch != m_writeBatches.end())
+    {
+      auto pending = batch->second->entries.find(entry.key);
+      if (pending != batch->second->entries.end())
+      {
+        ReplaceWrite(pending->second, std::move(entry));
+        return;
+      }
+    }
+
+    const Aws::String writeId = GetWriteId(tableName, entry.key);
+    if (m_activeWrites.count(writeId) > 0)
+    {
+      // the previous write to the key was sent already, this one waits for it to complete so that they are not reordered
+      auto deferred = m_deferredWrites.find(writeId);
+      if (deferred != m_deferredWrites.end())
+      {
+        ReplaceWrite(deferred->second, std::move(entry));
+      }
+      else
+      {
+        m_deferredWrites.emplace(writeId, std::move(entry));
+      }
+      return;
+    }
+    m_activeWrites.insert(writeId);
+    fullBatch = AddToWriteBatch(tableName, std::move(entry));
+  }
+  if (fullBatch)
+  {
+    SendWriteBatch(fullBatch);
+  }
+}
+
+void DynamoDBRequestBatcher::RequeueWrite(const Aws::String& tableName, WriteEntry&& entry)
+{
+  std::shared_ptr<WriteBatch> fullBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto deferred = m_deferredWrites.find(GetWriteId(tableName, entry.key));
+    if (deferred != m_deferredWrites.end())
+    {
+      // a later write to the key was made in the meantime, it is sent instead
+      ReplaceWrite(entry, std::move(deferred->second));
+      m_deferredWrites.erase(deferred);
+    }
+    fullBatch = AddToWriteBatch(tableName, std::move(entry));
+  }
+  if (fullBatch)
+  {
+    SendWriteBatch(fullBatch);
+  }
+}
+
+void DynamoDBRequestBatcher::CompleteWrite(const Aws::String& tableName, const Aws::String& key)
+{
+  std::shared_ptr<WriteBatch> fullBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    const Aws::String writeId = GetWriteId(tableName, key);
+    auto deferred = m_deferredWrites.find(writeId);
+    if (deferred == m_deferredWrites.end())
+    {
+      m_activeWrites.erase(writeId);
+      return;
+    }
+    WriteEntry next = std::move(deferred->second);
+    m_deferredWrites.erase(deferred);
+    fullBatch = AddToWriteBatch(tableName, std::move(next));
+  }
+  if (fullBatch)
+  {
+    SendWriteBatch(fullBatch);
+  }
+}
+
+std::shared_ptr<DynamoDBRequestBatcher::WriteBatch> DynamoDBRequestBatcher::AddToWriteBatch(const Aws::String& tableName, WriteEntry&& entry)
+{
+  auto& batch = m_writeBatches[tableName];
+  if (!batch)
+  {
+    // a batch counts as an operation from its creation, so that the destructor waits for its flush timer
+    batch = Aws::MakeShared<WriteBatch>(ALLOCATION_TAG);
+    ++m_operations;
+    batch->tableName = tableName;
+    std::weak_ptr<WriteBatch> pendingBatch = batch;
+    m_timer.Schedule(m_configuration.maxBatchDelay, [this, tableName, pendingBatch]() { FlushWriteBatch(tableName, pendingBatch); });
+  }
+
+  const Aws::String key = entry.key;
+  batch->entries.emplace(key, std::move(entry));
+  if (batch->entries.size() < m_configuration.maxWriteBatchSize)
+  {
+    return nullptr;
+  }
+  std::shared_ptr<WriteBatch> fullBatch = std::move(batch);
+  m_writeBatches.erase(tableName);
+  return fullBatch;
+}
+
+bool DynamoDBRequestBatcher::GetKeyNames(const Aws::String& tableName, Aws::Vector<Aws::String>& keyNames)
+{
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto schema = m_keySchemas.find(tableName);
+    if (schema != m_keySchemas.end())
+    {
+      keyNames = schema->second;
+      return true;
+    }
+    auto failure = m_keySchemaFailures.find(tableName);
+    if (failure != m_keySchemaFailures.end())
+    {
+      if (std::chrono::steady_clock::now() < failure->second)
+      {
+        return false;
+      }
+      m_keySchemaFailures.erase(failure);
+    }
+  }
+
+  DescribeTableRequest request;
+  request.SetTableName(tableName);
+  auto outcome = m_client->DescribeTable(request);
+  if (!outcome.IsSuccess())
+  {
+    AWS_LOGSTREAM_WARN(ALLOCATION_TAG, "Unable to read the key schema of " << tableName << ", sending its puts individually: "
+                       << outcome.GetError().GetMessage());
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_keySchemaFailures[tableName] = std::chrono::steady_clock::now() + m_configuration.keySchemaRetryDelay;
+    return false;
+  }
+  keyNames.clear();
+  for (const auto& element : outcome.GetResult().GetTable().GetKeySchema())
+  {
+    keyNames.push_back(element.GetAttributeName());
+  }
+
+  std::lock_guard<std::mutex> locker(m_mutex);
+  m_keySchemas[tableName] = keyNames;
+  return true;
+}
+
+void DynamoDBRequestBatcher::FlushGetBatch(const Aws::String& groupKey, const std::weak_ptr<GetBatch>& batch)
+{
+  std::shared_ptr<GetBatch> pendingBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto pending = m_getBatches.find(groupKey);
+    // the batch may have been sent already because it filled up or was flushed
+    if (pending == m_getBatches.end() || pending->second != batch.lock())
+    {
+      return;
+    }
+    pendingBatch = std::move(pending->second);
+    m_getBatches.erase(pending);
+  }
+  SendGetBatch(pendingBatch);
+}
+
+void DynamoDBRequestBatcher::FlushWriteBatch(const Aws::String& tableName, const std::weak_ptr<WriteBatch>& batch)
+{
+  std::shared_ptr<WriteBatch> pendingBatch;
+  {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto pending = m_writeBatches.find(tableName);
+    if (pending == m_writeBatches.end() || pending->second != batch.lock())
+    {
+      return;
+    }
+    pendingBatch = std::move(pending->second);
+    m_writeBatches.erase(pending);
+  }
+  SendWriteBatch(pendingBatch);
+}
+
+void DynamoDBRequestBatcher::SendGetBatch(const std::shared_ptr<GetBatch>& batch)
+{
+  KeysAndAttributes keysAndAttributes;
+  for (const auto& entry : batch->entries)
+  {
+    keysAndAttributes.AddKeys(entry.second.key);
+  }
+  if (batch->consistentRead)
+  {
+    keysAndAttributes.SetConsistentRead(true);
+  }
+  BatchGetItemRequest request;
+  request.AddRequestItems(batch->tableName, std::move(keysAndAttributes));
+
+  m_client->BatchGetItemAsync(request,
+    [this, batch](const DynamoDBClient*, const BatchGetItemRequest&, const BatchGetItemOutcome& outcome,
+                  const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+    {
+      OnGetBatchCompleted(batch, outcome);
+    });
+}
+
+void DynamoDBRequestBatcher::SendWriteBatch(const std::shared_ptr<WriteBatch>& batch)
+{
+  Aws::Vector<WriteRequest> writeRequests;
+  writeRequests.reserve(batch->entries.size());
+  for (const auto& entry : batch->entries)
+  {
+    writeRequests.push_back(entry.second.writeRequest);
+  }
+  BatchWriteItemRequest request;
+  request.AddRequestItems(batch->tableName, std::move(writeRequests));
+
+  m_client->BatchWriteItemAsync(request,
+    [this, batch](const DynamoDBClient*, const BatchWriteItemRequest&, const BatchWriteItemOutcome& outcome,
+                  const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+    {
+      OnWriteBatchCompleted(batch, outcome);
+    });
+}
+
+void DynamoDBRequestBatcher::OnGetBatchCompleted(const std::shared_ptr<GetBatch>& batch, const BatchGetItemOutcome& outcome)
+{
+  if (!outcome.IsSuccess())
+  {
+    const bool invalidBatch = outcome.GetError().GetErrorType() == DynamoDBErrors::VALIDATION;
+    if (invalidBatch)
+    {
+      AWS_LOGSTREAM_DEBUG(ALLOCATION_TAG, "BatchGetItem on " << batch->tableName << " was rejected, sending its "
+                          << batch->entries.size() << " keys individually: " << outcome.GetError().GetMessage());
+    }
+    for (const auto& entry : batch->entries)
+    {
+      if (invalidBatch)
+      {
+        SendGetIndividually(batch->tableName, batch->consistentRead, entry.second);
+      }
+      else
+      {
+        FailGetEntry(entry.second, outcome.GetError());
+      }
+    }
+    EndOperation();
+    return;
+  }
+
+  // all keys of a table have the same attribute names, returned items are matched to their request by these
+  Aws::Vector<Aws::String> keyNames;
+  for (const auto& attribute : batch->entries.begin()->second.key)
+  {
+    keyNames.push_back(attribute.first);
+  }
+
+  const BatchGetItemResult& result = outcome.GetResult();
+  Aws::Vector<GetEntry> unprocessed;
+  auto unprocessedKeys = result.GetUnprocessedKeys().find(batch->tableName);
+  if (unprocessedKeys != result.GetUnprocessedKeys().end())
+  {
+    for (const auto& key : unprocessedKeys->second.GetKeys())
+    {
+      auto entry = batch->entries.find(SerializeKey(key));
+      if (entry != batch->entries.end())
+      {
+        unprocessed.push_back(std::move(entry->second));
+        batch->entries.erase(entry);
+      }
+    }
+  }
+
+  bool unmatchedItems = false;
+  auto items = result.GetResponses().find(batch->tableName);
+  if (items != result.GetResponses().end())
+  {
+    for (const auto& item : items->second)
+    {
+      Aws::Map<Aws::String, AttributeValue> key;
+      for (const auto& keyName : keyNames)
+      {
+        auto attribute = item.find(keyName);
+        if (attribute != item.end())
+        {
+          key.emplace(attribute->first, attribute->second);
+        }
+      }
+      auto entry = batch->entries.find(SerializeKey(key));
+      if (entry == batch->entries.end())
+      {
+        // e.g. a number key written differently than the service returns it
+        unmatchedItems = true;
+        continue;
+      }
+      GetItemResult itemResult;
+      itemResult.SetItem(item);
+      itemResult.SetRequestId(result.GetRequestId());
+      for (const auto& waiter : entry->second.waiters)
+      {
+        waiter->set_value(GetItemOutcome(itemResult));
+      }
+      batch->entries.erase(entry);
+    }
+  }
+
+  // the keys left were not found, unless an item could not be matched to its key
+  for (const auto& entry : batch->entries)
+  {
+    if (unmatchedItems)
+    {
+      SendGetIndividually(batch->tableName, batch->consistentRead, entry.second);
+      continue;
+    }
+    GetItemResult itemResult;
+    itemResult.SetRequestId(result.GetRequestId());
+    for (const auto& waiter : entry.second.waiters)
+    {
+      waiter->set_value(GetItemOutcome(itemResult));
+    }
+  }
+
+  if (!unprocessed.empty())
+  {
+    RetryGetEntries(batch->tableName, batch->consistentRead, std::move(unprocessed));
+  }
+  EndOperation();
+}
+
+void DynamoDBRequestBatcher::OnWriteBatchCompleted(const std::shared_ptr<WriteBatch>& batch, const BatchWriteItemOutcome& outcome)
+{
+  if (!outcome.IsSuccess())
+  {
+    const bool invalidBatch = outcome.GetError().GetErrorType() == DynamoDBErrors::VALIDATION;
+    if (invalidBatch)
+    {
+      AWS_LOGSTREAM_DEBUG(ALLOCATION_TAG, "BatchWriteItem on " << batch->tableName << " was rejected, sending its "
+                          << batch->entries.size() << " items individually: " << outcome.GetError().GetMessage());
+    }
+    for (const auto& entry : batch->entries)
+    {
+      if (invalidBatch)
+      {
+        SendWriteIndividually(batch->tableName, entry.second);
+      }
+      else
+      {
+        FailWriteEntry(entry.second, outcome.GetError());
+        CompleteWrite(batch->tableName, entry.first);
+      }
+    }
+    EndOperation();
+    return;
+  }
+
+  const BatchWriteItemResult& result = outcome.GetResult();
+  Aws::Vector<WriteEntry> unprocessed;
+  auto unprocessedItems = result.GetUnprocessedItems().find(batch->tableName);
+  if (unprocessedItems != result.GetUnprocessedItems().end())
+  {
+    Aws::Vector<Aws::String> keyNames;
+    {
+      std::lock_guard<std::mutex> locker(m_mutex);
+      auto schema = m_keySchemas.find(batch->tableName);
+      if (schema != m_keySchemas.end())
+      {
+        keyNames = schema->second;
+      }
+    }
+    for (const auto& writeRequest : unprocessedItems->second)
+    {
+      auto entry = batch->entries.find(GetWriteRequestKey(keyNames, writeRequest));
+      if (entry == batch->entries.end())
+      {
+        // not expected, the unprocessed requests are returned as they were sent
+        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "An unprocessed write to " << batch->tableName << " matches no write of the batch, sending it again individually");
+        WriteEntry unmatched;
+        unmatched.writeRequest = writeRequest;
+        SendWriteIndividually(batch->tableName, unmatched);
+        continue;
+      }
+      unprocessed.push_back(std::move(entry->second));
+      batch->entries.erase(entry);
+    }
+  }
+
+  // the writes left were applied, only the unprocessed ones are sent again
+  for (const auto& entry : batch->entries)
+  {
+    for (const auto& waiter : entry.second.putWaiters)
+    {
+      waiter->set_value(PutItemOutcome(PutItemResult()));
+    }
+    for (const auto& waiter : entry.second.deleteWaiters)
+    {
+      waiter->set_value(DeleteItemOutcome(DeleteItemResult()));
+    }
+    CompleteWrite(batch->tableName, entry.first);
+  }
+
+  if (!unprocessed.empty())
+  {
+    RetryWriteEntries(batch->tableName, std::move(unprocessed));
+  }
+  EndOperation();
+}
+
+void DynamoDBRequestBatcher::RetryGetEntries(const Aws::String& tableName, bool consistentRead, Aws::Vector<GetEntry>&& entries)
+{
+  auto retries = Aws::MakeShared<Aws::Vector<GetEntry>>(ALLOCATION_TAG);
+  size_t attempts = 0;
+  for (auto& entry : entries)
+  {
+    if (++entry.attempts > m_configuration.maxUnprocessedRetries)
+    {
+      FailGetEntry(entry, GetUnprocessedError(entry.attempts));
+      continue;
+    }
+    attempts = (std::max)(attempts, entry.attempts);
+    retries->push_back(std::move(entry));
+  }
+  if (retries->empty())
+  {
+    return;
+  }
+
+  BeginOperation();
+  auto retry = [this, tableName, consistentRead, retries]()
+  {
+    for (auto& entry : *retries)
+    {
+      EnqueueGet(tableName, consistentRead, std::move(entry));
+    }
+    EndOperation();
+  };
+  if (!m_timer.Schedule(GetRetryDelay(attempts), retry))
+  {
+    retry();
+  }
+}
+
+void DynamoDBRequestBatcher::RetryWriteEntries(const Aws::String& tableName, Aws::Vector<WriteEntry>&& entries)
+{
+  auto retries = Aws::MakeShared<Aws::Vector<WriteEntry>>(ALLOCATION_TAG);
+  size_t attempts = 0;
+  for (auto& entry : entries)
+  {
+    if (++entry.attempts > m_configuration.maxUnprocessedRetries)
+    {
+      FailWriteEntry(entry, GetUnprocessedError(entry.attempts));
+      CompleteWrite(tableName, entry.key);
+      continue;
+    }
+    attempts = (std::max)(attempts, entry.attempts);
+    retries->push_back(std::move(entry));
+  }
+  if (retries->empty())
+  {
+    return;
+  }
+
+  BeginOperation();
+  auto retry = [this, tableName, retries]()
+  {
+    for (auto& entry : *retries)
+    {
+      RequeueWrite(tableName, std::move(entry));
+    }
+    EndOperation();
+  };
+  if (!m_timer.Schedule(GetRetryDelay(attempts), retry))
+  {
+    retry();
+  }
+}
+
+void DynamoDBRequestBatcher::FailGetEntry(const GetEntry& entry, const DynamoDBError& error)
+{
+  for (const auto& waiter : entry.waiters)
+  {
+    waiter->set_value(GetItemOutcome(error));
+  }
+}
+
+void DynamoDBRequestBatcher::ReplaceWrite(WriteEntry& write, WriteEntry&& replacement)
+{
+  // last write wins: the callers of the replaced write get the outcome of the one replacing it
+  write.writeRequest = std::move(replacement.writeRequest);
+  write.putWaiters.insert(write.putWaiters.end(), replacement.putWaiters.begin(), replacement.putWaiters.end());
+  write.deleteWaiters.insert(write.deleteWaiters.end(), replacement.deleteWaiters.begin(), replacement.deleteWaiters.end());
+  write.attempts = replacement.attempts;
+}
+
+void DynamoDBRequestBatcher::FailWriteEntry(const WriteEntry& entry, const DynamoDBError& error)
+{
+  for (const auto& waiter : entry.putWaiters)
+  {
+    waiter->set_value(PutItemOutcome(error));
+  }
+  for (const auto& waiter : entry.deleteWaiters)
+  {
+    waiter->set_value(DeleteItemOutcome(error));
+  }
+}
+
+void DynamoDBRequestBatcher::SendGetIndividually(const Aws::String& tableName, bool consistentRead, const GetEntry& entry)
+{
+  GetItemRequest request;
+  request.SetTableName(tableName);
+  request.SetKey(entry.key);
+  if (consistentRead)
+  {
+    request.SetConsistentRead(true);
+  }
+
+  BeginOperation();
+  auto waiters = entry.waiters;
+  m_client->GetItemAsync(request,
+    [this, waiters](const DynamoDBClient*, const GetItemRequest&, const GetItemOutcome& outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+    {
+      for (const auto& waiter : waiters)
+      {
+        waiter->set_value(outcome);
+      }
+      EndOperation();
+    });
+}
+
+void DynamoDBRequestBatcher::SendWriteIndividually(const Aws::String& tableName, const WriteEntry& entry)
+{
+  BeginOperation();
+  // writes to a key are coalesced, a put may have callers of deletes it replaced and the other way around
+  auto putWaiters = entry.putWaiters;
+  auto deleteWaiters = entry.deleteWaiters;
+  const Aws::String key = entry.key;
+  if (entry.writeRequest.PutRequestHasBeenSet())
+  {
+    PutItemRequest request;
+    request.SetTableName(tableName);
+    request.SetItem(entry.writeRequest.GetPutRequest().GetItem());
+    m_client->PutItemAsync(request,
+      [this, tableName, key, putWaiters, deleteWaiters](const DynamoDBClient*, const PutItemRequest&, const PutItemOutcome& outcome,
+                                                        const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+      {
+        for (const auto& waiter : putWaiters)
+        {
+          waiter->set_value(outcome);
+        }
+        for (const auto& waiter : deleteWaiters)
+        {
+          waiter->set_value(outcome.IsSuccess() ? DeleteItemOutcome(DeleteItemResult()) : DeleteItemOutcome(outcome.GetError()));
+        }
+        if (!key.empty())
+        {
+          CompleteWrite(tableName, key);
+        }
+        EndOperation();
+      });
+    return;
+  }
+
+  DeleteItemRequest request;
+  request.SetTableName(tableName);
+  request.SetKey(entry.writeRequest.GetDeleteRequest().GetKey());
+  m_client->DeleteItemAsync(request,
+    [this, tableName, key, putWaiters, deleteWaiters](const DynamoDBClient*, const DeleteItemRequest&, const DeleteItemOutcome& outcome,
+                                                      const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+    {
+      for (const auto& waiter : deleteWaiters)
+      {
+        waiter->set_value(outcome);
+      }
+      for (const auto& waiter : putWaiters)
+      {
+        waiter->set_value(outcome.IsSuccess() ? PutItemOutcome(PutItemResult()) : PutItemOutcome(outcome.GetError()));
+      }
+      if (!key.empty())
+      {
+        CompleteWrite(tableName, key);
+      }
+      EndOperation();
+    });
+}
+
+std::chrono::milliseconds DynamoDBRequestBatcher::GetRetryDelay(size_t attempts) const
+{
+  static thread_local std::default_random_engine generator(std::random_device{}());
+  const auto maxDelay = (std::min)(m_configuration.unprocessedRetryBaseDelay.count() << (std::min)(attempts, static_cast<size_t>(16)),
+                                   m_configuration.maxUnprocessedRetryDelay.count());
+  std::uniform_int_distribution<long long> distribution(0, (std::max)(static_cast<long long>(maxDelay), 0LL));
+  return std::chrono::milliseconds(distribution(generator));
+}
+
+void DynamoDBRequestBatcher::BeginOperation()
+{
+  std::lock_guard<std::mutex> locker(m_mutex);
+  ++m_operations;
+}
+
+void DynamoDBRequestBatcher::EndOperation()
+{
+  std::lock_guard<std::mutex> locker(m_mutex);
+  if (--m_operations == 0)
+  {
+    m_operationsDone.notify_all();
+  }
+}
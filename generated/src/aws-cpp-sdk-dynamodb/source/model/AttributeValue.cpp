@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/AttributeValue.h>
 #include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
 
 #include <utility>
 
@@ -376,6 +377,109 @@ JsonValue AttributeValue::Jsonize() const
     }
 }
 
+void AttributeValue::SerializeTo(JsonWriter& writer) const
+{
+    if (m_value)
+    {
+        m_value->SerializeTo(writer);
+    }
+    else
+    {
+        writer.StartObject().EndObject();
+    }
+}
+
+void AttributeValue::DeserializeFrom(JsonReader& reader)
+{
+    m_value = nullptr;
+    if (reader.GetToken() != JsonToken::StartObject)
+    {
+        reader.SkipValue();
+        return;
+    }
+
+    while (reader.NextMember())
+    {
+        const Aws::String type = reader.TakeString();
+        const JsonToken token = reader.Next();
+        if (type == "S" && token == JsonToken::String)
+        {
+            m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", reader.TakeString());
+        }
+        else if (type == "N" && token == JsonToken::String)
+        {
+            m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", reader.TakeString());
+        }
+        else if (type == "B" && token == JsonToken::String)
+        {
+            m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", HashingUtils::Base64Decode(reader.GetString()));
+        }
+        else if (type == "SS" && token == JsonToken::StartArray)
+        {
+            Aws::Vector<Aws::String> ss;
+            while (reader.NextElement())
+            {
+                ss.push_back(reader.TakeString());
+            }
+            m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", ss);
+        }
+        else if (type == "NS" && token == JsonToken::StartArray)
+        {
+            Aws::Vector<Aws::String> ns;
+            while (reader.NextElement())
+            {
+                ns.push_back(reader.TakeString());
+            }
+            m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", ns);
+        }
+        else if (type == "BS" && token == JsonToken::StartArray)
+        {
+            Aws::Vector<ByteBuffer> bs;
+            while (reader.NextElement())
+            {
+                bs.push_back(HashingUtils::Base64Decode(reader.GetString()));
+            }
+            m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", bs);
+        }
+        else if (type == "M" && token == JsonToken::StartObject)
+        {
+            Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
+            while (reader.NextMember())
+            {
+                Aws::String key = reader.TakeString();
+                reader.Next();
+                auto value = Aws::MakeShared<AttributeValue>("AttributeValue");
+                value->DeserializeFrom(reader);
+                map.emplace(std::move(key), std::move(value));
+            }
+            m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", map);
+        }
+        else if (type == "L" && token == JsonToken::StartArray)
+        {
+            Aws::Vector<std::shared_ptr<AttributeValue>> list;
+            while (reader.NextElement())
+            {
+                auto value = Aws::MakeShared<AttributeValue>("AttributeValue");
+                value->DeserializeFrom(reader);
+                list.push_back(std::move(value));
+            }
+            m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", list);
+        }
+        else if (type == "BOOL" && token == JsonToken::Bool)
+        {
+            m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", reader.GetBool());
+        }
+        else if (type == "NULL" && token == JsonToken::Bool)
+        {
+            m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", reader.GetBool());
+        }
+        else
+        {
+            reader.SkipValue();
+        }
+    }
+}
+
 Aws::String AttributeValue::SerializeAttribute() const
 {
     JsonValue value = Jsonize();
@@ -24,6 +24,15 @@ JsonValue AttributeValueString::Jsonize() const
     return value;
 }
 
+void AttributeValueString::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.WithString("S", m_s);
+
+    writer.EndObject();
+}
+
 //
 // Numerics
 //
@@ -40,6 +49,18 @@ JsonValue AttributeValueNumeric::Jsonize() const
     return value;
 }
 
+void AttributeValueNumeric::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    if (!m_n.empty())
+    {
+        writer.WithString("N", m_n);
+    }
+
+    writer.EndObject();
+}
+
 //
 // ByteBuffers
 //
@@ -58,6 +79,15 @@ JsonValue AttributeValueByteBuffer::Jsonize() const
     return value;
 }
 
+void AttributeValueByteBuffer::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.Key("B").AsBase64(m_b);
+
+    writer.EndObject();
+}
+
 //
 // String Sets
 //
@@ -103,6 +133,23 @@ JsonValue AttributeValueStringSet::Jsonize() const
     return value;
 }
 
+void AttributeValueStringSet::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    if (m_sS.size() > 0)
+    {
+        writer.Key("SS").StartArray();
+        for (const auto& item : m_sS)
+        {
+            writer.AsString(item);
+        }
+        writer.EndArray();
+    }
+
+    writer.EndObject();
+}
+
 //
 // Number Sets
 //
@@ -148,6 +195,23 @@ JsonValue AttributeValueNumberSet::Jsonize() const
     return value;
 }
 
+void AttributeValueNumberSet::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    if (m_nS.size() > 0)
+    {
+        writer.Key("NS").StartArray();
+        for (const auto& item : m_nS)
+        {
+            writer.AsString(item);
+        }
+        writer.EndArray();
+    }
+
+    writer.EndObject();
+}
+
 //
 // ByteBuffer Sets
 //
@@ -193,6 +257,23 @@ JsonValue AttributeValueByteBufferSet::Jsonize() const
     return value;
 }
 
+void AttributeValueByteBufferSet::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    if (m_bS.size() > 0)
+    {
+        writer.Key("BS").StartArray();
+        for (const auto& item : m_bS)
+        {
+            writer.AsBase64(item);
+        }
+        writer.EndArray();
+    }
+
+    writer.EndObject();
+}
+
 //
 // AttributeValue Map
 //
@@ -254,6 +335,21 @@ JsonValue AttributeValueMap::Jsonize() const
     return value;
 }
 
+void AttributeValueMap::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.Key("M").StartObject();
+    for (auto& mapItem : m_m)
+    {
+        writer.Key(mapItem.first);
+        mapItem.second->SerializeTo(writer);
+    }
+    writer.EndObject();
+
+    writer.EndObject();
+}
+
 //
 // AttributeValue List
 //
@@ -307,6 +403,20 @@ JsonValue AttributeValueList::Jsonize() const
     return value;
 }
 
+void AttributeValueList::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.Key("L").StartArray();
+    for (const auto& item : m_l)
+    {
+        item->SerializeTo(writer);
+    }
+    writer.EndArray();
+
+    writer.EndObject();
+}
+
 //
 // Bool type
 //
@@ -320,6 +430,15 @@ JsonValue AttributeValueBool::Jsonize() const
     return value;
 }
 
+void AttributeValueBool::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.WithBool("BOOL", m_bool);
+
+    writer.EndObject();
+}
+
 //
 // Null type
 //
@@ -332,3 +451,12 @@ JsonValue AttributeValueNull::Jsonize() const
 
     return value;
 }
+
+void AttributeValueNull::SerializeTo(JsonWriter& writer) const
+{
+    writer.StartObject();
+
+    writer.WithBool("NULL", m_null);
+
+    writer.EndObject();
+}
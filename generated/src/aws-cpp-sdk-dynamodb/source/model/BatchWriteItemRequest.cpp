@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/BatchWriteItemRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -23,35 +24,38 @@ BatchWriteItemRequest::BatchWriteItemRequest() :
 
 Aws::String BatchWriteItemRequest::SerializePayload() const
 {
-  JsonValue payload;
+  Aws::String payload;
+  JsonWriter writer(payload);
+  writer.StartObject();
 
   if(m_requestItemsHasBeenSet)
   {
-   JsonValue requestItemsJsonMap;
+   writer.Key("RequestItems").StartObject();
    for(auto& requestItemsItem : m_requestItems)
    {
-     Aws::Utils::Array<JsonValue> writeRequestsJsonList(requestItemsItem.second.size());
-     for(unsigned writeRequestsIndex = 0; writeRequestsIndex < writeRequestsJsonList.GetLength(); ++writeRequestsIndex)
+     writer.Key(requestItemsItem.first).StartArray();
+     for(const auto& writeRequestsItem : requestItemsItem.second)
      {
-       writeRequestsJsonList[writeRequestsIndex].AsObject(requestItemsItem.second[writeRequestsIndex].Jsonize());
+       writeRequestsItem.SerializeTo(writer);
      }
-     requestItemsJsonMap.WithArray(requestItemsItem.first, std::move(writeRequestsJsonList));
+     writer.EndArray();
    }
-   payload.WithObject("RequestItems", std::move(requestItemsJsonMap));
+   writer.EndObject();
 
   }
 
   if(m_returnConsumedCapacityHasBeenSet)
   {
-   payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
+   writer.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
   if(m_returnItemCollectionMetricsHasBeenSet)
   {
-   payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
+   writer.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
-  return payload.View().WriteReadable();
+  writer.EndObject();
+  return payload;
 }
 
 Aws::Http::HeaderValueCollection BatchWriteItemRequest::GetRequestSpecificHeaders() const
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/Capacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -65,6 +66,40 @@ Capacity& Capacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+void Capacity::DeserializeFrom(JsonReader& reader)
+{
+  if(reader.GetToken() != JsonToken::StartObject)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    reader.Next();
+    if(memberName == "ReadCapacityUnits")
+    {
+      m_readCapacityUnits = reader.GetDouble();
+      m_readCapacityUnitsHasBeenSet = true;
+    }
+    else if(memberName == "WriteCapacityUnits")
+    {
+      m_writeCapacityUnits = reader.GetDouble();
+      m_writeCapacityUnitsHasBeenSet = true;
+    }
+    else if(memberName == "CapacityUnits")
+    {
+      m_capacityUnits = reader.GetDouble();
+      m_capacityUnitsHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 JsonValue Capacity::Jsonize() const
 {
   JsonValue payload;
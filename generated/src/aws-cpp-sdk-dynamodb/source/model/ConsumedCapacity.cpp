@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -107,6 +108,70 @@ ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+void ConsumedCapacity::DeserializeFrom(JsonReader& reader)
+{
+  if(reader.GetToken() != JsonToken::StartObject)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    const JsonToken token = reader.Next();
+    if(memberName == "TableName")
+    {
+      m_tableName = reader.TakeString();
+      m_tableNameHasBeenSet = true;
+    }
+    else if(memberName == "CapacityUnits")
+    {
+      m_capacityUnits = reader.GetDouble();
+      m_capacityUnitsHasBeenSet = true;
+    }
+    else if(memberName == "ReadCapacityUnits")
+    {
+      m_readCapacityUnits = reader.GetDouble();
+      m_readCapacityUnitsHasBeenSet = true;
+    }
+    else if(memberName == "WriteCapacityUnits")
+    {
+      m_writeCapacityUnits = reader.GetDouble();
+      m_writeCapacityUnitsHasBeenSet = true;
+    }
+    else if(memberName == "Table")
+    {
+      m_table.DeserializeFrom(reader);
+      m_tableHasBeenSet = true;
+    }
+    else if(memberName == "LocalSecondaryIndexes" && token == JsonToken::StartObject)
+    {
+      while(reader.NextMember())
+      {
+        Aws::String localSecondaryIndexesKey = reader.TakeString();
+        reader.Next();
+        m_localSecondaryIndexes[std::move(localSecondaryIndexesKey)].DeserializeFrom(reader);
+      }
+      m_localSecondaryIndexesHasBeenSet = true;
+    }
+    else if(memberName == "GlobalSecondaryIndexes" && token == JsonToken::StartObject)
+    {
+      while(reader.NextMember())
+      {
+        Aws::String globalSecondaryIndexesKey = reader.TakeString();
+        reader.Next();
+        m_globalSecondaryIndexes[std::move(globalSecondaryIndexesKey)].DeserializeFrom(reader);
+      }
+      m_globalSecondaryIndexesHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 JsonValue ConsumedCapacity::Jsonize() const
 {
   JsonValue payload;
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/DeleteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -62,6 +63,25 @@ JsonValue DeleteRequest::Jsonize() const
   return payload;
 }
 
+void DeleteRequest::SerializeTo(JsonWriter& writer) const
+{
+  writer.StartObject();
+
+  if(m_keyHasBeenSet)
+  {
+   writer.Key("Key").StartObject();
+   for(auto& keyItem : m_key)
+   {
+     writer.Key(keyItem.first);
+     keyItem.second.SerializeTo(writer);
+   }
+   writer.EndObject();
+
+  }
+
+  writer.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
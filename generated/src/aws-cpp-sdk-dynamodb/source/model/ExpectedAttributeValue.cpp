@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/ExpectedAttributeValue.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -110,6 +111,42 @@ JsonValue ExpectedAttributeValue::Jsonize() const
   return payload;
 }
 
+void ExpectedAttributeValue::SerializeTo(JsonWriter& writer) const
+{
+  writer.StartObject();
+
+  if(m_valueHasBeenSet)
+  {
+   writer.Key("Value");
+   m_value.SerializeTo(writer);
+
+  }
+
+  if(m_existsHasBeenSet)
+  {
+   writer.WithBool("Exists", m_exists);
+
+  }
+
+  if(m_comparisonOperatorHasBeenSet)
+  {
+   writer.WithString("ComparisonOperator", ComparisonOperatorMapper::GetNameForComparisonOperator(m_comparisonOperator));
+  }
+
+  if(m_attributeValueListHasBeenSet)
+  {
+   writer.Key("AttributeValueList").StartArray();
+   for(const auto& attributeValueListItem : m_attributeValueList)
+   {
+     attributeValueListItem.SerializeTo(writer);
+   }
+   writer.EndArray();
+
+  }
+
+  writer.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/PutItemRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -34,90 +35,96 @@ PutItemRequest::PutItemRequest() :
 
 Aws::String PutItemRequest::SerializePayload() const
 {
-  JsonValue payload;
+  Aws::String payload;
+  JsonWriter writer(payload);
+  writer.StartObject();
 
   if(m_tableNameHasBeenSet)
   {
-   payload.WithString("TableName", m_tableName);
+   writer.WithString("TableName", m_tableName);
 
   }
 
   if(m_itemHasBeenSet)
   {
-   JsonValue itemJsonMap;
+   writer.Key("Item").StartObject();
    for(auto& itemItem : m_item)
    {
-     itemJsonMap.WithObject(itemItem.first, itemItem.second.Jsonize());
+     writer.Key(itemItem.first);
+     itemItem.second.SerializeTo(writer);
    }
-   payload.WithObject("Item", std::move(itemJsonMap));
+   writer.EndObject();
 
   }
 
   if(m_expectedHasBeenSet)
   {
-   JsonValue expectedJsonMap;
+   writer.Key("Expected").StartObject();
    for(auto& expectedItem : m_expected)
    {
-     expectedJsonMap.WithObject(expectedItem.first, expectedItem.second.Jsonize());
+     writer.Key(expectedItem.first);
+     expectedItem.second.SerializeTo(writer);
    }
-   payload.WithObject("Expected", std::move(expectedJsonMap));
+   writer.EndObject();
 
   }
 
   if(m_returnValuesHasBeenSet)
   {
-   payload.WithString("ReturnValues", ReturnValueMapper::GetNameForReturnValue(m_returnValues));
+   writer.WithString("ReturnValues", ReturnValueMapper::GetNameForReturnValue(m_returnValues));
   }
 
   if(m_returnConsumedCapacityHasBeenSet)
   {
-   payload.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
+   writer.WithString("ReturnConsumedCapacity", ReturnConsumedCapacityMapper::GetNameForReturnConsumedCapacity(m_returnConsumedCapacity));
   }
 
   if(m_returnItemCollectionMetricsHasBeenSet)
   {
-   payload.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
+   writer.WithString("ReturnItemCollectionMetrics", ReturnItemCollectionMetricsMapper::GetNameForReturnItemCollectionMetrics(m_returnItemCollectionMetrics));
   }
 
   if(m_conditionalOperatorHasBeenSet)
   {
-   payload.WithString("ConditionalOperator", ConditionalOperatorMapper::GetNameForConditionalOperator(m_conditionalOperator));
+   writer.WithString("ConditionalOperator", ConditionalOperatorMapper::GetNameForConditionalOperator(m_conditionalOperator));
   }
 
   if(m_conditionExpressionHasBeenSet)
   {
-   payload.WithString("ConditionExpression", m_conditionExpression);
+   writer.WithString("ConditionExpression", m_conditionExpression);
 
   }
 
   if(m_expressionAttributeNamesHasBeenSet)
   {
-   JsonValue expressionAttributeNamesJsonMap;
+   writer.Key("ExpressionAttributeNames").StartObject();
    for(auto& expressionAttributeNamesItem : m_expressionAttributeNames)
    {
-     expressionAttributeNamesJsonMap.WithString(expressionAttributeNamesItem.first, expressionAttributeNamesItem.second);
+     writer.WithString(expressionAttributeNamesItem.first, expressionAttributeNamesItem.second);
    }
-   payload.WithObject("ExpressionAttributeNames", std::move(expressionAttributeNamesJsonMap));
+   writer.EndObject();
 
   }
 
   if(m_expressionAttributeValuesHasBeenSet)
   {
-   JsonValue expressionAttributeValuesJsonMap;
+   writer.Key("ExpressionAttributeValues").StartObject();
    for(auto& expressionAttributeValuesItem : m_expressionAttributeValues)
    {
-     expressionAttributeValuesJsonMap.WithObject(expressionAttributeValuesItem.first, expressionAttributeValuesItem.second.Jsonize());
+     writer.Key(expressionAttributeValuesItem.first);
+     expressionAttributeValuesItem.second.SerializeTo(writer);
    }
-   payload.WithObject("ExpressionAttributeValues", std::move(expressionAttributeValuesJsonMap));
+   writer.EndObject();
 
   }
 
   if(m_returnValuesOnConditionCheckFailureHasBeenSet)
   {
-   payload.WithString("ReturnValuesOnConditionCheckFailure", ReturnValuesOnConditionCheckFailureMapper::GetNameForReturnValuesOnConditionCheckFailure(m_returnValuesOnConditionCheckFailure));
+   writer.WithString("ReturnValuesOnConditionCheckFailure", ReturnValuesOnConditionCheckFailureMapper::GetNameForReturnValuesOnConditionCheckFailure(m_returnValuesOnConditionCheckFailure));
   }
 
-  return payload.View().WriteReadable();
+  writer.EndObject();
+  return payload;
 }
 
 Aws::Http::HeaderValueCollection PutItemRequest::GetRequestSpecificHeaders() const
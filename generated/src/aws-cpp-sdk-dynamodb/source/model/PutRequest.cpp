@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/PutRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -62,6 +63,25 @@ JsonValue PutRequest::Jsonize() const
   return payload;
 }
 
+void PutRequest::SerializeTo(JsonWriter& writer) const
+{
+  writer.StartObject();
+
+  if(m_itemHasBeenSet)
+  {
+   writer.Key("Item").StartObject();
+   for(auto& itemItem : m_item)
+   {
+     writer.Key(itemItem.first);
+     itemItem.second.SerializeTo(writer);
+   }
+   writer.EndObject();
+
+  }
+
+  writer.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
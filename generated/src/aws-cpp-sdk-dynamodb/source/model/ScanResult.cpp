@@ -5,10 +5,12 @@
 
 #include <aws/dynamodb/model/ScanResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
@@ -30,6 +32,13 @@ ScanResult::ScanResult(const Aws::AmazonWebServiceResult<JsonValue>& result) :
   *this = result;
 }
 
+ScanResult::ScanResult(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = std::move(result);
+}
+
 ScanResult& ScanResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>& result)
 {
   JsonView jsonValue = result.GetPayload().View();
@@ -84,5 +93,79 @@ ScanResult& ScanResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>&
   }
 
 
+  return *this;
+}
+
+ScanResult& ScanResult::operator =(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  JsonReader reader(result.GetPayload().GetUnderlyingStream());
+  if(reader.Next() == JsonToken::StartObject)
+  {
+    while(reader.NextMember())
+    {
+      const Aws::String memberName = reader.TakeString();
+      const JsonToken token = reader.Next();
+      if(memberName == "Items" && token == JsonToken::StartArray)
+      {
+        while(reader.NextElement())
+        {
+          Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+          if(reader.GetToken() == JsonToken::StartObject)
+          {
+            while(reader.NextMember())
+            {
+              Aws::String attributeMapKey = reader.TakeString();
+              reader.Next();
+              attributeMapMap[std::move(attributeMapKey)].DeserializeFrom(reader);
+            }
+          }
+          else
+          {
+            reader.SkipValue();
+          }
+          m_items.push_back(std::move(attributeMapMap));
+        }
+      }
+      else if(memberName == "Count" && token == JsonToken::Number)
+      {
+        m_count = reader.GetInteger();
+      }
+      else if(memberName == "ScannedCount" && token == JsonToken::Number)
+      {
+        m_scannedCount = reader.GetInteger();
+      }
+      else if(memberName == "LastEvaluatedKey" && token == JsonToken::StartObject)
+      {
+        while(reader.NextMember())
+        {
+          Aws::String lastEvaluatedKeyKey = reader.TakeString();
+          reader.Next();
+          m_lastEvaluatedKey[std::move(lastEvaluatedKeyKey)].DeserializeFrom(reader);
+        }
+      }
+      else if(memberName == "ConsumedCapacity")
+      {
+        m_consumedCapacity.DeserializeFrom(reader);
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+  }
+
+  if(!reader.WasParseSuccessful())
+  {
+    m_parseErrorMessage = reader.GetErrorMessage();
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestIdIter = headers.find("x-amzn-requestid");
+  if(requestIdIter != headers.end())
+  {
+    m_requestId = requestIdIter->second;
+  }
+
+
   return *this;
 }
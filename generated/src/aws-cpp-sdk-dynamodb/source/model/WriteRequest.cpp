@@ -5,6 +5,7 @@
 
 #include <aws/dynamodb/model/WriteRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonWriter.h>
 
 #include <utility>
 
@@ -69,6 +70,27 @@ JsonValue WriteRequest::Jsonize() const
   return payload;
 }
 
+void WriteRequest::SerializeTo(JsonWriter& writer) const
+{
+  writer.StartObject();
+
+  if(m_putRequestHasBeenSet)
+  {
+   writer.Key("PutRequest");
+   m_putRequest.SerializeTo(writer);
+
+  }
+
+  if(m_deleteRequestHasBeenSet)
+  {
+   writer.Key("DeleteRequest");
+   m_deleteRequest.SerializeTo(writer);
+
+  }
+
+  writer.EndObject();
+}
+
 } // namespace Model
 } // namespace DynamoDB
 } // namespace Aws
@@ -22,6 +22,10 @@ namespace Xml
 {
   class XmlDocument;
 } // namespace Xml
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace EC2
 {
@@ -33,6 +37,17 @@ namespace Model
     AWS_EC2_API DescribeInstancesResponse();
     AWS_EC2_API DescribeInstancesResponse(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     AWS_EC2_API DescribeInstancesResponse& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    /**
+     * Reads the response directly from the response body with Aws::Utils::Xml::XmlReader, without building an XML DOM.
+     */
+    AWS_EC2_API DescribeInstancesResponse(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    AWS_EC2_API DescribeInstancesResponse& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    /**
+     * False when the response body read from the ResponseStream was malformed or truncated, the client then returns
+     * an error instead of this partial result.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -136,6 +151,8 @@ namespace Model
     Aws::String m_nextToken;
 
     ResponseMetadata m_responseMetadata;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
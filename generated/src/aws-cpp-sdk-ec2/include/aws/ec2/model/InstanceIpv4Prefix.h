@@ -16,6 +16,7 @@ namespace Utils
 namespace Xml
 {
   class XmlNode;
+  class XmlReader;
 } // namespace Xml
 } // namespace Utils
 namespace EC2
@@ -34,6 +35,7 @@ namespace Model
     AWS_EC2_API InstanceIpv4Prefix();
     AWS_EC2_API InstanceIpv4Prefix(const Aws::Utils::Xml::XmlNode& xmlNode);
     AWS_EC2_API InstanceIpv4Prefix& operator=(const Aws::Utils::Xml::XmlNode& xmlNode);
+    AWS_EC2_API void DeserializeFrom(Aws::Utils::Xml::XmlReader& reader);
 
     AWS_EC2_API void OutputToStream(Aws::OStream& ostream, const char* location, unsigned index, const char* locationValue) const;
     AWS_EC2_API void OutputToStream(Aws::OStream& oStream, const char* location) const;
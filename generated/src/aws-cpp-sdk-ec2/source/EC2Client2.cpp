@@ -650,7 +650,17 @@ DescribeInstancesOutcome EC2Client::DescribeInstances(const DescribeInstancesReq
           *meter,
           {{TracingUtils::SMITHY_METHOD_DIMENSION, request.GetServiceRequestName()}, {TracingUtils::SMITHY_SERVICE_DIMENSION, this->GetServiceClientName()}});
       AWS_OPERATION_CHECK_SUCCESS(endpointResolutionOutcome, DescribeInstances, CoreErrors, CoreErrors::ENDPOINT_RESOLUTION_FAILURE, endpointResolutionOutcome.GetError().GetMessage());
-      return DescribeInstancesOutcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST));
+      auto outcome = MakeRequestWithUnparsedResponse(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST);
+      if (!outcome.IsSuccess())
+      {
+        return DescribeInstancesOutcome(outcome.GetError());
+      }
+      DescribeInstancesResponse result(outcome.GetResultWithOwnership());
+      if (!result.WasParseSuccessful())
+      {
+        return DescribeInstancesOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Xml Parser Error", result.GetParseErrorMessage(), false));
+      }
+      return DescribeInstancesOutcome(std::move(result));
     },
     TracingUtils::SMITHY_CLIENT_DURATION_METRIC,
     *meter,
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/CapacityReservationSpecificationResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,29 @@ CapacityReservationSpecificationResponse& CapacityReservationSpecificationRespon
   return *this;
 }
 
+void CapacityReservationSpecificationResponse::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "capacityReservationPreference")
+    {
+      reader.ReadElementText();
+      m_capacityReservationPreference = CapacityReservationPreferenceMapper::GetCapacityReservationPreferenceForName(reader.GetTrimmedText());
+      m_capacityReservationPreferenceHasBeenSet = true;
+    }
+    else if(name == "capacityReservationTarget")
+    {
+      m_capacityReservationTarget.DeserializeFrom(reader);
+      m_capacityReservationTargetHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void CapacityReservationSpecificationResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_capacityReservationPreferenceHasBeenSet)
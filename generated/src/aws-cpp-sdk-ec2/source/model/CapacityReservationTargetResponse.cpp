@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/CapacityReservationTargetResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,30 @@ CapacityReservationTargetResponse& CapacityReservationTargetResponse::operator =
   return *this;
 }
 
+void CapacityReservationTargetResponse::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "capacityReservationId")
+    {
+      reader.ReadElementText();
+      m_capacityReservationId = reader.TakeText();
+      m_capacityReservationIdHasBeenSet = true;
+    }
+    else if(name == "capacityReservationResourceGroupArn")
+    {
+      reader.ReadElementText();
+      m_capacityReservationResourceGroupArn = reader.TakeText();
+      m_capacityReservationResourceGroupArnHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void CapacityReservationTargetResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_capacityReservationIdHasBeenSet)
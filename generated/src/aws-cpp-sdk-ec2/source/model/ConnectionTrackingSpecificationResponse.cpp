@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/ConnectionTrackingSpecificationResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -70,6 +71,36 @@ ConnectionTrackingSpecificationResponse& ConnectionTrackingSpecificationResponse
   return *this;
 }
 
+void ConnectionTrackingSpecificationResponse::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "tcpEstablishedTimeout")
+    {
+      reader.ReadElementText();
+      m_tcpEstablishedTimeout = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_tcpEstablishedTimeoutHasBeenSet = true;
+    }
+    else if(name == "udpStreamTimeout")
+    {
+      reader.ReadElementText();
+      m_udpStreamTimeout = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_udpStreamTimeoutHasBeenSet = true;
+    }
+    else if(name == "udpTimeout")
+    {
+      reader.ReadElementText();
+      m_udpTimeout = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_udpTimeoutHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void ConnectionTrackingSpecificationResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_tcpEstablishedTimeoutHasBeenSet)
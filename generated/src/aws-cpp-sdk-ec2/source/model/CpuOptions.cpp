@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/CpuOptions.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -70,6 +71,36 @@ CpuOptions& CpuOptions::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void CpuOptions::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "coreCount")
+    {
+      reader.ReadElementText();
+      m_coreCount = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_coreCountHasBeenSet = true;
+    }
+    else if(name == "threadsPerCore")
+    {
+      reader.ReadElementText();
+      m_threadsPerCore = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_threadsPerCoreHasBeenSet = true;
+    }
+    else if(name == "amdSevSnp")
+    {
+      reader.ReadElementText();
+      m_amdSevSnp = AmdSevSnpSpecificationMapper::GetAmdSevSnpSpecificationForName(reader.GetTrimmedText());
+      m_amdSevSnpHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void CpuOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_coreCountHasBeenSet)
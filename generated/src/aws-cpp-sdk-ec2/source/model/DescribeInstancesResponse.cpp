@@ -5,9 +5,11 @@
 
 #include <aws/ec2/model/DescribeInstancesResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
@@ -26,6 +28,11 @@ DescribeInstancesResponse::DescribeInstancesResponse(const Aws::AmazonWebService
   *this = result;
 }
 
+DescribeInstancesResponse::DescribeInstancesResponse(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  *this = std::move(result);
+}
+
 DescribeInstancesResponse& DescribeInstancesResponse::operator =(const Aws::AmazonWebServiceResult<XmlDocument>& result)
 {
   const XmlDocument& xmlDocument = result.GetPayload();
@@ -66,3 +73,53 @@ DescribeInstancesResponse& DescribeInstancesResponse::operator =(const Aws::Amaz
   }
   return *this;
 }
+
+DescribeInstancesResponse& DescribeInstancesResponse::operator =(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  XmlReader reader(result.GetPayload().GetUnderlyingStream());
+  // EC2 responses are not wrapped in a result element, the members are children of the root
+  if(reader.Next() == XmlToken::StartElement)
+  {
+    while(reader.NextChild())
+    {
+      const Aws::String& name = reader.GetName();
+      if(name == "reservationSet")
+      {
+        while(reader.NextChild())
+        {
+          if(reader.GetName() == "item")
+          {
+            m_reservations.emplace_back();
+            m_reservations.back().DeserializeFrom(reader);
+          }
+          else
+          {
+            reader.SkipElement();
+          }
+        }
+      }
+      else if(name == "nextToken")
+      {
+        reader.ReadElementText();
+        m_nextToken = reader.TakeText();
+      }
+      else if(name == "requestId")
+      {
+        reader.ReadElementText();
+        m_responseMetadata.SetRequestId(reader.GetTrimmedText());
+      }
+      else
+      {
+        reader.SkipElement();
+      }
+    }
+  }
+
+  if(!reader.WasParseSuccessful())
+  {
+    m_parseErrorMessage = reader.GetErrorMessage();
+    AWS_LOGSTREAM_ERROR("Aws::EC2::Model::DescribeInstancesResponse", "Failed to parse the response: " << m_parseErrorMessage);
+  }
+  AWS_LOGSTREAM_DEBUG("Aws::EC2::Model::DescribeInstancesResponse", "x-amzn-request-id: " << m_responseMetadata.GetRequestId() );
+  return *this;
+}
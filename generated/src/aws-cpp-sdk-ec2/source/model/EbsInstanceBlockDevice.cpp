@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/EbsInstanceBlockDevice.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -92,6 +93,54 @@ EbsInstanceBlockDevice& EbsInstanceBlockDevice::operator =(const XmlNode& xmlNod
   return *this;
 }
 
+void EbsInstanceBlockDevice::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "attachTime")
+    {
+      reader.ReadElementText();
+      m_attachTime = DateTime(reader.GetTrimmedText(), Aws::Utils::DateFormat::ISO_8601);
+      m_attachTimeHasBeenSet = true;
+    }
+    else if(name == "deleteOnTermination")
+    {
+      reader.ReadElementText();
+      m_deleteOnTermination = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_deleteOnTerminationHasBeenSet = true;
+    }
+    else if(name == "status")
+    {
+      reader.ReadElementText();
+      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(reader.GetTrimmedText());
+      m_statusHasBeenSet = true;
+    }
+    else if(name == "volumeId")
+    {
+      reader.ReadElementText();
+      m_volumeId = reader.TakeText();
+      m_volumeIdHasBeenSet = true;
+    }
+    else if(name == "associatedResource")
+    {
+      reader.ReadElementText();
+      m_associatedResource = reader.TakeText();
+      m_associatedResourceHasBeenSet = true;
+    }
+    else if(name == "volumeOwnerId")
+    {
+      reader.ReadElementText();
+      m_volumeOwnerId = reader.TakeText();
+      m_volumeOwnerIdHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void EbsInstanceBlockDevice::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachTimeHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/ElasticGpuAssociation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -72,6 +73,42 @@ ElasticGpuAssociation& ElasticGpuAssociation::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void ElasticGpuAssociation::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "elasticGpuId")
+    {
+      reader.ReadElementText();
+      m_elasticGpuId = reader.TakeText();
+      m_elasticGpuIdHasBeenSet = true;
+    }
+    else if(name == "elasticGpuAssociationId")
+    {
+      reader.ReadElementText();
+      m_elasticGpuAssociationId = reader.TakeText();
+      m_elasticGpuAssociationIdHasBeenSet = true;
+    }
+    else if(name == "elasticGpuAssociationState")
+    {
+      reader.ReadElementText();
+      m_elasticGpuAssociationState = reader.TakeText();
+      m_elasticGpuAssociationStateHasBeenSet = true;
+    }
+    else if(name == "elasticGpuAssociationTime")
+    {
+      reader.ReadElementText();
+      m_elasticGpuAssociationTime = reader.TakeText();
+      m_elasticGpuAssociationTimeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void ElasticGpuAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_elasticGpuIdHasBeenSet)
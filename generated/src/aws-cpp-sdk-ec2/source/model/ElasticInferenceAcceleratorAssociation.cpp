@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/ElasticInferenceAcceleratorAssociation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -72,6 +73,42 @@ ElasticInferenceAcceleratorAssociation& ElasticInferenceAcceleratorAssociation::
   return *this;
 }
 
+void ElasticInferenceAcceleratorAssociation::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "elasticInferenceAcceleratorArn")
+    {
+      reader.ReadElementText();
+      m_elasticInferenceAcceleratorArn = reader.TakeText();
+      m_elasticInferenceAcceleratorArnHasBeenSet = true;
+    }
+    else if(name == "elasticInferenceAcceleratorAssociationId")
+    {
+      reader.ReadElementText();
+      m_elasticInferenceAcceleratorAssociationId = reader.TakeText();
+      m_elasticInferenceAcceleratorAssociationIdHasBeenSet = true;
+    }
+    else if(name == "elasticInferenceAcceleratorAssociationState")
+    {
+      reader.ReadElementText();
+      m_elasticInferenceAcceleratorAssociationState = reader.TakeText();
+      m_elasticInferenceAcceleratorAssociationStateHasBeenSet = true;
+    }
+    else if(name == "elasticInferenceAcceleratorAssociationTime")
+    {
+      reader.ReadElementText();
+      m_elasticInferenceAcceleratorAssociationTime = DateTime(reader.GetTrimmedText(), Aws::Utils::DateFormat::ISO_8601);
+      m_elasticInferenceAcceleratorAssociationTimeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void ElasticInferenceAcceleratorAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_elasticInferenceAcceleratorArnHasBeenSet)
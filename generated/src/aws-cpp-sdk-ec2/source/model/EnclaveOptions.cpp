@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/EnclaveOptions.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -50,6 +51,24 @@ EnclaveOptions& EnclaveOptions::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void EnclaveOptions::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "enabled")
+    {
+      reader.ReadElementText();
+      m_enabled = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enabledHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void EnclaveOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_enabledHasBeenSet)
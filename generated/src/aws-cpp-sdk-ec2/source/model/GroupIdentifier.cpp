@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/GroupIdentifier.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,30 @@ GroupIdentifier& GroupIdentifier::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void GroupIdentifier::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "groupName")
+    {
+      reader.ReadElementText();
+      m_groupName = reader.TakeText();
+      m_groupNameHasBeenSet = true;
+    }
+    else if(name == "groupId")
+    {
+      reader.ReadElementText();
+      m_groupId = reader.TakeText();
+      m_groupIdHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void GroupIdentifier::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_groupNameHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/HibernationOptions.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -50,6 +51,24 @@ HibernationOptions& HibernationOptions::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void HibernationOptions::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "configured")
+    {
+      reader.ReadElementText();
+      m_configured = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_configuredHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void HibernationOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_configuredHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/IamInstanceProfile.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,30 @@ IamInstanceProfile& IamInstanceProfile::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void IamInstanceProfile::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "arn")
+    {
+      reader.ReadElementText();
+      m_arn = reader.TakeText();
+      m_arnHasBeenSet = true;
+    }
+    else if(name == "id")
+    {
+      reader.ReadElementText();
+      m_id = reader.TakeText();
+      m_idHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void IamInstanceProfile::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_arnHasBeenSet)
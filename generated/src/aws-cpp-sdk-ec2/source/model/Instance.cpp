@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/Instance.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -570,6 +571,428 @@ Instance& Instance::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void Instance::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "amiLaunchIndex")
+    {
+      reader.ReadElementText();
+      m_amiLaunchIndex = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_amiLaunchIndexHasBeenSet = true;
+    }
+    else if(name == "imageId")
+    {
+      reader.ReadElementText();
+      m_imageId = reader.TakeText();
+      m_imageIdHasBeenSet = true;
+    }
+    else if(name == "instanceId")
+    {
+      reader.ReadElementText();
+      m_instanceId = reader.TakeText();
+      m_instanceIdHasBeenSet = true;
+    }
+    else if(name == "instanceType")
+    {
+      reader.ReadElementText();
+      m_instanceType = InstanceTypeMapper::GetInstanceTypeForName(reader.GetTrimmedText());
+      m_instanceTypeHasBeenSet = true;
+    }
+    else if(name == "kernelId")
+    {
+      reader.ReadElementText();
+      m_kernelId = reader.TakeText();
+      m_kernelIdHasBeenSet = true;
+    }
+    else if(name == "keyName")
+    {
+      reader.ReadElementText();
+      m_keyName = reader.TakeText();
+      m_keyNameHasBeenSet = true;
+    }
+    else if(name == "launchTime")
+    {
+      reader.ReadElementText();
+      m_launchTime = DateTime(reader.GetTrimmedText(), Aws::Utils::DateFormat::ISO_8601);
+      m_launchTimeHasBeenSet = true;
+    }
+    else if(name == "monitoring")
+    {
+      m_monitoring.DeserializeFrom(reader);
+      m_monitoringHasBeenSet = true;
+    }
+    else if(name == "placement")
+    {
+      m_placement.DeserializeFrom(reader);
+      m_placementHasBeenSet = true;
+    }
+    else if(name == "platform")
+    {
+      reader.ReadElementText();
+      m_platform = PlatformValuesMapper::GetPlatformValuesForName(reader.GetTrimmedText());
+      m_platformHasBeenSet = true;
+    }
+    else if(name == "privateDnsName")
+    {
+      reader.ReadElementText();
+      m_privateDnsName = reader.TakeText();
+      m_privateDnsNameHasBeenSet = true;
+    }
+    else if(name == "privateIpAddress")
+    {
+      reader.ReadElementText();
+      m_privateIpAddress = reader.TakeText();
+      m_privateIpAddressHasBeenSet = true;
+    }
+    else if(name == "productCodes")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_productCodes.emplace_back();
+          m_productCodes.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_productCodesHasBeenSet = true;
+    }
+    else if(name == "dnsName")
+    {
+      reader.ReadElementText();
+      m_publicDnsName = reader.TakeText();
+      m_publicDnsNameHasBeenSet = true;
+    }
+    else if(name == "ipAddress")
+    {
+      reader.ReadElementText();
+      m_publicIpAddress = reader.TakeText();
+      m_publicIpAddressHasBeenSet = true;
+    }
+    else if(name == "ramdiskId")
+    {
+      reader.ReadElementText();
+      m_ramdiskId = reader.TakeText();
+      m_ramdiskIdHasBeenSet = true;
+    }
+    else if(name == "instanceState")
+    {
+      m_state.DeserializeFrom(reader);
+      m_stateHasBeenSet = true;
+    }
+    else if(name == "reason")
+    {
+      reader.ReadElementText();
+      m_stateTransitionReason = reader.TakeText();
+      m_stateTransitionReasonHasBeenSet = true;
+    }
+    else if(name == "subnetId")
+    {
+      reader.ReadElementText();
+      m_subnetId = reader.TakeText();
+      m_subnetIdHasBeenSet = true;
+    }
+    else if(name == "vpcId")
+    {
+      reader.ReadElementText();
+      m_vpcId = reader.TakeText();
+      m_vpcIdHasBeenSet = true;
+    }
+    else if(name == "architecture")
+    {
+      reader.ReadElementText();
+      m_architecture = ArchitectureValuesMapper::GetArchitectureValuesForName(reader.GetTrimmedText());
+      m_architectureHasBeenSet = true;
+    }
+    else if(name == "blockDeviceMapping")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_blockDeviceMappings.emplace_back();
+          m_blockDeviceMappings.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_blockDeviceMappingsHasBeenSet = true;
+    }
+    else if(name == "clientToken")
+    {
+      reader.ReadElementText();
+      m_clientToken = reader.TakeText();
+      m_clientTokenHasBeenSet = true;
+    }
+    else if(name == "ebsOptimized")
+    {
+      reader.ReadElementText();
+      m_ebsOptimized = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_ebsOptimizedHasBeenSet = true;
+    }
+    else if(name == "enaSupport")
+    {
+      reader.ReadElementText();
+      m_enaSupport = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enaSupportHasBeenSet = true;
+    }
+    else if(name == "hypervisor")
+    {
+      reader.ReadElementText();
+      m_hypervisor = HypervisorTypeMapper::GetHypervisorTypeForName(reader.GetTrimmedText());
+      m_hypervisorHasBeenSet = true;
+    }
+    else if(name == "iamInstanceProfile")
+    {
+      m_iamInstanceProfile.DeserializeFrom(reader);
+      m_iamInstanceProfileHasBeenSet = true;
+    }
+    else if(name == "instanceLifecycle")
+    {
+      reader.ReadElementText();
+      m_instanceLifecycle = InstanceLifecycleTypeMapper::GetInstanceLifecycleTypeForName(reader.GetTrimmedText());
+      m_instanceLifecycleHasBeenSet = true;
+    }
+    else if(name == "elasticGpuAssociationSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_elasticGpuAssociations.emplace_back();
+          m_elasticGpuAssociations.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_elasticGpuAssociationsHasBeenSet = true;
+    }
+    else if(name == "elasticInferenceAcceleratorAssociationSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_elasticInferenceAcceleratorAssociations.emplace_back();
+          m_elasticInferenceAcceleratorAssociations.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_elasticInferenceAcceleratorAssociationsHasBeenSet = true;
+    }
+    else if(name == "networkInterfaceSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_networkInterfaces.emplace_back();
+          m_networkInterfaces.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_networkInterfacesHasBeenSet = true;
+    }
+    else if(name == "outpostArn")
+    {
+      reader.ReadElementText();
+      m_outpostArn = reader.TakeText();
+      m_outpostArnHasBeenSet = true;
+    }
+    else if(name == "rootDeviceName")
+    {
+      reader.ReadElementText();
+      m_rootDeviceName = reader.TakeText();
+      m_rootDeviceNameHasBeenSet = true;
+    }
+    else if(name == "rootDeviceType")
+    {
+      reader.ReadElementText();
+      m_rootDeviceType = DeviceTypeMapper::GetDeviceTypeForName(reader.GetTrimmedText());
+      m_rootDeviceTypeHasBeenSet = true;
+    }
+    else if(name == "groupSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_securityGroups.emplace_back();
+          m_securityGroups.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_securityGroupsHasBeenSet = true;
+    }
+    else if(name == "sourceDestCheck")
+    {
+      reader.ReadElementText();
+      m_sourceDestCheck = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_sourceDestCheckHasBeenSet = true;
+    }
+    else if(name == "spotInstanceRequestId")
+    {
+      reader.ReadElementText();
+      m_spotInstanceRequestId = reader.TakeText();
+      m_spotInstanceRequestIdHasBeenSet = true;
+    }
+    else if(name == "sriovNetSupport")
+    {
+      reader.ReadElementText();
+      m_sriovNetSupport = reader.TakeText();
+      m_sriovNetSupportHasBeenSet = true;
+    }
+    else if(name == "stateReason")
+    {
+      m_stateReason.DeserializeFrom(reader);
+      m_stateReasonHasBeenSet = true;
+    }
+    else if(name == "tagSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_tags.emplace_back();
+          m_tags.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_tagsHasBeenSet = true;
+    }
+    else if(name == "virtualizationType")
+    {
+      reader.ReadElementText();
+      m_virtualizationType = VirtualizationTypeMapper::GetVirtualizationTypeForName(reader.GetTrimmedText());
+      m_virtualizationTypeHasBeenSet = true;
+    }
+    else if(name == "cpuOptions")
+    {
+      m_cpuOptions.DeserializeFrom(reader);
+      m_cpuOptionsHasBeenSet = true;
+    }
+    else if(name == "capacityReservationId")
+    {
+      reader.ReadElementText();
+      m_capacityReservationId = reader.TakeText();
+      m_capacityReservationIdHasBeenSet = true;
+    }
+    else if(name == "capacityReservationSpecification")
+    {
+      m_capacityReservationSpecification.DeserializeFrom(reader);
+      m_capacityReservationSpecificationHasBeenSet = true;
+    }
+    else if(name == "hibernationOptions")
+    {
+      m_hibernationOptions.DeserializeFrom(reader);
+      m_hibernationOptionsHasBeenSet = true;
+    }
+    else if(name == "licenseSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_licenses.emplace_back();
+          m_licenses.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_licensesHasBeenSet = true;
+    }
+    else if(name == "metadataOptions")
+    {
+      m_metadataOptions.DeserializeFrom(reader);
+      m_metadataOptionsHasBeenSet = true;
+    }
+    else if(name == "enclaveOptions")
+    {
+      m_enclaveOptions.DeserializeFrom(reader);
+      m_enclaveOptionsHasBeenSet = true;
+    }
+    else if(name == "bootMode")
+    {
+      reader.ReadElementText();
+      m_bootMode = BootModeValuesMapper::GetBootModeValuesForName(reader.GetTrimmedText());
+      m_bootModeHasBeenSet = true;
+    }
+    else if(name == "platformDetails")
+    {
+      reader.ReadElementText();
+      m_platformDetails = reader.TakeText();
+      m_platformDetailsHasBeenSet = true;
+    }
+    else if(name == "usageOperation")
+    {
+      reader.ReadElementText();
+      m_usageOperation = reader.TakeText();
+      m_usageOperationHasBeenSet = true;
+    }
+    else if(name == "usageOperationUpdateTime")
+    {
+      reader.ReadElementText();
+      m_usageOperationUpdateTime = DateTime(reader.GetTrimmedText(), Aws::Utils::DateFormat::ISO_8601);
+      m_usageOperationUpdateTimeHasBeenSet = true;
+    }
+    else if(name == "privateDnsNameOptions")
+    {
+      m_privateDnsNameOptions.DeserializeFrom(reader);
+      m_privateDnsNameOptionsHasBeenSet = true;
+    }
+    else if(name == "ipv6Address")
+    {
+      reader.ReadElementText();
+      m_ipv6Address = reader.TakeText();
+      m_ipv6AddressHasBeenSet = true;
+    }
+    else if(name == "tpmSupport")
+    {
+      reader.ReadElementText();
+      m_tpmSupport = reader.TakeText();
+      m_tpmSupportHasBeenSet = true;
+    }
+    else if(name == "maintenanceOptions")
+    {
+      m_maintenanceOptions.DeserializeFrom(reader);
+      m_maintenanceOptionsHasBeenSet = true;
+    }
+    else if(name == "currentInstanceBootMode")
+    {
+      reader.ReadElementText();
+      m_currentInstanceBootMode = InstanceBootModeValuesMapper::GetInstanceBootModeValuesForName(reader.GetTrimmedText());
+      m_currentInstanceBootModeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void Instance::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_amiLaunchIndexHasBeenSet)
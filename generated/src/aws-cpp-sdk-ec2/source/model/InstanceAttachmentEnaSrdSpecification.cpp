@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceAttachmentEnaSrdSpecification.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,29 @@ InstanceAttachmentEnaSrdSpecification& InstanceAttachmentEnaSrdSpecification::op
   return *this;
 }
 
+void InstanceAttachmentEnaSrdSpecification::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "enaSrdEnabled")
+    {
+      reader.ReadElementText();
+      m_enaSrdEnabled = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enaSrdEnabledHasBeenSet = true;
+    }
+    else if(name == "enaSrdUdpSpecification")
+    {
+      m_enaSrdUdpSpecification.DeserializeFrom(reader);
+      m_enaSrdUdpSpecificationHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceAttachmentEnaSrdSpecification::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_enaSrdEnabledHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceAttachmentEnaSrdUdpSpecification.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -50,6 +51,24 @@ InstanceAttachmentEnaSrdUdpSpecification& InstanceAttachmentEnaSrdUdpSpecificati
   return *this;
 }
 
+void InstanceAttachmentEnaSrdUdpSpecification::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "enaSrdUdpEnabled")
+    {
+      reader.ReadElementText();
+      m_enaSrdUdpEnabled = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enaSrdUdpEnabledHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceAttachmentEnaSrdUdpSpecification::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_enaSrdUdpEnabledHasBeenSet)
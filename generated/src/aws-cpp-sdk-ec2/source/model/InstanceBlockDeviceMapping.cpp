@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceBlockDeviceMapping.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,29 @@ InstanceBlockDeviceMapping& InstanceBlockDeviceMapping::operator =(const XmlNode
   return *this;
 }
 
+void InstanceBlockDeviceMapping::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "deviceName")
+    {
+      reader.ReadElementText();
+      m_deviceName = reader.TakeText();
+      m_deviceNameHasBeenSet = true;
+    }
+    else if(name == "ebs")
+    {
+      m_ebs.DeserializeFrom(reader);
+      m_ebsHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceBlockDeviceMapping::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_deviceNameHasBeenSet)
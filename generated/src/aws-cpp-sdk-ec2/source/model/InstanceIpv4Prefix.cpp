@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceIpv4Prefix.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -48,6 +49,24 @@ InstanceIpv4Prefix& InstanceIpv4Prefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void InstanceIpv4Prefix::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "ipv4Prefix")
+    {
+      reader.ReadElementText();
+      m_ipv4Prefix = reader.TakeText();
+      m_ipv4PrefixHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceIpv4Prefix::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_ipv4PrefixHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceIpv6Address.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,30 @@ InstanceIpv6Address& InstanceIpv6Address::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void InstanceIpv6Address::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "ipv6Address")
+    {
+      reader.ReadElementText();
+      m_ipv6Address = reader.TakeText();
+      m_ipv6AddressHasBeenSet = true;
+    }
+    else if(name == "isPrimaryIpv6")
+    {
+      reader.ReadElementText();
+      m_isPrimaryIpv6 = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_isPrimaryIpv6HasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceIpv6Address::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_ipv6AddressHasBeenSet)
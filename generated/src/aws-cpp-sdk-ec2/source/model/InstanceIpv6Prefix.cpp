@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceIpv6Prefix.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -48,6 +49,24 @@ InstanceIpv6Prefix& InstanceIpv6Prefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void InstanceIpv6Prefix::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "ipv6Prefix")
+    {
+      reader.ReadElementText();
+      m_ipv6Prefix = reader.TakeText();
+      m_ipv6PrefixHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceIpv6Prefix::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_ipv6PrefixHasBeenSet)
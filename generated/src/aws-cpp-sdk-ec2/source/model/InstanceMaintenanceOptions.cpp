@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceMaintenanceOptions.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -50,6 +51,24 @@ InstanceMaintenanceOptions& InstanceMaintenanceOptions::operator =(const XmlNode
   return *this;
 }
 
+void InstanceMaintenanceOptions::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "autoRecovery")
+    {
+      reader.ReadElementText();
+      m_autoRecovery = InstanceAutoRecoveryStateMapper::GetInstanceAutoRecoveryStateForName(reader.GetTrimmedText());
+      m_autoRecoveryHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceMaintenanceOptions::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_autoRecoveryHasBeenSet)
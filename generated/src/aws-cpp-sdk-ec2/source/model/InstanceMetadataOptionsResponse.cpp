@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceMetadataOptionsResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -100,6 +101,54 @@ InstanceMetadataOptionsResponse& InstanceMetadataOptionsResponse::operator =(con
   return *this;
 }
 
+void InstanceMetadataOptionsResponse::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "state")
+    {
+      reader.ReadElementText();
+      m_state = InstanceMetadataOptionsStateMapper::GetInstanceMetadataOptionsStateForName(reader.GetTrimmedText());
+      m_stateHasBeenSet = true;
+    }
+    else if(name == "httpTokens")
+    {
+      reader.ReadElementText();
+      m_httpTokens = HttpTokensStateMapper::GetHttpTokensStateForName(reader.GetTrimmedText());
+      m_httpTokensHasBeenSet = true;
+    }
+    else if(name == "httpPutResponseHopLimit")
+    {
+      reader.ReadElementText();
+      m_httpPutResponseHopLimit = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_httpPutResponseHopLimitHasBeenSet = true;
+    }
+    else if(name == "httpEndpoint")
+    {
+      reader.ReadElementText();
+      m_httpEndpoint = InstanceMetadataEndpointStateMapper::GetInstanceMetadataEndpointStateForName(reader.GetTrimmedText());
+      m_httpEndpointHasBeenSet = true;
+    }
+    else if(name == "httpProtocolIpv6")
+    {
+      reader.ReadElementText();
+      m_httpProtocolIpv6 = InstanceMetadataProtocolStateMapper::GetInstanceMetadataProtocolStateForName(reader.GetTrimmedText());
+      m_httpProtocolIpv6HasBeenSet = true;
+    }
+    else if(name == "instanceMetadataTags")
+    {
+      reader.ReadElementText();
+      m_instanceMetadataTags = InstanceMetadataTagsStateMapper::GetInstanceMetadataTagsStateForName(reader.GetTrimmedText());
+      m_instanceMetadataTagsHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceMetadataOptionsResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_stateHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceNetworkInterface.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -226,6 +227,179 @@ InstanceNetworkInterface& InstanceNetworkInterface::operator =(const XmlNode& xm
   return *this;
 }
 
+void InstanceNetworkInterface::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "association")
+    {
+      m_association.DeserializeFrom(reader);
+      m_associationHasBeenSet = true;
+    }
+    else if(name == "attachment")
+    {
+      m_attachment.DeserializeFrom(reader);
+      m_attachmentHasBeenSet = true;
+    }
+    else if(name == "description")
+    {
+      reader.ReadElementText();
+      m_description = reader.TakeText();
+      m_descriptionHasBeenSet = true;
+    }
+    else if(name == "groupSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_groups.emplace_back();
+          m_groups.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_groupsHasBeenSet = true;
+    }
+    else if(name == "ipv6AddressesSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_ipv6Addresses.emplace_back();
+          m_ipv6Addresses.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_ipv6AddressesHasBeenSet = true;
+    }
+    else if(name == "macAddress")
+    {
+      reader.ReadElementText();
+      m_macAddress = reader.TakeText();
+      m_macAddressHasBeenSet = true;
+    }
+    else if(name == "networkInterfaceId")
+    {
+      reader.ReadElementText();
+      m_networkInterfaceId = reader.TakeText();
+      m_networkInterfaceIdHasBeenSet = true;
+    }
+    else if(name == "ownerId")
+    {
+      reader.ReadElementText();
+      m_ownerId = reader.TakeText();
+      m_ownerIdHasBeenSet = true;
+    }
+    else if(name == "privateDnsName")
+    {
+      reader.ReadElementText();
+      m_privateDnsName = reader.TakeText();
+      m_privateDnsNameHasBeenSet = true;
+    }
+    else if(name == "privateIpAddress")
+    {
+      reader.ReadElementText();
+      m_privateIpAddress = reader.TakeText();
+      m_privateIpAddressHasBeenSet = true;
+    }
+    else if(name == "privateIpAddressesSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_privateIpAddresses.emplace_back();
+          m_privateIpAddresses.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_privateIpAddressesHasBeenSet = true;
+    }
+    else if(name == "sourceDestCheck")
+    {
+      reader.ReadElementText();
+      m_sourceDestCheck = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_sourceDestCheckHasBeenSet = true;
+    }
+    else if(name == "status")
+    {
+      reader.ReadElementText();
+      m_status = NetworkInterfaceStatusMapper::GetNetworkInterfaceStatusForName(reader.GetTrimmedText());
+      m_statusHasBeenSet = true;
+    }
+    else if(name == "subnetId")
+    {
+      reader.ReadElementText();
+      m_subnetId = reader.TakeText();
+      m_subnetIdHasBeenSet = true;
+    }
+    else if(name == "vpcId")
+    {
+      reader.ReadElementText();
+      m_vpcId = reader.TakeText();
+      m_vpcIdHasBeenSet = true;
+    }
+    else if(name == "interfaceType")
+    {
+      reader.ReadElementText();
+      m_interfaceType = reader.TakeText();
+      m_interfaceTypeHasBeenSet = true;
+    }
+    else if(name == "ipv4PrefixSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_ipv4Prefixes.emplace_back();
+          m_ipv4Prefixes.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_ipv4PrefixesHasBeenSet = true;
+    }
+    else if(name == "ipv6PrefixSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_ipv6Prefixes.emplace_back();
+          m_ipv6Prefixes.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_ipv6PrefixesHasBeenSet = true;
+    }
+    else if(name == "connectionTrackingConfiguration")
+    {
+      m_connectionTrackingConfiguration.DeserializeFrom(reader);
+      m_connectionTrackingConfigurationHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceNetworkInterface::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_associationHasBeenSet)
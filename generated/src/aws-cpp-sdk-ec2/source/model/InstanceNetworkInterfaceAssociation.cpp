@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceNetworkInterfaceAssociation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -80,6 +81,48 @@ InstanceNetworkInterfaceAssociation& InstanceNetworkInterfaceAssociation::operat
   return *this;
 }
 
+void InstanceNetworkInterfaceAssociation::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "carrierIp")
+    {
+      reader.ReadElementText();
+      m_carrierIp = reader.TakeText();
+      m_carrierIpHasBeenSet = true;
+    }
+    else if(name == "customerOwnedIp")
+    {
+      reader.ReadElementText();
+      m_customerOwnedIp = reader.TakeText();
+      m_customerOwnedIpHasBeenSet = true;
+    }
+    else if(name == "ipOwnerId")
+    {
+      reader.ReadElementText();
+      m_ipOwnerId = reader.TakeText();
+      m_ipOwnerIdHasBeenSet = true;
+    }
+    else if(name == "publicDnsName")
+    {
+      reader.ReadElementText();
+      m_publicDnsName = reader.TakeText();
+      m_publicDnsNameHasBeenSet = true;
+    }
+    else if(name == "publicIp")
+    {
+      reader.ReadElementText();
+      m_publicIp = reader.TakeText();
+      m_publicIpHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceNetworkInterfaceAssociation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_carrierIpHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceNetworkInterfaceAttachment.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -104,6 +105,59 @@ InstanceNetworkInterfaceAttachment& InstanceNetworkInterfaceAttachment::operator
   return *this;
 }
 
+void InstanceNetworkInterfaceAttachment::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "attachTime")
+    {
+      reader.ReadElementText();
+      m_attachTime = DateTime(reader.GetTrimmedText(), Aws::Utils::DateFormat::ISO_8601);
+      m_attachTimeHasBeenSet = true;
+    }
+    else if(name == "attachmentId")
+    {
+      reader.ReadElementText();
+      m_attachmentId = reader.TakeText();
+      m_attachmentIdHasBeenSet = true;
+    }
+    else if(name == "deleteOnTermination")
+    {
+      reader.ReadElementText();
+      m_deleteOnTermination = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_deleteOnTerminationHasBeenSet = true;
+    }
+    else if(name == "deviceIndex")
+    {
+      reader.ReadElementText();
+      m_deviceIndex = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_deviceIndexHasBeenSet = true;
+    }
+    else if(name == "status")
+    {
+      reader.ReadElementText();
+      m_status = AttachmentStatusMapper::GetAttachmentStatusForName(reader.GetTrimmedText());
+      m_statusHasBeenSet = true;
+    }
+    else if(name == "networkCardIndex")
+    {
+      reader.ReadElementText();
+      m_networkCardIndex = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_networkCardIndexHasBeenSet = true;
+    }
+    else if(name == "enaSrdSpecification")
+    {
+      m_enaSrdSpecification.DeserializeFrom(reader);
+      m_enaSrdSpecificationHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceNetworkInterfaceAttachment::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_attachTimeHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstancePrivateIpAddress.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -74,6 +75,41 @@ InstancePrivateIpAddress& InstancePrivateIpAddress::operator =(const XmlNode& xm
   return *this;
 }
 
+void InstancePrivateIpAddress::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "association")
+    {
+      m_association.DeserializeFrom(reader);
+      m_associationHasBeenSet = true;
+    }
+    else if(name == "primary")
+    {
+      reader.ReadElementText();
+      m_primary = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_primaryHasBeenSet = true;
+    }
+    else if(name == "privateDnsName")
+    {
+      reader.ReadElementText();
+      m_privateDnsName = reader.TakeText();
+      m_privateDnsNameHasBeenSet = true;
+    }
+    else if(name == "privateIpAddress")
+    {
+      reader.ReadElementText();
+      m_privateIpAddress = reader.TakeText();
+      m_privateIpAddressHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstancePrivateIpAddress::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_associationHasBeenSet)
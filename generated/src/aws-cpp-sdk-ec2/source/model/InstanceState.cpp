@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/InstanceState.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -60,6 +61,30 @@ InstanceState& InstanceState::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void InstanceState::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "code")
+    {
+      reader.ReadElementText();
+      m_code = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_codeHasBeenSet = true;
+    }
+    else if(name == "name")
+    {
+      reader.ReadElementText();
+      m_name = InstanceStateNameMapper::GetInstanceStateNameForName(reader.GetTrimmedText());
+      m_nameHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void InstanceState::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_codeHasBeenSet)
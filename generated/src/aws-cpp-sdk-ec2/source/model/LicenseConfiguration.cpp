@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/LicenseConfiguration.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -48,6 +49,24 @@ LicenseConfiguration& LicenseConfiguration::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void LicenseConfiguration::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "licenseConfigurationArn")
+    {
+      reader.ReadElementText();
+      m_licenseConfigurationArn = reader.TakeText();
+      m_licenseConfigurationArnHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void LicenseConfiguration::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_licenseConfigurationArnHasBeenSet)
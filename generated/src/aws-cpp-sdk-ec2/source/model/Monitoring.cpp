@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/Monitoring.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -50,6 +51,24 @@ Monitoring& Monitoring::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void Monitoring::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "state")
+    {
+      reader.ReadElementText();
+      m_state = MonitoringStateMapper::GetMonitoringStateForName(reader.GetTrimmedText());
+      m_stateHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void Monitoring::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_stateHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/Placement.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -116,6 +117,72 @@ Placement& Placement::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void Placement::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "availabilityZone")
+    {
+      reader.ReadElementText();
+      m_availabilityZone = reader.TakeText();
+      m_availabilityZoneHasBeenSet = true;
+    }
+    else if(name == "affinity")
+    {
+      reader.ReadElementText();
+      m_affinity = reader.TakeText();
+      m_affinityHasBeenSet = true;
+    }
+    else if(name == "groupName")
+    {
+      reader.ReadElementText();
+      m_groupName = reader.TakeText();
+      m_groupNameHasBeenSet = true;
+    }
+    else if(name == "partitionNumber")
+    {
+      reader.ReadElementText();
+      m_partitionNumber = StringUtils::ConvertToInt32(reader.GetTrimmedText().c_str());
+      m_partitionNumberHasBeenSet = true;
+    }
+    else if(name == "hostId")
+    {
+      reader.ReadElementText();
+      m_hostId = reader.TakeText();
+      m_hostIdHasBeenSet = true;
+    }
+    else if(name == "tenancy")
+    {
+      reader.ReadElementText();
+      m_tenancy = TenancyMapper::GetTenancyForName(reader.GetTrimmedText());
+      m_tenancyHasBeenSet = true;
+    }
+    else if(name == "spreadDomain")
+    {
+      reader.ReadElementText();
+      m_spreadDomain = reader.TakeText();
+      m_spreadDomainHasBeenSet = true;
+    }
+    else if(name == "hostResourceGroupArn")
+    {
+      reader.ReadElementText();
+      m_hostResourceGroupArn = reader.TakeText();
+      m_hostResourceGroupArnHasBeenSet = true;
+    }
+    else if(name == "groupId")
+    {
+      reader.ReadElementText();
+      m_groupId = reader.TakeText();
+      m_groupIdHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void Placement::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_availabilityZoneHasBeenSet)
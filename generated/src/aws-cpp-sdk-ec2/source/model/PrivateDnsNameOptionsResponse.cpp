@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/PrivateDnsNameOptionsResponse.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -70,6 +71,36 @@ PrivateDnsNameOptionsResponse& PrivateDnsNameOptionsResponse::operator =(const X
   return *this;
 }
 
+void PrivateDnsNameOptionsResponse::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "hostnameType")
+    {
+      reader.ReadElementText();
+      m_hostnameType = HostnameTypeMapper::GetHostnameTypeForName(reader.GetTrimmedText());
+      m_hostnameTypeHasBeenSet = true;
+    }
+    else if(name == "enableResourceNameDnsARecord")
+    {
+      reader.ReadElementText();
+      m_enableResourceNameDnsARecord = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enableResourceNameDnsARecordHasBeenSet = true;
+    }
+    else if(name == "enableResourceNameDnsAAAARecord")
+    {
+      reader.ReadElementText();
+      m_enableResourceNameDnsAAAARecord = StringUtils::ConvertToBool(reader.GetTrimmedText().c_str());
+      m_enableResourceNameDnsAAAARecordHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void PrivateDnsNameOptionsResponse::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_hostnameTypeHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/ProductCode.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,30 @@ ProductCode& ProductCode::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void ProductCode::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "productCode")
+    {
+      reader.ReadElementText();
+      m_productCodeId = reader.TakeText();
+      m_productCodeIdHasBeenSet = true;
+    }
+    else if(name == "type")
+    {
+      reader.ReadElementText();
+      m_productCodeType = ProductCodeValuesMapper::GetProductCodeValuesForName(reader.GetTrimmedText());
+      m_productCodeTypeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void ProductCode::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_productCodeIdHasBeenSet)
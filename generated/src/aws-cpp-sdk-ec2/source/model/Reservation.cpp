@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/Reservation.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -92,6 +93,68 @@ Reservation& Reservation::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void Reservation::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "groupSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_groups.emplace_back();
+          m_groups.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_groupsHasBeenSet = true;
+    }
+    else if(name == "instancesSet")
+    {
+      while(reader.NextChild())
+      {
+        if(reader.GetName() == "item")
+        {
+          m_instances.emplace_back();
+          m_instances.back().DeserializeFrom(reader);
+        }
+        else
+        {
+          reader.SkipElement();
+        }
+      }
+      m_instancesHasBeenSet = true;
+    }
+    else if(name == "ownerId")
+    {
+      reader.ReadElementText();
+      m_ownerId = reader.TakeText();
+      m_ownerIdHasBeenSet = true;
+    }
+    else if(name == "requesterId")
+    {
+      reader.ReadElementText();
+      m_requesterId = reader.TakeText();
+      m_requesterIdHasBeenSet = true;
+    }
+    else if(name == "reservationId")
+    {
+      reader.ReadElementText();
+      m_reservationId = reader.TakeText();
+      m_reservationIdHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void Reservation::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_groupsHasBeenSet)
@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/StateReason.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,30 @@ StateReason& StateReason::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void StateReason::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "code")
+    {
+      reader.ReadElementText();
+      m_code = reader.TakeText();
+      m_codeHasBeenSet = true;
+    }
+    else if(name == "message")
+    {
+      reader.ReadElementText();
+      m_message = reader.TakeText();
+      m_messageHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void StateReason::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_codeHasBeenSet)
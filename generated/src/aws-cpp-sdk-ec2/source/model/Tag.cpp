@@ -5,6 +5,7 @@
 
 #include <aws/ec2/model/Tag.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -56,6 +57,30 @@ Tag& Tag::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+void Tag::DeserializeFrom(XmlReader& reader)
+{
+  while(reader.NextChild())
+  {
+    const Aws::String& name = reader.GetName();
+    if(name == "key")
+    {
+      reader.ReadElementText();
+      m_key = reader.TakeText();
+      m_keyHasBeenSet = true;
+    }
+    else if(name == "value")
+    {
+      reader.ReadElementText();
+      m_value = reader.TakeText();
+      m_valueHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipElement();
+    }
+  }
+}
+
 void Tag::OutputToStream(Aws::OStream& oStream, const char* location, unsigned index, const char* locationValue) const
 {
   if(m_keyHasBeenSet)
@@ -0,0 +1,62 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+#include <aws/kinesis/Kinesis_EXPORTS.h>
+#include <aws/kinesis/KinesisRequest.h>
+#include <aws/core/AmazonSerializableWebServiceRequest.h>
+#include <aws/core/http/HttpRequest.h>
+
+namespace Aws
+{
+namespace Kinesis
+{
+  /**
+   * Sends a Kinesis request with its CBOR payload (application/x-amz-cbor-1.1) instead of JSON.
+   * Used by KinesisClient for the operations supporting it when ClientConfiguration::enableCborProtocol is set.
+   *
+   * Everything but the body and its content type is forwarded to the wrapped request, which must outlive this one.
+   */
+  class AWS_KINESIS_API KinesisCborRequest : public Aws::AmazonSerializableWebServiceRequest
+  {
+  public:
+    template<typename RequestT>
+    explicit KinesisCborRequest(const RequestT& request) :
+      m_request(request),
+      m_payload(request.SerializeCborPayload())
+    {
+    }
+
+    inline const char* GetServiceRequestName() const override { return m_request.GetServiceRequestName(); }
+
+    inline Aws::String SerializePayload() const override { return m_payload; }
+
+    inline Aws::Http::HeaderValueCollection GetHeaders() const override
+    {
+      auto headers = m_request.GetHeaders();
+      headers[Aws::Http::CONTENT_TYPE_HEADER] = Aws::AMZN_CBOR_CONTENT_TYPE_1_1;
+      headers[Aws::Http::ACCEPT_HEADER] = Aws::AMZN_CBOR_CONTENT_TYPE_1_1;
+      return headers;
+    }
+
+    inline EndpointParameters GetEndpointContextParams() const override { return m_request.GetEndpointContextParams(); }
+    inline void AddQueryStringParameters(Aws::Http::URI& uri) const override { m_request.AddQueryStringParameters(uri); }
+    inline const Aws::Http::HeaderValueCollection& GetAdditionalCustomHeaders() const override { return m_request.GetAdditionalCustomHeaders(); }
+    inline const Aws::RequestSignedHandler& GetRequestSignedHandler() const override { return m_request.GetRequestSignedHandler(); }
+    inline const Aws::Http::DataReceivedEventHandler& GetDataReceivedEventHandler() const override { return m_request.GetDataReceivedEventHandler(); }
+    inline const Aws::Http::DataSentEventHandler& GetDataSentEventHandler() const override { return m_request.GetDataSentEventHandler(); }
+    inline const Aws::Http::ContinueRequestHandler& GetContinueRequestHandler() const override { return m_request.GetContinueRequestHandler(); }
+    inline const Aws::RequestRetryHandler& GetRequestRetryHandler() const override { return m_request.GetRequestRetryHandler(); }
+    inline bool ShouldComputeContentMd5() const override { return m_request.ShouldComputeContentMd5(); }
+    inline Aws::String GetChecksumAlgorithmName() const override { return m_request.GetChecksumAlgorithmName(); }
+    inline std::shared_ptr<Aws::Http::ServiceSpecificParameters> GetServiceSpecificParameters() const override { return m_request.GetServiceSpecificParameters(); }
+
+  private:
+    const KinesisRequest& m_request;
+    const Aws::String m_payload;
+  };
+
+} // namespace Kinesis
+} // namespace Aws
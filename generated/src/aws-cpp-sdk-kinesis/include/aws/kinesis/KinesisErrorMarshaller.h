@@ -16,6 +16,10 @@ namespace Client
 class AWS_KINESIS_API KinesisErrorMarshaller : public Aws::Client::JsonErrorMarshaller
 {
 public:
+  /**
+   * Reads CBOR error bodies (application/x-amz-cbor-1.1) sent in reply to CBOR requests, JSON ones otherwise.
+   */
+  Aws::Client::AWSError<Aws::Client::CoreErrors> Marshall(const Aws::Http::HttpResponse& response) const override;
   Aws::Client::AWSError<Aws::Client::CoreErrors> FindErrorByName(const char* exceptionName) const override;
 };
 
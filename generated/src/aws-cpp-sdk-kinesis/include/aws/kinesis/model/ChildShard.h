@@ -19,6 +19,10 @@ namespace Json
   class JsonValue;
   class JsonView;
 } // namespace Json
+namespace Cbor
+{
+  class CborReader;
+} // namespace Cbor
 } // namespace Utils
 namespace Kinesis
 {
@@ -38,6 +42,7 @@ namespace Model
     AWS_KINESIS_API ChildShard(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API ChildShard& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_KINESIS_API void DeserializeFrom(Aws::Utils::Cbor::CborReader& reader);
 
 
     /**
@@ -36,6 +36,11 @@ namespace Model
 
     AWS_KINESIS_API Aws::String SerializePayload() const override;
 
+    /**
+     * Serializes the payload as CBOR, sent instead of SerializePayload() when ClientConfiguration::enableCborProtocol is set.
+     */
+    AWS_KINESIS_API Aws::String SerializeCborPayload() const;
+
     AWS_KINESIS_API Aws::Http::HeaderValueCollection GetRequestSpecificHeaders() const override;
 
     /**
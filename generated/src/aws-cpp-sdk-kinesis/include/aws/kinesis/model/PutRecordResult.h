@@ -20,6 +20,10 @@ namespace Json
 {
   class JsonValue;
 } // namespace Json
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace Kinesis
 {
@@ -37,6 +41,17 @@ namespace Model
     AWS_KINESIS_API PutRecordResult();
     AWS_KINESIS_API PutRecordResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     AWS_KINESIS_API PutRecordResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    /**
+     * Reads the result from a CBOR encoded response body with Aws::Utils::Cbor::CborReader, see ClientConfiguration::enableCborProtocol.
+     */
+    AWS_KINESIS_API PutRecordResult(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    AWS_KINESIS_API PutRecordResult& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    /**
+     * False when the response body read from the ResponseStream was malformed or truncated, the client then returns
+     * an error instead of this partial result.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -208,6 +223,8 @@ namespace Model
     EncryptionType m_encryptionType;
 
     Aws::String m_requestId;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
@@ -18,6 +18,10 @@ namespace Json
   class JsonValue;
   class JsonView;
 } // namespace Json
+namespace Cbor
+{
+  class CborWriter;
+} // namespace Cbor
 } // namespace Utils
 namespace Kinesis
 {
@@ -37,6 +41,7 @@ namespace Model
     AWS_KINESIS_API PutRecordsRequestEntry(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API PutRecordsRequestEntry& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_KINESIS_API void SerializeTo(Aws::Utils::Cbor::CborWriter& writer) const;
 
 
     /**
@@ -17,6 +17,10 @@ namespace Json
   class JsonValue;
   class JsonView;
 } // namespace Json
+namespace Cbor
+{
+  class CborReader;
+} // namespace Cbor
 } // namespace Utils
 namespace Kinesis
 {
@@ -39,6 +43,7 @@ namespace Model
     AWS_KINESIS_API PutRecordsResultEntry(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API PutRecordsResultEntry& operator=(Aws::Utils::Json::JsonView jsonValue);
     AWS_KINESIS_API Aws::Utils::Json::JsonValue Jsonize() const;
+    AWS_KINESIS_API void DeserializeFrom(Aws::Utils::Cbor::CborReader& reader);
 
 
     /**
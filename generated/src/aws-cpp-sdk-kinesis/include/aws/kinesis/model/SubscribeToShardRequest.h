@@ -8,6 +8,7 @@
 #include <aws/kinesis/KinesisRequest.h>
 #include <aws/kinesis/model/SubscribeToShardHandler.h>
 #include <aws/core/utils/event/EventStreamDecoder.h>
+#include <aws/core/utils/event/EventStreamDeliveryQueue.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/kinesis/model/StartingPosition.h>
 #include <utility>
@@ -49,13 +50,39 @@ namespace Model
     /**
      * Underlying Event Stream Handler which is used to define callback functions.
      */
-    inline void SetEventStreamHandler(const SubscribeToShardHandler& value) { m_handler = value; m_decoder.ResetEventStreamHandler(&m_handler); }
+    inline void SetEventStreamHandler(const SubscribeToShardHandler& value) { m_handler = value; m_decoder.ResetEventStreamHandler(GetDecodedEventsHandler()); }
 
     /**
      * Underlying Event Stream Handler which is used to define callback functions.
      */
     inline SubscribeToShardRequest& WithEventStreamHandler(const SubscribeToShardHandler& value) { SetEventStreamHandler(value); return *this; }
 
+    /**
+     * Delivers the events to the Event Stream Handler on executor instead of the thread reading the response,
+     * through a queue of at most capacity events. Reading the response is paused while the queue is full.
+     * The thread reading the response then waits for the deliveries queued to executor, so executor must be dedicated to them:
+     * leave it null for a thread of the queue's own. SubscribeToShard fails with INVALID_PARAMETER_COMBINATION when it is
+     * the executor of the client, which may be running the request itself.
+     * If meter is set, the queue depth and event lag are reported as its gauges.
+     */
+    AWS_KINESIS_API void EnableEventStreamDeliveryQueue(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor = nullptr,
+        size_t capacity = Aws::Utils::Event::DEFAULT_EVENT_QUEUE_CAPACITY,
+        const std::shared_ptr<smithy::components::tracing::Meter>& meter = nullptr);
+
+    /**
+     * Blocks until the events received so far are delivered to the Event Stream Handler.
+     * Returns immediately if EnableEventStreamDeliveryQueue() was not called.
+     */
+    inline void WaitForEventStreamDelivery() { if (m_deliveryQueue) m_deliveryQueue->WaitUntilDrained(); }
+
+    /**
+     * True if the events are delivered on executor, see EnableEventStreamDeliveryQueue().
+     */
+    inline bool DeliversEventStreamOn(const Aws::Utils::Threading::Executor* executor) const
+    {
+      return executor && m_deliveryQueue && m_deliveryQueue->GetExecutor().get() == executor;
+    }
+
     /**
      * Helper function to collect parameters (configurable and static hardcoded) required for endpoint computation.
      */
@@ -199,7 +226,13 @@ namespace Model
 
     StartingPosition m_startingPosition;
     bool m_startingPositionHasBeenSet = false;
+    inline Aws::Utils::Event::EventStreamHandler* GetDecodedEventsHandler()
+    {
+      return m_deliveryQueue ? static_cast<Aws::Utils::Event::EventStreamHandler*>(m_deliveryQueue.get()) : &m_handler;
+    }
+
     SubscribeToShardHandler m_handler;
+    std::shared_ptr<Aws::Utils::Event::EventStreamDeliveryQueue> m_deliveryQueue;
     Aws::Utils::Event::EventStreamDecoder m_decoder;
 
   };
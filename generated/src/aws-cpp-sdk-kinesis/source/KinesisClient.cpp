@@ -21,6 +21,7 @@
 
 #include <aws/kinesis/KinesisClient.h>
 #include <aws/kinesis/KinesisErrorMarshaller.h>
+#include <aws/kinesis/KinesisCborRequest.h>
 #include <aws/kinesis/KinesisEndpointProvider.h>
 #include <aws/kinesis/model/AddTagsToStreamRequest.h>
 #include <aws/kinesis/model/CreateStreamRequest.h>
@@ -526,6 +527,20 @@ GetRecordsOutcome KinesisClient::GetRecords(const GetRecordsRequest& request) co
           *meter,
           {{TracingUtils::SMITHY_METHOD_DIMENSION, request.GetServiceRequestName()}, {TracingUtils::SMITHY_SERVICE_DIMENSION, this->GetServiceClientName()}});
       AWS_OPERATION_CHECK_SUCCESS(endpointResolutionOutcome, GetRecords, CoreErrors, CoreErrors::ENDPOINT_RESOLUTION_FAILURE, endpointResolutionOutcome.GetError().GetMessage());
+      if (m_clientConfiguration.enableCborProtocol)
+      {
+        auto outcome = MakeRequestWithUnparsedResponse(KinesisCborRequest(request), endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+        if (!outcome.IsSuccess())
+        {
+          return GetRecordsOutcome(outcome.GetError());
+        }
+        GetRecordsResult result(outcome.GetResultWithOwnership());
+        if (!result.WasParseSuccessful())
+        {
+          return GetRecordsOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false));
+        }
+        return GetRecordsOutcome(std::move(result));
+      }
       return GetRecordsOutcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
     },
     TracingUtils::SMITHY_CLIENT_DURATION_METRIC,
@@ -760,6 +775,20 @@ PutRecordOutcome KinesisClient::PutRecord(const PutRecordRequest& request) const
           *meter,
           {{TracingUtils::SMITHY_METHOD_DIMENSION, request.GetServiceRequestName()}, {TracingUtils::SMITHY_SERVICE_DIMENSION, this->GetServiceClientName()}});
       AWS_OPERATION_CHECK_SUCCESS(endpointResolutionOutcome, PutRecord, CoreErrors, CoreErrors::ENDPOINT_RESOLUTION_FAILURE, endpointResolutionOutcome.GetError().GetMessage());
+      if (m_clientConfiguration.enableCborProtocol)
+      {
+        auto outcome = MakeRequestWithUnparsedResponse(KinesisCborRequest(request), endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+        if (!outcome.IsSuccess())
+        {
+          return PutRecordOutcome(outcome.GetError());
+        }
+        PutRecordResult result(outcome.GetResultWithOwnership());
+        if (!result.WasParseSuccessful())
+        {
+          return PutRecordOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false));
+        }
+        return PutRecordOutcome(std::move(result));
+      }
       return PutRecordOutcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
     },
     TracingUtils::SMITHY_CLIENT_DURATION_METRIC,
@@ -786,6 +815,20 @@ PutRecordsOutcome KinesisClient::PutRecords(const PutRecordsRequest& request) co
           *meter,
           {{TracingUtils::SMITHY_METHOD_DIMENSION, request.GetServiceRequestName()}, {TracingUtils::SMITHY_SERVICE_DIMENSION, this->GetServiceClientName()}});
       AWS_OPERATION_CHECK_SUCCESS(endpointResolutionOutcome, PutRecords, CoreErrors, CoreErrors::ENDPOINT_RESOLUTION_FAILURE, endpointResolutionOutcome.GetError().GetMessage());
+      if (m_clientConfiguration.enableCborProtocol)
+      {
+        auto outcome = MakeRequestWithUnparsedResponse(KinesisCborRequest(request), endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+        if (!outcome.IsSuccess())
+        {
+          return PutRecordsOutcome(outcome.GetError());
+        }
+        PutRecordsResult result(outcome.GetResultWithOwnership());
+        if (!result.WasParseSuccessful())
+        {
+          return PutRecordsOutcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false));
+        }
+        return PutRecordsOutcome(std::move(result));
+      }
       return PutRecordsOutcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER));
     },
     TracingUtils::SMITHY_CLIENT_DURATION_METRIC,
@@ -957,6 +1000,12 @@ SubscribeToShardOutcome KinesisClient::SubscribeToShard(SubscribeToShardRequest&
   auto tracer = m_telemetryProvider->getTracer(this->GetServiceClientName(), {});
   auto meter = m_telemetryProvider->getMeter(this->GetServiceClientName(), {});
   AWS_OPERATION_CHECK_PTR(meter, SubscribeToShard, CoreErrors, CoreErrors::NOT_INITIALIZED);
+  if (request.DeliversEventStreamOn(m_executor.get()))
+  {
+    AWS_LOGSTREAM_ERROR("SubscribeToShard", "The event stream delivery queue must not use the executor of the client");
+    return SubscribeToShardOutcome(Aws::Client::AWSError<CoreErrors>(CoreErrors::INVALID_PARAMETER_COMBINATION, "INVALID_PARAMETER_COMBINATION",
+        "The event stream delivery queue must not use the executor of the client, which may be running the request", false));
+  }
   auto span = tracer->CreateSpan(Aws::String(this->GetServiceClientName()) + ".SubscribeToShard",
     {{ TracingUtils::SMITHY_METHOD_DIMENSION, request.GetServiceRequestName() }, { TracingUtils::SMITHY_SERVICE_DIMENSION, this->GetServiceClientName() }, { TracingUtils::SMITHY_SYSTEM_DIMENSION, TracingUtils::SMITHY_METHOD_AWS_VALUE }},
     smithy::components::tracing::SpanKind::CLIENT);
@@ -971,7 +1020,9 @@ SubscribeToShardOutcome KinesisClient::SubscribeToShard(SubscribeToShardRequest&
       request.SetResponseStreamFactory(
           [&] { request.GetEventStreamDecoder().Reset(); return Aws::New<Aws::Utils::Event::EventDecoderStream>(ALLOCATION_TAG, request.GetEventStreamDecoder()); }
       );
-      return SubscribeToShardOutcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST));
+      SubscribeToShardOutcome outcome(MakeRequest(request, endpointResolutionOutcome.GetResult(), Aws::Http::HttpMethod::HTTP_POST));
+      request.WaitForEventStreamDelivery();
+      return outcome;
     },
     TracingUtils::SMITHY_CLIENT_DURATION_METRIC,
     *meter,
@@ -4,11 +4,61 @@
  */
 
 #include <aws/core/client/AWSError.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/cbor/CborReader.h>
 #include <aws/kinesis/KinesisErrorMarshaller.h>
 #include <aws/kinesis/KinesisErrors.h>
 
 using namespace Aws::Client;
 using namespace Aws::Kinesis;
+using namespace Aws::Utils::Cbor;
+
+static const char CBOR_CONTENT_TYPE_PREFIX[] = "application/x-amz-cbor";
+static const char ERROR_TYPE_HEADER[] = "x-amzn-ErrorType";
+
+AWSError<CoreErrors> KinesisErrorMarshaller::Marshall(const Aws::Http::HttpResponse& response) const
+{
+  if(!response.HasHeader(Aws::Http::CONTENT_TYPE_HEADER) ||
+      response.GetContentType().compare(0, sizeof(CBOR_CONTENT_TYPE_PREFIX) - 1, CBOR_CONTENT_TYPE_PREFIX) != 0)
+  {
+    return JsonErrorMarshaller::Marshall(response);
+  }
+
+  Aws::String type;
+  Aws::String message;
+  CborReader reader(response.GetResponseBody());
+  if(reader.Next() == CborToken::StartMap)
+  {
+    while(reader.NextMember())
+    {
+      const Aws::String memberName = reader.TakeString();
+      if(reader.Next() == CborToken::String && memberName == "__type")
+      {
+        type = reader.TakeString();
+      }
+      else if(reader.GetToken() == CborToken::String && (memberName == "message" || memberName == "Message"))
+      {
+        message = reader.TakeString();
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+  }
+
+  if(type.empty() && response.HasHeader(ERROR_TYPE_HEADER))
+  {
+    type = response.GetHeader(ERROR_TYPE_HEADER);
+  }
+  if(type.empty())
+  {
+    AWSError<CoreErrors> error = FindErrorByHttpResponseCode(response.GetResponseCode());
+    error.SetMessage(message);
+    return error;
+  }
+  return AWSErrorMarshaller::Marshall(type, message);
+}
 
 AWSError<CoreErrors> KinesisErrorMarshaller::FindErrorByName(const char* errorName) const
 {
@@ -5,11 +5,13 @@
 
 #include <aws/kinesis/model/ChildShard.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 
 #include <utility>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 namespace Aws
 {
@@ -92,6 +94,43 @@ JsonValue ChildShard::Jsonize() const
   return payload;
 }
 
+void ChildShard::DeserializeFrom(CborReader& reader)
+{
+  if(reader.GetToken() != CborToken::StartMap)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    const CborToken token = reader.Next();
+    if(memberName == "ShardId")
+    {
+      m_shardId = reader.TakeString();
+      m_shardIdHasBeenSet = true;
+    }
+    else if(memberName == "ParentShards" && token == CborToken::StartArray)
+    {
+      while(reader.NextElement())
+      {
+        m_parentShards.push_back(reader.TakeString());
+      }
+      m_parentShardsHasBeenSet = true;
+    }
+    else if(memberName == "HashKeyRange")
+    {
+      m_hashKeyRange.DeserializeFrom(reader);
+      m_hashKeyRangeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
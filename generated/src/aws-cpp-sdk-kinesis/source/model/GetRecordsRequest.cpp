@@ -5,12 +5,14 @@
 
 #include <aws/kinesis/model/GetRecordsRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborWriter.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 GetRecordsRequest::GetRecordsRequest() : 
     m_shardIteratorHasBeenSet(false),
@@ -45,6 +47,31 @@ Aws::String GetRecordsRequest::SerializePayload() const
   return payload.View().WriteReadable();
 }
 
+Aws::String GetRecordsRequest::SerializeCborPayload() const
+{
+  Aws::String payload;
+  CborWriter writer(payload);
+  writer.StartMap();
+
+  if(m_shardIteratorHasBeenSet)
+  {
+   writer.WithString("ShardIterator", m_shardIterator);
+  }
+
+  if(m_limitHasBeenSet)
+  {
+   writer.WithInteger("Limit", m_limit);
+  }
+
+  if(m_streamARNHasBeenSet)
+  {
+   writer.WithString("StreamARN", m_streamARN);
+  }
+
+  writer.EndMap();
+  return payload;
+}
+
 Aws::Http::HeaderValueCollection GetRecordsRequest::GetRequestSpecificHeaders() const
 {
   Aws::Http::HeaderValueCollection headers;
@@ -5,16 +5,19 @@
 
 #include <aws/kinesis/model/GetRecordsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 using namespace Aws;
 
 GetRecordsResult::GetRecordsResult() : 
@@ -28,6 +31,12 @@ GetRecordsResult::GetRecordsResult(const Aws::AmazonWebServiceResult<JsonValue>&
   *this = result;
 }
 
+GetRecordsResult::GetRecordsResult(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result) : 
+    m_millisBehindLatest(0)
+{
+  *this = std::move(result);
+}
+
 GetRecordsResult& GetRecordsResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>& result)
 {
   JsonView jsonValue = result.GetPayload().View();
@@ -70,5 +79,63 @@ GetRecordsResult& GetRecordsResult::operator =(const Aws::AmazonWebServiceResult
   }
 
 
+  return *this;
+}
+
+GetRecordsResult& GetRecordsResult::operator =(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  CborReader reader(result.GetPayload().GetUnderlyingStream());
+  if(reader.Next() == CborToken::StartMap)
+  {
+    while(reader.NextMember())
+    {
+      const Aws::String memberName = reader.TakeString();
+      const CborToken token = reader.Next();
+      if(memberName == "Records" && token == CborToken::StartArray)
+      {
+        while(reader.NextElement())
+        {
+          Record record;
+          record.DeserializeFrom(reader);
+          m_records.push_back(std::move(record));
+        }
+      }
+      else if(memberName == "NextShardIterator")
+      {
+        m_nextShardIterator = reader.TakeString();
+      }
+      else if(memberName == "MillisBehindLatest")
+      {
+        m_millisBehindLatest = reader.GetInt64();
+      }
+      else if(memberName == "ChildShards" && token == CborToken::StartArray)
+      {
+        while(reader.NextElement())
+        {
+          ChildShard childShard;
+          childShard.DeserializeFrom(reader);
+          m_childShards.push_back(std::move(childShard));
+        }
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+  }
+
+  if(!reader.WasParseSuccessful())
+  {
+    m_parseErrorMessage = reader.GetErrorMessage();
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestIdIter = headers.find("x-amzn-requestid");
+  if(requestIdIter != headers.end())
+  {
+    m_requestId = requestIdIter->second;
+  }
+
+
   return *this;
 }
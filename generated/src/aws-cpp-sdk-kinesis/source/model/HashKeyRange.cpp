@@ -5,11 +5,13 @@
 
 #include <aws/kinesis/model/HashKeyRange.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 
 #include <utility>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 namespace Aws
 {
@@ -69,6 +71,35 @@ JsonValue HashKeyRange::Jsonize() const
   return payload;
 }
 
+void HashKeyRange::DeserializeFrom(CborReader& reader)
+{
+  if(reader.GetToken() != CborToken::StartMap)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    reader.Next();
+    if(memberName == "StartingHashKey")
+    {
+      m_startingHashKey = reader.TakeString();
+      m_startingHashKeyHasBeenSet = true;
+    }
+    else if(memberName == "EndingHashKey")
+    {
+      m_endingHashKey = reader.TakeString();
+      m_endingHashKeyHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
@@ -6,12 +6,14 @@
 #include <aws/kinesis/model/PutRecordRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/cbor/CborWriter.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 PutRecordRequest::PutRecordRequest() : 
     m_streamNameHasBeenSet(false),
@@ -65,6 +67,48 @@ Aws::String PutRecordRequest::SerializePayload() const
   return payload.View().WriteReadable();
 }
 
+Aws::String PutRecordRequest::SerializeCborPayload() const
+{
+  Aws::String payload;
+  payload.reserve(64 + m_streamName.size() + m_data.GetLength() + m_partitionKey.size() + m_explicitHashKey.size() +
+                  m_sequenceNumberForOrdering.size() + m_streamARN.size());
+  CborWriter writer(payload);
+  writer.StartMap();
+
+  if(m_streamNameHasBeenSet)
+  {
+   writer.WithString("StreamName", m_streamName);
+  }
+
+  if(m_dataHasBeenSet)
+  {
+   writer.WithBytes("Data", m_data);
+  }
+
+  if(m_partitionKeyHasBeenSet)
+  {
+   writer.WithString("PartitionKey", m_partitionKey);
+  }
+
+  if(m_explicitHashKeyHasBeenSet)
+  {
+   writer.WithString("ExplicitHashKey", m_explicitHashKey);
+  }
+
+  if(m_sequenceNumberForOrderingHasBeenSet)
+  {
+   writer.WithString("SequenceNumberForOrdering", m_sequenceNumberForOrdering);
+  }
+
+  if(m_streamARNHasBeenSet)
+  {
+   writer.WithString("StreamARN", m_streamARN);
+  }
+
+  writer.EndMap();
+  return payload;
+}
+
 Aws::Http::HeaderValueCollection PutRecordRequest::GetRequestSpecificHeaders() const
 {
   Aws::Http::HeaderValueCollection headers;
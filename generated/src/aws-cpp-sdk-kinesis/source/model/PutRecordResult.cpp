@@ -5,16 +5,19 @@
 
 #include <aws/kinesis/model/PutRecordResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 using namespace Aws;
 
 PutRecordResult::PutRecordResult() : 
@@ -28,6 +31,12 @@ PutRecordResult::PutRecordResult(const Aws::AmazonWebServiceResult<JsonValue>& r
   *this = result;
 }
 
+PutRecordResult::PutRecordResult(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result) : 
+    m_encryptionType(EncryptionType::NOT_SET)
+{
+  *this = std::move(result);
+}
+
 PutRecordResult& PutRecordResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>& result)
 {
   JsonView jsonValue = result.GetPayload().View();
@@ -58,5 +67,49 @@ PutRecordResult& PutRecordResult::operator =(const Aws::AmazonWebServiceResult<J
   }
 
 
+  return *this;
+}
+
+PutRecordResult& PutRecordResult::operator =(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  CborReader reader(result.GetPayload().GetUnderlyingStream());
+  if(reader.Next() == CborToken::StartMap)
+  {
+    while(reader.NextMember())
+    {
+      const Aws::String memberName = reader.TakeString();
+      reader.Next();
+      if(memberName == "ShardId")
+      {
+        m_shardId = reader.TakeString();
+      }
+      else if(memberName == "SequenceNumber")
+      {
+        m_sequenceNumber = reader.TakeString();
+      }
+      else if(memberName == "EncryptionType")
+      {
+        m_encryptionType = EncryptionTypeMapper::GetEncryptionTypeForName(reader.GetString());
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+  }
+
+  if(!reader.WasParseSuccessful())
+  {
+    m_parseErrorMessage = reader.GetErrorMessage();
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestIdIter = headers.find("x-amzn-requestid");
+  if(requestIdIter != headers.end())
+  {
+    m_requestId = requestIdIter->second;
+  }
+
+
   return *this;
 }
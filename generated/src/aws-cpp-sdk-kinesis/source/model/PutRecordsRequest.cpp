@@ -5,12 +5,14 @@
 
 #include <aws/kinesis/model/PutRecordsRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborWriter.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 PutRecordsRequest::PutRecordsRequest() : 
     m_recordsHasBeenSet(false),
@@ -49,6 +51,42 @@ Aws::String PutRecordsRequest::SerializePayload() const
   return payload.View().WriteReadable();
 }
 
+Aws::String PutRecordsRequest::SerializeCborPayload() const
+{
+  // record data is written as is, size the buffer once for all of it
+  size_t payloadSize = 64 + m_streamName.size() + m_streamARN.size();
+  for(const auto& record : m_records)
+  {
+    payloadSize += 32 + record.GetData().GetLength() + record.GetPartitionKey().size() + record.GetExplicitHashKey().size();
+  }
+  Aws::String payload;
+  payload.reserve(payloadSize);
+  CborWriter writer(payload);
+  writer.StartMap();
+
+  if(m_recordsHasBeenSet)
+  {
+   writer.Key("Records").StartArray(m_records.size());
+   for(const auto& record : m_records)
+   {
+     record.SerializeTo(writer);
+   }
+  }
+
+  if(m_streamNameHasBeenSet)
+  {
+   writer.WithString("StreamName", m_streamName);
+  }
+
+  if(m_streamARNHasBeenSet)
+  {
+   writer.WithString("StreamARN", m_streamARN);
+  }
+
+  writer.EndMap();
+  return payload;
+}
+
 Aws::Http::HeaderValueCollection PutRecordsRequest::GetRequestSpecificHeaders() const
 {
   Aws::Http::HeaderValueCollection headers;
@@ -6,11 +6,13 @@
 #include <aws/kinesis/model/PutRecordsRequestEntry.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/cbor/CborWriter.h>
 
 #include <utility>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 namespace Aws
 {
@@ -83,6 +85,28 @@ JsonValue PutRecordsRequestEntry::Jsonize() const
   return payload;
 }
 
+void PutRecordsRequestEntry::SerializeTo(CborWriter& writer) const
+{
+  writer.StartMap();
+
+  if(m_dataHasBeenSet)
+  {
+   writer.WithBytes("Data", m_data);
+  }
+
+  if(m_explicitHashKeyHasBeenSet)
+  {
+   writer.WithString("ExplicitHashKey", m_explicitHashKey);
+  }
+
+  if(m_partitionKeyHasBeenSet)
+  {
+   writer.WithString("PartitionKey", m_partitionKey);
+  }
+
+  writer.EndMap();
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
@@ -5,16 +5,19 @@
 
 #include <aws/kinesis/model/PutRecordsResult.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::Kinesis::Model;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 using namespace Aws;
 
 PutRecordsResult::PutRecordsResult() : 
@@ -30,6 +33,13 @@ PutRecordsResult::PutRecordsResult(const Aws::AmazonWebServiceResult<JsonValue>&
   *this = result;
 }
 
+PutRecordsResult::PutRecordsResult(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result) : 
+    m_failedRecordCount(0),
+    m_encryptionType(EncryptionType::NOT_SET)
+{
+  *this = std::move(result);
+}
+
 PutRecordsResult& PutRecordsResult::operator =(const Aws::AmazonWebServiceResult<JsonValue>& result)
 {
   JsonView jsonValue = result.GetPayload().View();
@@ -63,5 +73,54 @@ PutRecordsResult& PutRecordsResult::operator =(const Aws::AmazonWebServiceResult
   }
 
 
+  return *this;
+}
+
+PutRecordsResult& PutRecordsResult::operator =(Aws::AmazonWebServiceResult<Stream::ResponseStream>&& result)
+{
+  CborReader reader(result.GetPayload().GetUnderlyingStream());
+  if(reader.Next() == CborToken::StartMap)
+  {
+    while(reader.NextMember())
+    {
+      const Aws::String memberName = reader.TakeString();
+      const CborToken token = reader.Next();
+      if(memberName == "FailedRecordCount")
+      {
+        m_failedRecordCount = reader.GetInteger();
+      }
+      else if(memberName == "Records" && token == CborToken::StartArray)
+      {
+        while(reader.NextElement())
+        {
+          PutRecordsResultEntry record;
+          record.DeserializeFrom(reader);
+          m_records.push_back(std::move(record));
+        }
+      }
+      else if(memberName == "EncryptionType")
+      {
+        m_encryptionType = EncryptionTypeMapper::GetEncryptionTypeForName(reader.GetString());
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+  }
+
+  if(!reader.WasParseSuccessful())
+  {
+    m_parseErrorMessage = reader.GetErrorMessage();
+  }
+
+  const auto& headers = result.GetHeaderValueCollection();
+  const auto& requestIdIter = headers.find("x-amzn-requestid");
+  if(requestIdIter != headers.end())
+  {
+    m_requestId = requestIdIter->second;
+  }
+
+
   return *this;
 }
@@ -5,11 +5,13 @@
 
 #include <aws/kinesis/model/PutRecordsResultEntry.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/cbor/CborReader.h>
 
 #include <utility>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 namespace Aws
 {
@@ -99,6 +101,45 @@ JsonValue PutRecordsResultEntry::Jsonize() const
   return payload;
 }
 
+void PutRecordsResultEntry::DeserializeFrom(CborReader& reader)
+{
+  if(reader.GetToken() != CborToken::StartMap)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    reader.Next();
+    if(memberName == "SequenceNumber")
+    {
+      m_sequenceNumber = reader.TakeString();
+      m_sequenceNumberHasBeenSet = true;
+    }
+    else if(memberName == "ShardId")
+    {
+      m_shardId = reader.TakeString();
+      m_shardIdHasBeenSet = true;
+    }
+    else if(memberName == "ErrorCode")
+    {
+      m_errorCode = reader.TakeString();
+      m_errorCodeHasBeenSet = true;
+    }
+    else if(memberName == "ErrorMessage")
+    {
+      m_errorMessage = reader.TakeString();
+      m_errorMessageHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
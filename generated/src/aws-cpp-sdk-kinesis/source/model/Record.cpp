@@ -6,11 +6,13 @@
 #include <aws/kinesis/model/Record.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/cbor/CborReader.h>
 
 #include <utility>
 
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
 
 namespace Aws
 {
@@ -113,6 +115,58 @@ JsonValue Record::Jsonize() const
   return payload;
 }
 
+void Record::DeserializeFrom(CborReader& reader)
+{
+  if(reader.GetToken() != CborToken::StartMap)
+  {
+    reader.SkipValue();
+    return;
+  }
+
+  while(reader.NextMember())
+  {
+    const Aws::String memberName = reader.TakeString();
+    reader.Next();
+    if(memberName == "SequenceNumber")
+    {
+      m_sequenceNumber = reader.TakeString();
+      m_sequenceNumberHasBeenSet = true;
+    }
+    else if(memberName == "ApproximateArrivalTimestamp")
+    {
+      // epoch-based date/time (tag 1), sent in milliseconds
+      if((reader.GetToken() == CborToken::Integer || reader.GetToken() == CborToken::Float) && reader.GetTag() == 1)
+      {
+        m_approximateArrivalTimestamp = Aws::Utils::DateTime(static_cast<int64_t>(reader.GetInt64()));
+        m_approximateArrivalTimestampHasBeenSet = true;
+      }
+      else
+      {
+        reader.SkipValue();
+      }
+    }
+    else if(memberName == "Data")
+    {
+      m_data = reader.GetBytes();
+      m_dataHasBeenSet = true;
+    }
+    else if(memberName == "PartitionKey")
+    {
+      m_partitionKey = reader.TakeString();
+      m_partitionKeyHasBeenSet = true;
+    }
+    else if(memberName == "EncryptionType")
+    {
+      m_encryptionType = EncryptionTypeMapper::GetEncryptionTypeForName(reader.GetString());
+      m_encryptionTypeHasBeenSet = true;
+    }
+    else
+    {
+      reader.SkipValue();
+    }
+  }
+}
+
 } // namespace Model
 } // namespace Kinesis
 } // namespace Aws
@@ -29,6 +29,8 @@ namespace Model
 
     SubscribeToShardHandler::SubscribeToShardHandler() : EventStreamHandler()
     {
+        SetPayloadBorrowing(true);
+
         m_onInitialResponse = [&](const SubscribeToShardInitialResponse&)
         {
             AWS_LOGSTREAM_TRACE(SUBSCRIBETOSHARD_HANDLER_CLASS_TAG,
@@ -57,15 +59,14 @@ namespace Model
             return;
         }
 
-        const auto& headers = GetEventHeaders();
-        auto messageTypeHeaderIter = headers.find(MESSAGE_TYPE_HEADER);
-        if (messageTypeHeaderIter == headers.end())
+        const EventHeaderValue* messageTypeHeader = GetKnownHeader(Aws::Utils::Event::Message::KnownHeader::MESSAGE_TYPE);
+        if (!messageTypeHeader)
         {
             AWS_LOGSTREAM_WARN(SUBSCRIBETOSHARD_HANDLER_CLASS_TAG, "Header: " << MESSAGE_TYPE_HEADER << " not found in the message.");
             return;
         }
 
-        switch (Aws::Utils::Event::Message::GetMessageTypeForName(messageTypeHeaderIter->second.GetEventHeaderValueAsString()))
+        switch (GetMessageType())
         {
         case Aws::Utils::Event::Message::MessageType::EVENT:
             HandleEventInMessage();
@@ -78,21 +79,20 @@ namespace Model
         }
         default:
             AWS_LOGSTREAM_WARN(SUBSCRIBETOSHARD_HANDLER_CLASS_TAG,
-                "Unexpected message type: " << messageTypeHeaderIter->second.GetEventHeaderValueAsString());
+                "Unexpected message type: " << messageTypeHeader->GetEventHeaderValueAsString());
             break;
         }
     }
 
     void SubscribeToShardHandler::HandleEventInMessage()
     {
-        const auto& headers = GetEventHeaders();
-        auto eventTypeHeaderIter = headers.find(EVENT_TYPE_HEADER);
-        if (eventTypeHeaderIter == headers.end())
+        const EventHeaderValue* eventTypeHeader = GetKnownHeader(Aws::Utils::Event::Message::KnownHeader::EVENT_TYPE);
+        if (!eventTypeHeader)
         {
             AWS_LOGSTREAM_WARN(SUBSCRIBETOSHARD_HANDLER_CLASS_TAG, "Header: " << EVENT_TYPE_HEADER << " not found in the message.");
             return;
         }
-        switch (SubscribeToShardEventMapper::GetSubscribeToShardEventTypeForName(eventTypeHeaderIter->second.GetEventHeaderValueAsString()))
+        switch (SubscribeToShardEventMapper::GetSubscribeToShardEventTypeForName(eventTypeHeader->GetEventHeaderValueAsString()))
         {
         
         case SubscribeToShardEventType::INITIAL_RESPONSE: 
@@ -123,7 +123,7 @@ namespace Model
         }
         default:
             AWS_LOGSTREAM_WARN(SUBSCRIBETOSHARD_HANDLER_CLASS_TAG,
-                "Unexpected event type: " << eventTypeHeaderIter->second.GetEventHeaderValueAsString());
+                "Unexpected event type: " << eventTypeHeader->GetEventHeaderValueAsString());
             break;
         }
     }
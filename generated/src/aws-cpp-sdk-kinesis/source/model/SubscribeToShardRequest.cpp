@@ -5,6 +5,7 @@
 
 #include <aws/kinesis/model/SubscribeToShardRequest.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <smithy/tracing/TracingUtils.h>
 
 #include <utility>
 
@@ -20,6 +21,20 @@ SubscribeToShardRequest::SubscribeToShardRequest() :
 {
 }
 
+void SubscribeToShardRequest::EnableEventStreamDeliveryQueue(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+    size_t capacity,
+    const std::shared_ptr<smithy::components::tracing::Meter>& meter)
+{
+  m_deliveryQueue = Aws::MakeShared<Aws::Utils::Event::EventStreamDeliveryQueue>("SubscribeToShardRequest", m_handler, executor, capacity);
+  if (meter)
+  {
+    using smithy::components::tracing::TracingUtils;
+    m_deliveryQueue->RegisterMetrics(*meter,
+        {{TracingUtils::SMITHY_METHOD_DIMENSION, GetServiceRequestName()}, {TracingUtils::SMITHY_SERVICE_DIMENSION, "Kinesis"}});
+  }
+  m_decoder.ResetEventStreamHandler(GetDecodedEventsHandler());
+}
+
 Aws::String SubscribeToShardRequest::SerializePayload() const
 {
   JsonValue payload;
@@ -17,6 +17,7 @@ namespace Aws
     static const char JSON_CONTENT_TYPE[]                  = "application/json";
     static const char AMZN_JSON_CONTENT_TYPE_1_0[]         = "application/x-amz-json-1.0";
     static const char AMZN_JSON_CONTENT_TYPE_1_1[]         = "application/x-amz-json-1.1";
+    static const char AMZN_CBOR_CONTENT_TYPE_1_1[]         = "application/x-amz-cbor-1.1";
     static const char FORM_CONTENT_TYPE[]                  = "application/x-www-form-urlencoded";
     static const char AMZN_XML_CONTENT_TYPE[]              = "application/xml";
     static const char AMZN_EVENTSTREAM_CONTENT_TYPE[]      = "application/vnd.amazon.eventstream";
@@ -35,6 +36,7 @@ namespace Aws
             AWS_UNREFERENCED_PARAM(JSON_CONTENT_TYPE);
             AWS_UNREFERENCED_PARAM(AMZN_JSON_CONTENT_TYPE_1_0);
             AWS_UNREFERENCED_PARAM(AMZN_JSON_CONTENT_TYPE_1_1);
+            AWS_UNREFERENCED_PARAM(AMZN_CBOR_CONTENT_TYPE_1_1);
             AWS_UNREFERENCED_PARAM(FORM_CONTENT_TYPE);
             AWS_UNREFERENCED_PARAM(AMZN_XML_CONTENT_TYPE);
         }
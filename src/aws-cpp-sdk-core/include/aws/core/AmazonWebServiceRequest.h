@@ -99,6 +99,8 @@ namespace Aws
 
         /**
          * Defaults to false, if this is set to true, it supports chunked transfer encoding.
+         * Sent by AWSClient::AttemptExhaustivelyAsync with SigV4, the body is then sent aws-chunked and signed chunk by chunk, see
+         * AWSAuthV4Signer::SignStreamingRequest().
          */
         virtual bool IsChunked() const { return false; }
 
@@ -0,0 +1,70 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <functional>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpRequest;
+    } // namespace Http
+
+    namespace Auth
+    {
+        /**
+         * Builds SigV4 canonical requests into buffers which are reused from one request to the next.
+         *
+         * Produces the same output as AWSAuthHelper::CanonicalizeRequestSigningString followed by the canonical headers
+         * (AWSAuthHelper::CanonicalizeHeaders), the signed headers and the payload hash, but appends everything in place
+         * instead of going through string streams and per-header temporary strings.
+         * HttpRequest keeps its header names lower-cased in a sorted collection, so headers are written in that order.
+         *
+         * A builder is not thread-safe, use ForCurrentThread() to get the calling thread's instance.
+         */
+        class AWS_CORE_API CanonicalRequestBuilder
+        {
+        public:
+            using HeaderFilter = std::function<bool(const Aws::String&)>;
+
+            /**
+             * Returns the builder owned by the calling thread.
+             */
+            static CanonicalRequestBuilder& ForCurrentThread();
+
+            /**
+             * Builds the canonical request of request, signing only the headers accepted by shouldSignHeader.
+             * The query string of request is canonicalized in place, as by CanonicalizeRequestSigningString.
+             */
+            void Build(Aws::Http::HttpRequest& request,
+                       bool urlEscapePath,
+                       const Aws::String& payloadHash,
+                       const HeaderFilter& shouldSignHeader);
+
+            /**
+             * The canonical request of the last Build(), valid until the next Build() on this builder.
+             */
+            const Aws::String& GetCanonicalRequest() const { return m_canonicalRequest; }
+
+            /**
+             * The ';' separated signed header names of the last Build(), valid until the next Build() on this builder.
+             */
+            const Aws::String& GetSignedHeaders() const { return m_signedHeaders; }
+
+        private:
+            void AppendRequestLines(Aws::Http::HttpRequest& request, bool urlEscapePath);
+            void AppendHeaderValue(const Aws::String& value);
+
+            Aws::String m_canonicalRequest;
+            Aws::String m_signedHeaders;
+        };
+    } // namespace Auth
+} // namespace Aws
@@ -0,0 +1,66 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * x-amz-content-sha256 values of aws-chunked bodies signed chunk by chunk, without and with trailing checksum headers.
+         */
+        AWS_CORE_API extern const char STREAMING_AWS4_HMAC_SHA256_PAYLOAD[];
+        AWS_CORE_API extern const char STREAMING_AWS4_HMAC_SHA256_PAYLOAD_TRAILER[];
+
+        /**
+         * Computes the rolling SigV4 signatures of an aws-chunked body
+         * (https://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html).
+         *
+         * Each chunk is signed with the signing key of the request over its SHA256 and the signature of the previous chunk,
+         * starting from the seed signature of the request headers. The final, empty chunk and the trailing headers are signed
+         * the same way, so chunks have to be signed in the order they are sent.
+         */
+        class AWS_CORE_API ChunkSigner
+        {
+        public:
+            /**
+             * @param signingKey the derived SigV4 key the request was signed with.
+             * @param dateTime the x-amz-date of the request (ISO 8601 basic format).
+             * @param scope the credential scope of the request, date/region/service/aws4_request.
+             * @param seedSignature the hex encoded signature of the request, from its Authorization header.
+             */
+            ChunkSigner(const Aws::Utils::ByteBuffer& signingKey, const Aws::String& dateTime,
+                        const Aws::String& scope, const Aws::String& seedSignature);
+
+            /**
+             * Returns the hex encoded signature of the next chunk. A length of 0 signs the final chunk.
+             */
+            Aws::String SignChunk(const unsigned char* data, size_t length);
+
+            /**
+             * Returns the hex encoded signature of the trailing headers, sent after the final chunk.
+             * trailingHeaders are the "name:value\n" lines of the trailer, as sent but with \n line endings.
+             */
+            Aws::String SignTrailer(const Aws::String& trailingHeaders);
+
+            const Aws::String& GetPriorSignature() const { return m_priorSignature; }
+
+        private:
+            Aws::String Sign(const char* algorithm, const Aws::String& hashes);
+
+            Aws::Utils::ByteBuffer m_signingKey;
+            Aws::String m_dateTime;
+            Aws::String m_scope;
+            Aws::String m_priorSignature;
+        };
+    } // namespace Auth
+} // namespace Aws
@@ -0,0 +1,62 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/ShardedConcurrentCache.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <functional>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        class AWSCredentials;
+
+        /**
+         * Thread-safe cache of SigV4 signing keys.
+         *
+         * The signing key is derived from the secret key with four chained HMACs (date, region, service, "aws4_request")
+         * and only changes once a day for a given credential, region and service, so it is cached per
+         * (access key id, date, region, service). The secret key is stored alongside the derived key and compared on
+         * every hit, so credentials rotated under the same access key id never use a stale key.
+         */
+        class AWS_CORE_API SigningKeyCache
+        {
+        public:
+            using DeriveKeyFunction = std::function<Aws::Utils::ByteBuffer()>;
+
+            /**
+             * @param size Maximum number of cached signing keys.
+             */
+            explicit SigningKeyCache(size_t size = 64);
+
+            SigningKeyCache(const SigningKeyCache&) = delete;
+            SigningKeyCache& operator=(const SigningKeyCache&) = delete;
+
+            /**
+             * Returns the signing key of credentials for simpleDate (yyyyMMdd), region and serviceName, calling
+             * deriveKey on a miss. Concurrent misses on the same key derive it once.
+             */
+            Aws::Utils::ByteBuffer GetSigningKey(const AWSCredentials& credentials,
+                                                 const Aws::String& simpleDate,
+                                                 const Aws::String& region,
+                                                 const Aws::String& serviceName,
+                                                 const DeriveKeyFunction& deriveKey) const;
+
+        private:
+            struct CachedKey
+            {
+                Aws::String secretKey;
+                Aws::Utils::ByteBuffer signingKey;
+            };
+
+            mutable Aws::Utils::ShardedConcurrentCache<Aws::String, CachedKey> m_keys;
+        };
+    } // namespace Auth
+} // namespace Aws
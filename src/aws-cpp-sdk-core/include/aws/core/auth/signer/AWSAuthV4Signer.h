@@ -165,6 +165,28 @@ namespace Aws
             */
             bool PresignRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName, long long expirationInSeconds = 0) const override;
 
+            /**
+             * Data size of the chunks SignStreamingRequest() sends by default.
+             */
+            static const size_t DEFAULT_STREAMING_CHUNK_SIZE = 64 * 1024;
+
+            /**
+             * Signs the request for a streaming upload (STREAMING-AWS4-HMAC-SHA256-PAYLOAD) and replaces its body with its aws-chunked
+             * encoding, each chunk signed with a rolling signature as the HTTP client reads it. The body is read once and does not need
+             * to be hashed, nor its length known, before the request is sent.
+             * When the request has a request hash (flexible checksums), it is computed over the body as it is read and sent as a signed
+             * trailing header (STREAMING-AWS4-HMAC-SHA256-PAYLOAD-TRAILER).
+             * Content-Length is set to the encoded length when the body is seekable, Transfer-Encoding: chunked is used otherwise.
+             * Signing the request again, e.g. for a retry, rewinds the body to where its first encoding started and uses a new request
+             * hash; it fails if the body cannot seek.
+             * AWSClient::AttemptExhaustivelyAsync signs the requests returning true from
+             * AmazonWebServiceRequest::IsChunked() with it. Only supported with SigV4.
+             * Using m_region by default if parameter region is nullptr.
+             * Using m_serviceName by default if parameter serviceName is nullptr.
+             */
+            bool SignStreamingRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName,
+                                      size_t chunkSize = DEFAULT_STREAMING_CHUNK_SIZE) const;
+
             virtual Aws::Auth::AWSCredentials GetCredentials(const Aws::Http::ServiceSpecificParameters &serviceSpecificParameters) const;
 
             Aws::String GetServiceName() const { return m_serviceName; }
@@ -190,6 +212,13 @@ namespace Aws
                     const Aws::String& serviceName) const;
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey,
                     const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
+            /**
+             * Returns the signing key of credentials for the given scope from a SigningKeyCache shared by all the signers of
+             * the process, computing it with ComputeHash on a miss. Used by SignStreamingRequest, unlike the single entry
+             * m_partialSignature cache it hits when requests alternate between dates, regions or services.
+             */
+            Aws::Utils::ByteBuffer GetSigningKey(const Aws::Auth::AWSCredentials& credentials,
+                    const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
             bool SignRequestWithSigV4a(Aws::Http::HttpRequest& request, const char* region, const char* serviceName,
                     bool signBody, long long expirationTimeInSeconds, Aws::Crt::Auth::SignatureType signatureType) const;
 
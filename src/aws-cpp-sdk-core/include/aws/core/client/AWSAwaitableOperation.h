@@ -0,0 +1,136 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+/**
+ * Defined when the compiler supports C++20 coroutines, the *Awaitable operation variants are only available then.
+ */
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define AWS_SDK_HAS_COROUTINES 1
+#endif
+
+#ifdef AWS_SDK_HAS_COROUTINES
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <atomic>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace Aws
+{
+namespace Client
+{
+    /**
+     * Awaitable returned by the *Awaitable variants of AWS Operations, the coroutine counterparts of the *Callable variants:
+     *     auto outcome = co_await client.GetItemAwaitable(request);
+     *
+     * The request is copied and the operation is run on the client's executor while the awaiting coroutine is suspended.
+     * Once the operation has finished the coroutine is resumed on resumeExecutor if one is given (and accepts the task),
+     * otherwise directly on the thread which ran the operation.
+     * If the client has no executor or the executor rejects the task, the operation is run inline without suspending.
+     *
+     * A started operation cannot be cancelled. If the suspended coroutine is destroyed, the operation still runs to its end
+     * but its outcome is discarded and the coroutine is not resumed: the state shared with the executor task outlives the
+     * coroutine frame. As with the other asynchronous operations, the client must outlive the operation.
+     */
+    template<typename ClientT, typename OperationFuncT, typename RequestT, typename OutcomeT>
+    class OperationAwaitable
+    {
+    public:
+        OperationAwaitable(const char* allocationTag,
+                           const ClientT* client,
+                           OperationFuncT operationFunc,
+                           const RequestT& request,
+                           Aws::Utils::Threading::Executor* executor,
+                           Aws::Utils::Threading::Executor* resumeExecutor) :
+            m_state(Aws::MakeShared<State>(allocationTag, client, operationFunc, request)),
+            m_executor(executor),
+            m_resumeExecutor(resumeExecutor)
+        {
+        }
+
+        ~OperationAwaitable()
+        {
+            // the coroutine frame holding this awaitable is destroyed, while suspended or not
+            Status awaiting = Status::AWAITING;
+            m_state->status.compare_exchange_strong(awaiting, Status::ABANDONED);
+        }
+
+        OperationAwaitable(const OperationAwaitable&) = delete;
+        OperationAwaitable& operator=(const OperationAwaitable&) = delete;
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle)
+        {
+            m_state->handle = handle;
+            std::shared_ptr<State> state = m_state;
+            Aws::Utils::Threading::Executor* resumeExecutor = m_resumeExecutor;
+            // the coroutine may be resumed and this awaitable destroyed before Submit returns, do not touch members afterwards
+            if (m_executor && m_executor->Submit([state, resumeExecutor]() { Run(state, resumeExecutor); }))
+            {
+                return true;
+            }
+            state->outcome = (state->client->*state->operationFunc)(state->request);
+            state->status = Status::RESUMED;
+            return false;
+        }
+
+        OutcomeT await_resume() { return std::move(m_state->outcome); }
+
+    private:
+        enum class Status
+        {
+            AWAITING,
+            RESUMED,
+            ABANDONED
+        };
+
+        struct State
+        {
+            State(const ClientT* operationClient, OperationFuncT operationFunction, const RequestT& operationRequest) :
+                client(operationClient), operationFunc(operationFunction), request(operationRequest)
+            {
+            }
+
+            const ClientT* client;
+            OperationFuncT operationFunc;
+            const RequestT request;
+            std::coroutine_handle<> handle;
+            OutcomeT outcome;
+            std::atomic<Status> status{Status::AWAITING};
+        };
+
+        static void Run(const std::shared_ptr<State>& state, Aws::Utils::Threading::Executor* resumeExecutor)
+        {
+            state->outcome = (state->client->*state->operationFunc)(state->request);
+            std::function<void()> resume = [state]()
+            {
+                Status awaiting = Status::AWAITING;
+                if (state->status.compare_exchange_strong(awaiting, Status::RESUMED))
+                {
+                    state->handle.resume();
+                }
+            };
+            if (!resumeExecutor || !resumeExecutor->Submit(std::function<void()>(resume)))
+            {
+                resume();
+            }
+        }
+
+        std::shared_ptr<State> m_state;
+        Aws::Utils::Threading::Executor* m_executor;
+        Aws::Utils::Threading::Executor* m_resumeExecutor;
+    };
+} // namespace Client
+} // namespace Aws
+
+#endif // AWS_SDK_HAS_COROUTINES
@@ -16,8 +16,10 @@
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <aws/core/endpoint/AWSEndpoint.h>
+#include <smithy/tracing/OperationTelemetry.h>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 namespace Aws
 {
@@ -35,6 +37,12 @@ namespace Aws
         {
             class MD5;
         } // namespace Crypto
+
+        namespace Threading
+        {
+            class Executor;
+            class TimerQueue;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -66,9 +74,11 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class HedgingPolicy;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(HttpResponseOutcome&&)> HttpResponseOutcomeHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it across the wire.
@@ -215,6 +225,41 @@ namespace Aws
                                                     const char* signerRegionOverride = nullptr,
                                                     const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Asynchronous counterpart of AttemptExhaustively. Each attempt is built and signed on the calling thread or on executor,
+             * sent with HttpClient::MakeRequestAsync, and its response is processed on executor. Retry back-off is waited out
+             * on a timer, so no thread is blocked between attempts. The round-trip of each attempt still blocks the thread sending it
+             * unless the http client overrides MakeRequestAsync. handler is invoked on executor with the final outcome.
+             * Chunked requests (AmazonWebServiceRequest::IsChunked()) signed with SigV4 are signed with AWSAuthV4Signer::SignStreamingRequest().
+             * If executor is null or rejects a task, that task runs on the thread completing the previous step instead.
+             * The client must outlive the request, as with the other asynchronous operations.
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                                          const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                                          Http::HttpMethod httpMethod,
+                                          const char* signerName,
+                                          Aws::Utils::Threading::Executor* executor,
+                                          HttpResponseOutcomeHandler&& handler,
+                                          const char* signerRegionOverride = nullptr,
+                                          const char* signerServiceNameOverride = nullptr) const;
+
+            /**
+             * Variant of AttemptExhaustivelyAsync which hedges the request according to hedgingPolicy: if the first attempt has
+             * not completed after the hedge delay and the policy's budget allows it, a second attempt is sent, on another
+             * connection of the http client. handler receives the first successful outcome (or the last failure), and the
+             * other attempt is cancelled through the continue request handle of its http request.
+             * The operation of request must be idempotent.
+             */
+            void AttemptHedgedAsync(const Aws::Http::URI& uri,
+                                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                                    Http::HttpMethod httpMethod,
+                                    const char* signerName,
+                                    Aws::Utils::Threading::Executor* executor,
+                                    const std::shared_ptr<HedgingPolicy>& hedgingPolicy,
+                                    HttpResponseOutcomeHandler&& handler,
+                                    const char* signerRegionOverride = nullptr,
+                                    const char* signerServiceNameOverride = nullptr) const;
+
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it across the wire
              * then reports the http response.
@@ -328,8 +373,36 @@ namespace Aws
             static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCode);
             static bool DoesResponseGenerateError(const std::shared_ptr<Aws::Http::HttpResponse>& response);
             std::shared_ptr<smithy::components::tracing::TelemetryProvider> m_telemetryProvider;
+
+            /**
+             * Returns the tracer, meter, instruments and attributes of operationName, resolved from m_telemetryProvider
+             * on the first call and cached for the lifetime of the client. m_telemetryProvider must not be null.
+             */
+            inline const smithy::components::tracing::OperationTelemetry& GetOperationTelemetry(const char* operationName) const
+            {
+                return m_operationTelemetry.Get(*m_telemetryProvider, GetServiceClientName(), operationName);
+            }
             std::shared_ptr<Aws::Auth::AWSAuthSignerProvider> m_signerProvider;
         private:
+            struct AsyncRequestContext;
+            struct HedgedRequestState;
+
+            std::shared_ptr<AsyncRequestContext> CreateAsyncRequestContext(const Aws::Http::URI& uri,
+                                                                           const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                                                                           Http::HttpMethod httpMethod,
+                                                                           const char* signerName,
+                                                                           Aws::Utils::Threading::Executor* executor,
+                                                                           HttpResponseOutcomeHandler&& handler,
+                                                                           const char* signerRegionOverride,
+                                                                           const char* signerServiceNameOverride) const;
+            void SendHedgeAsync(const std::shared_ptr<HedgedRequestState>& state) const;
+            static HttpResponseOutcomeHandler HedgedRequestHandler(const std::shared_ptr<HedgedRequestState>& state, size_t attempt);
+            void AttemptOneRequestAsync(const std::shared_ptr<AsyncRequestContext>& context) const;
+            void CompleteAttemptAsync(const std::shared_ptr<AsyncRequestContext>& context,
+                                      const std::shared_ptr<Aws::Http::HttpResponse>& response) const;
+            void FinishRequestAsync(const std::shared_ptr<AsyncRequestContext>& context, HttpResponseOutcome&& outcome) const;
+            std::shared_ptr<Aws::Utils::Threading::TimerQueue> GetRetryTimer() const;
+
             /**
              * Try to adjust signer's clock
              * return true if signer's clock is adjusted, false otherwise.
@@ -353,6 +426,9 @@ namespace Aws
             bool m_enableClockSkewAdjustment;
             Aws::String m_serviceName = "AWSBaseClient";
             Aws::Client::RequestCompressionConfig m_requestCompressionConfig;
+            smithy::components::tracing::OperationTelemetryCache m_operationTelemetry;
+            // created on first use by the asynchronous request path, see GetRetryTimer()
+            mutable std::shared_ptr<Aws::Utils::Threading::TimerQueue> m_retryTimer;
             void AppendHeaderValueToRequest(
                 const std::shared_ptr<Http::HttpRequest> &request, String header,
                 String value) const;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <aws/core/client/AWSAsyncOperationTemplate.h>
+#include <aws/core/client/AWSAwaitableOperation.h>
 #include <aws/core/utils/logging/ErrorMacros.h>
 #include <aws/core/utils/component-registry/ComponentRegistry.h>
 
@@ -193,6 +194,23 @@ namespace Client
             const AwsServiceClientT* clientThis = static_cast<const AwsServiceClientT*>(this);
             return Aws::Client::MakeCallableOperation(AwsServiceClientT::GetAllocationTag(), operationFunc, clientThis, clientThis->m_executor.get());
         }
+
+#ifdef AWS_SDK_HAS_COROUTINES
+        /**
+         * A template to co_await a AwsServiceClient regular operation method executed on the client's thread executor.
+         * The awaiting coroutine is resumed on resumeExecutor, or on the client's executor thread if it is null.
+         * This template method copies the request, see OperationAwaitable.
+         */
+        template<typename RequestT, typename OperationFuncT, typename std::enable_if<!IsEventStreamOperation<OperationFuncT>::value, int>::type = 0>
+        auto SubmitAwaitable(OperationFuncT operationFunc,
+                             const RequestT& request,
+                             Aws::Utils::Threading::Executor* resumeExecutor = nullptr) const
+            -> OperationAwaitable<AwsServiceClientT, OperationFuncT, RequestT, decltype((static_cast<const AwsServiceClientT*>(nullptr)->*operationFunc)(request))>
+        {
+            const AwsServiceClientT* clientThis = static_cast<const AwsServiceClientT*>(this);
+            return {AwsServiceClientT::GetAllocationTag(), clientThis, operationFunc, request, clientThis->m_executor.get(), resumeExecutor};
+        }
+#endif
     protected:
         std::atomic<bool> m_isInitialized;
         mutable std::atomic<size_t> m_operationsProcessed;
@@ -23,6 +23,7 @@ namespace Aws
     namespace Client
     {
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
+        typedef std::function<void(JsonOutcome&&)> JsonOutcomeHandler;
         /**
          *  AWSClient that handles marshalling json response bodies. You would inherit from this class
          *  to create a client that uses Json as its payload format.
@@ -102,6 +103,19 @@ namespace Aws
                 const char* signerRegionOverride = nullptr,
                 const char* signerServiceNameOverride = nullptr) const;
 
+            /**
+             * Asynchronous counterpart of MakeRequest(request, endpoint, ...), see AWSClient::AttemptExhaustivelyAsync.
+             * The response is parsed on executor and handler is invoked there with the Json document or the error.
+             * If hedgingPolicy is set and allows the operation of request, the request is hedged, see AWSClient::AttemptHedgedAsync.
+             */
+            void MakeRequestAsync(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                                  const Aws::Endpoint::AWSEndpoint& endpoint,
+                                  Aws::Utils::Threading::Executor* executor,
+                                  JsonOutcomeHandler&& handler,
+                                  Http::HttpMethod method = Http::HttpMethod::HTTP_POST,
+                                  const char* signerName = Aws::Auth::SIGV4_SIGNER,
+                                  const std::shared_ptr<HedgingPolicy>& hedgingPolicy = nullptr) const;
+
             JsonOutcome MakeEventStreamRequest(std::shared_ptr<Aws::Http::HttpRequest>& request) const;
         };
     } // namespace Client
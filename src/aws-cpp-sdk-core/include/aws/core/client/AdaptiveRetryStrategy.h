@@ -8,24 +8,53 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <smithy/tracing/Meter.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 namespace Aws
 {
 namespace Client
 {
 
+extern AWS_CORE_API const char RETRY_TOKEN_BUCKET_FILL_RATE_METRIC[];
+extern AWS_CORE_API const char RETRY_TOKEN_BUCKET_MEASURED_TX_RATE_METRIC[];
+
 /**
  * A helper class of the AdaptiveRetryStrategy
  * representing a (send) token bucket with a dynamically changing fill rate and capacity.
+ *
+ * The bucket is lock-free on the request path: until a throttling response is received it does not limit the rate,
+ * and only counts the responses to measure the sending rate; once enabled, tokens are taken with a compare-and-swap
+ * on the time at which the bucket was empty. Only the CUBIC rate updates which follow responses are serialized, and a
+ * successful response skips its update if another one is in progress. Time is measured with a monotonic clock.
+ *
+ * A bucket can be shared by the clients calling the same endpoint, by passing it to the AdaptiveRetryStrategy of each.
+ *
+ * The protected data members changed with the lock-free implementation: m_currentCapacity, m_lastTimestamp and m_mutex
+ * were removed, the capacity being derived from m_emptyTimestamp, and the other members became atomics or use Clock.
+ * Classes derived from RetryTokenBucket which access them must be updated.
  */
 class AWS_CORE_API RetryTokenBucket
 {
 public:
+    typedef std::chrono::steady_clock Clock;
+
     /**
      * C-tor
      */
     RetryTokenBucket() = default;
 
+    ~RetryTokenBucket();
+
+    RetryTokenBucket(const RetryTokenBucket&) = delete;
+    RetryTokenBucket& operator=(const RetryTokenBucket&) = delete;
+
     /**
      * Acquire tokens from the bucket. If the bucket contains enough capacity
      * to satisfy the request, this method will return immediately, otherwise
@@ -34,27 +63,79 @@ public:
      */
     bool Acquire(size_t amount = 1, bool fastFail = false);
 
+    /**
+     * Variant of Acquire which does not block: if the bucket lacks capacity, the tokens are reserved anyway and wait
+     * is set to the time after which they are refilled, during which the caller must hold off sending. With fast
+     * fail, nothing is reserved and false is returned instead.
+     */
+    bool Reserve(size_t amount, bool fastFail, std::chrono::nanoseconds& wait);
+
     /**
      * Update limiter's client sending rate during the request bookkeeping process
      * based on a service response.
      */
-    void UpdateClientSendingRate(bool throttlingResponse, const Aws::Utils::DateTime& now = Aws::Utils::DateTime::Now());
+    void UpdateClientSendingRate(bool throttlingResponse);
+
+    /**
+     * Previous form of UpdateClientSendingRate(bool), now is mapped to the monotonic clock relative to the current time.
+     */
+    AWS_DEPRECATED("The bucket measures time with a monotonic clock, use UpdateClientSendingRate(bool).")
+    void UpdateClientSendingRate(bool throttlingResponse, const Aws::Utils::DateTime& now);
+
+    /**
+     * The rate at which tokens are replenished, in tokens per second. Only limits the sending rate once enabled.
+     */
+    double GetFillRate() const { return m_fillRate.load(std::memory_order_relaxed); }
+
+    /**
+     * The smoothed rate of responses, in requests per second.
+     */
+    double GetMeasuredTxRate() const { return m_measuredTxRate.load(std::memory_order_relaxed); }
+
+    /**
+     * Whether the bucket limits the sending rate, i.e. a throttling response was received.
+     */
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Reports the fill rate and the measured sending rate (RETRY_TOKEN_BUCKET_FILL_RATE_METRIC and
+     * RETRY_TOKEN_BUCKET_MEASURED_TX_RATE_METRIC) as gauges of meter, until the bucket is destroyed.
+     */
+    void RegisterMetrics(const smithy::components::tracing::Meter& meter,
+                         const Aws::Map<Aws::String, Aws::String>& attributes = {});
 
 protected:
     /**
      * Internal C-tor for unit testing
      */
+    RetryTokenBucket(double fillRate, double maxCapacity, double currentCapacity,
+                     const Clock::time_point& lastTimestamp, double measuredTxRate, double lastTxRateBucket,
+                     size_t requestCount, bool enabled, double lastMaxRate, const Clock::time_point& lastThrottleTime);
+
+    AWS_DEPRECATED("The bucket measures time with a monotonic clock, use the c-tor taking Clock::time_point.")
     RetryTokenBucket(double fillRate, double maxCapacity, double currentCapacity,
                      const Aws::Utils::DateTime& lastTimestamp, double measuredTxRate, double lastTxRateBucket,
                      size_t requestCount, bool enabled, double lastMaxRate, const Aws::Utils::DateTime& lastThrottleTime);
 
+    /**
+     * Internal variants taking the current time, for unit testing.
+     */
+    bool Acquire(size_t amount, bool fastFail, const Clock::time_point& now);
+    bool Reserve(size_t amount, bool fastFail, const Clock::time_point& now, std::chrono::nanoseconds& wait);
+    void UpdateClientSendingRate(bool throttlingResponse, const Clock::time_point& now);
+
+    /**
+     * Current capacity of the bucket, negative when tokens were reserved by waiting callers.
+     */
+    double GetCurrentCapacity(const Clock::time_point& now) const;
+
     /**
      * Internal method to update the token bucket's fill rate when we receive a response from the service.
      * The update amount will depend on whether or not a throttling response is received from a service.
      * The request rate is measured using an exponentially smoothed average,
      * with the rate being updated in half second buckets.
      */
-    void UpdateMeasuredRate(const Aws::Utils::DateTime& now = Aws::Utils::DateTime::Now());
+    void UpdateMeasuredRate(const Clock::time_point& now);
 
     /**
      * Internal method to enable rate limiting.
@@ -63,12 +144,15 @@ protected:
 
     /**
      * Internal method to refill and update refill rate with a new refill rate.
+     * Called with m_rateMutex held.
      */
-    void UpdateRate(double newRps, const Aws::Utils::DateTime& now = Aws::Utils::DateTime::Now());
+    void UpdateRate(double newRps, const Clock::time_point& now);
 
     /**
-     * Internal method to refill send tokens based on a current fill rate.
+     * Does nothing: the current capacity is derived from the time at which the bucket was empty, so it no longer needs
+     * to be refilled.
      */
+    AWS_DEPRECATED("The bucket no longer needs to be refilled.")
     void Refill(const Aws::Utils::DateTime& now = Aws::Utils::DateTime::Now());
 
     /**
@@ -79,7 +163,7 @@ protected:
     /**
      * Internal method with a modified CUBIC algorithm to compute new max sending rate for a successful response.
      */
-    double CUBICSuccess(const Aws::Utils::DateTime& timestamp, const double timeWindow) const;
+    double CUBICSuccess(const Clock::time_point& timestamp, const double timeWindow) const;
 
     /**
      * Internal method with a modified CUBIC algorithm to compute new max sending rate for a throttled response.
@@ -87,28 +171,27 @@ protected:
     double CUBICThrottle(const double rateToUse) const;
 
     // The rate at which token are replenished.
-    double m_fillRate = 0.0;
+    std::atomic<double> m_fillRate{0.0};
     // The maximum capacity allowed in the token bucket.
-    double m_maxCapacity = 0.0;
-    // The current capacity of the token bucket.
-    double m_currentCapacity = 0.0;
-    // The last time the token bucket was refilled.
-    Aws::Utils::DateTime m_lastTimestamp;
+    std::atomic<double> m_maxCapacity{0.0};
+    // The time at which the token bucket was empty, in nanoseconds of Clock. The current capacity is derived from it.
+    std::atomic<int64_t> m_emptyTimestamp{0};
     // The smoothed rate which tokens are being retrieved.
-    double m_measuredTxRate = 0.0;
-    // The last half second time bucket used.
-    double m_lastTxRateBucket = 0.0;
+    std::atomic<double> m_measuredTxRate{0.0};
+    // The last half second time bucket used, as a number of half seconds of Clock.
+    std::atomic<int64_t> m_lastTxRateBucket{0};
     // The number of requests seen within the current time bucket.
-    size_t m_requestCount = 0;
+    std::atomic<size_t> m_requestCount{0};
     // Boolean indicating if the token bucket is enabled.
-    bool m_enabled = false;
+    std::atomic<bool> m_enabled{false};
+
+    // Serializes the CUBIC rate updates, and guards the state below.
+    std::mutex m_rateMutex;
     // The maximum rate when the client was last throttled.
     double m_lastMaxRate = 0.0;
     // The last time when the client was throttled.
-    Aws::Utils::DateTime m_lastThrottleTime;
-
-    // TokenBucket's mutex to synchronize read/write operations
-    std::recursive_mutex m_mutex;
+    Clock::time_point m_lastThrottleTime;
+    Aws::Vector<Aws::UniquePtr<smithy::components::tracing::GaugeHandle>> m_gauges;
 };
 
 /**
@@ -123,6 +206,11 @@ public:
      */
     AdaptiveRetryStrategy(long maxAttempts = 3);
     AdaptiveRetryStrategy(std::shared_ptr<RetryQuotaContainer> retryQuotaContainer, long maxAttempts = 3);
+    /**
+     * Uses retryTokenBucket, which can be shared with the strategies of other clients calling the same endpoint.
+     */
+    AdaptiveRetryStrategy(std::shared_ptr<RetryTokenBucket> retryTokenBucket,
+                          std::shared_ptr<RetryQuotaContainer> retryQuotaContainer, long maxAttempts = 3);
 
     /**
      * Retrieve and consume a send token.
@@ -133,6 +221,11 @@ public:
      */
     virtual bool HasSendToken() override;
 
+    /**
+     * Retrieve a send token without blocking, see RetryTokenBucket::Reserve.
+     */
+    virtual bool ReserveSendToken(long& delayMs) override;
+
     /**
      * Update status, like the information of retry quota when receiving a response.
      */
@@ -141,8 +234,15 @@ public:
 
     const char* GetStrategyName() const override { return "adaptive";}
 
+    /**
+     * The token bucket limiting the sending rate.
+     */
+    const std::shared_ptr<RetryTokenBucket>& GetRetryTokenBucket() const { return m_retryTokenBucket; }
+
 protected:
-    RetryTokenBucket m_retryTokenBucket;
+    // Held by pointer so that it can be shared between strategies, it was held by value before: derived strategies
+    // access it with -> instead of the member access operator.
+    std::shared_ptr<RetryTokenBucket> m_retryTokenBucket;
     bool m_fastFail = false;
 
 private:
@@ -34,6 +34,7 @@ namespace Aws
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class HedgingPolicy; // forward declare
 
         /**
          * Sets the behaviors of the underlying HTTP clients handling response with 30x status code.
@@ -294,6 +295,29 @@ namespace Aws
              */
             bool enableClockSkewAdjustment = true;
 
+            /**
+             * If set to true, asynchronous operations which support it release their executor thread between attempts: retry
+             * back-off is waited out on a timer and each attempt is sent from a new task, see AWSClient::AttemptExhaustivelyAsync.
+             * The network round-trip of an attempt still holds the thread sending it, as none of the http clients of the SDK
+             * override HttpClient::MakeRequestAsync.
+             * Currently supported by DynamoDB GetItemAsync and PutItemAsync. Default to false.
+             */
+            bool releaseExecutorBetweenAttempts = false;
+
+            /**
+             * Hedges the requests of the idempotent operations listed by the policy: a second attempt is sent when the first
+             * one is slower than usual, and the first success is kept. See HedgingPolicy.
+             * Applies to operations sent with releaseExecutorBetweenAttempts, currently DynamoDB GetItemAsync. Default to nullptr, disabled.
+             */
+            std::shared_ptr<Aws::Client::HedgingPolicy> hedgingPolicy;
+
+            /**
+             * If set to true, operations of services accepting CBOR (application/x-amz-cbor-1.1) are sent and received in CBOR
+             * instead of JSON, so that binary members go over the wire as raw bytes rather than base64 text.
+             * Currently supported by Kinesis PutRecord, PutRecords and GetRecords. Default to false.
+             */
+            bool enableCborProtocol = false;
+
             /**
              * Enable host prefix injection.
              * For services whose endpoint is injectable. e.g. servicediscovery, you can modify the http host's prefix so as to add "data-" prefix for DiscoverInstances request.
@@ -348,6 +372,13 @@ namespace Aws
              */
             bool disableImdsV1 = false;
 
+            /**
+             * Maximum number of endpoint resolutions memoized by the default endpoint provider.
+             * Requests with identical endpoint parameters then skip the endpoint rules evaluation.
+             * Default to 0, disabled.
+             */
+            size_t endpointResolutionCacheSize = 0;
+
             /**
              * A helper function to read config value from env variable or aws profile config
              */
@@ -0,0 +1,113 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * Opt-in policy sending a second, speculative attempt of an idempotent operation when the first one takes longer
+         * than usual, and keeping whichever succeeds first. The other attempt is cancelled.
+         *
+         * The hedge is sent after a fixed delay, or, when the fixed delay is zero, after the latencyPercentile of the
+         * latencies observed by the policy (e.g. the p95), once enough requests completed.
+         * Hedges are paid for with tokens earned by the requests which succeed without one, budgetRatio token per
+         * request up to maxBudget, so they stop when the service fails and can not amplify the load of an outage.
+         *
+         * A policy can be shared by several clients. This class is thread-safe.
+         */
+        class AWS_CORE_API HedgingPolicy
+        {
+        public:
+            /**
+             * @param hedgeableOperations Names of the operations which may be hedged, e.g. "GetItem". They must be idempotent.
+             * @param hedgeDelay Fixed delay before sending the hedge, zero to derive it from the observed latencies.
+             * @param latencyPercentile Percentile of the observed latencies used as the adaptive delay.
+             * @param minHedgeDelay Lower bound of the adaptive delay, also used until enough latencies were observed.
+             * @param budgetRatio Hedge tokens earned by each request which succeeds without a hedge.
+             * @param maxBudget Maximum number of hedge tokens, the policy starts with a full budget.
+             */
+            HedgingPolicy(const Aws::Set<Aws::String>& hedgeableOperations,
+                          std::chrono::milliseconds hedgeDelay = std::chrono::milliseconds(0),
+                          double latencyPercentile = 0.95,
+                          std::chrono::milliseconds minHedgeDelay = std::chrono::milliseconds(10),
+                          double budgetRatio = 0.05,
+                          size_t maxBudget = 10);
+
+            HedgingPolicy(const HedgingPolicy&) = delete;
+            HedgingPolicy& operator=(const HedgingPolicy&) = delete;
+
+            /**
+             * Whether requests of operationName may be hedged.
+             */
+            bool IsHedgeable(const char* operationName) const;
+
+            /**
+             * Time to wait for the first attempt before sending the hedge.
+             */
+            std::chrono::microseconds GetHedgeDelay() const;
+
+            /**
+             * Takes a hedge token. Returns false, and the hedge must not be sent, if the budget is exhausted.
+             */
+            bool TryAcquireHedge();
+
+            /**
+             * Records the outcome of a hedgeable request. latency is the time from the first attempt to the response,
+             * hedged tells whether a hedge was sent. Only requests which succeed without a hedge earn hedge tokens.
+             */
+            void RecordRequest(bool success, bool hedged, std::chrono::microseconds latency);
+
+            /**
+             * Records that the hedge completed before the first attempt.
+             */
+            void RecordHedgeWon() { m_hedgesWon.fetch_add(1, std::memory_order_relaxed); }
+
+            size_t GetHedgesSent() const { return m_hedgesSent.load(std::memory_order_relaxed); }
+            size_t GetHedgesWon() const { return m_hedgesWon.load(std::memory_order_relaxed); }
+
+            /**
+             * Number of hedges which could be sent right now.
+             */
+            double GetAvailableBudget() const;
+
+        private:
+            static const size_t LATENCY_BUCKETS = 128;
+            static const size_t LATENCY_WINDOW = 1000;
+
+            void RecordLatency(std::chrono::microseconds latency);
+            void UpdateAdaptiveDelay(size_t window);
+
+            const Aws::Set<Aws::String> m_hedgeableOperations;
+            const std::chrono::microseconds m_hedgeDelay;
+            const double m_latencyPercentile;
+            const std::chrono::microseconds m_minHedgeDelay;
+            // hedge tokens are counted in thousandths
+            const int64_t m_tokensPerRequest;
+            const int64_t m_maxTokens;
+            std::atomic<int64_t> m_tokens;
+
+            // Log-scaled latency histograms, four buckets per power of two microseconds. Latencies are recorded to the
+            // current window; when it is full the percentile is computed from it and recording switches to the other one.
+            std::atomic<uint32_t> m_latencyCounts[2][LATENCY_BUCKETS];
+            std::atomic<size_t> m_latencyWindow;
+            std::atomic<size_t> m_latencySamples;
+            std::atomic<int64_t> m_adaptiveDelayUs;
+
+            std::atomic<size_t> m_hedgesSent;
+            std::atomic<size_t> m_hedgesWon;
+        };
+    } // namespace Client
+} // namespace Aws
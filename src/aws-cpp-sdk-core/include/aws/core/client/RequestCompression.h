@@ -16,6 +16,12 @@ using iostream_outcome =
     Aws::Utils::Outcome<std::shared_ptr<Aws::IOStream>, bool>;
 
 namespace Aws {
+namespace Utils {
+namespace Threading {
+class Executor;
+} // namespace Threading
+} // namespace Utils
+
 namespace Client {
 enum class CompressionAlgorithm { NONE, GZIP };
 
@@ -53,6 +59,23 @@ public:
    */
   iostream_outcome compress(std::shared_ptr<Aws::IOStream> input,
                             const CompressionAlgorithm &algorithm) const;
+  /**
+   * Wrap a IOStream input in a stream compressing it with the requested
+   * algorithm as it is read, so compression overlaps with sending and the
+   * body is never copied whole. The compressed length is not known in
+   * advance, the request has to be sent with chunked transfer encoding.
+   * Not used by the SDK clients yet: AWSClient still compresses request
+   * bodies with compress().
+   * @param input
+   * @param algorithm
+   * @param executor when not null, blocks of the input are compressed in
+   * parallel on it; it must outlive the returned stream
+   * @return IOStream producing the compressed input
+   */
+  iostream_outcome
+  compressStreaming(std::shared_ptr<Aws::IOStream> input,
+                    const CompressionAlgorithm &algorithm,
+                    Aws::Utils::Threading::Executor *executor = nullptr) const;
   /**
    * Uncompress a IOStream input using the requested algorithm.
    * @param input
@@ -6,7 +6,7 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
-#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <atomic>
 #include <memory>
 
 namespace Aws
@@ -69,6 +69,18 @@ namespace Aws
                 return true;
             }
 
+            /**
+             * Variant of HasSendToken() for callers which must not block, e.g. the asynchronous request path.
+             * Returns false if no send token can be retrieved. Otherwise the token is retrieved, possibly ahead of time:
+             * delayMs is set to the time to wait before sending, 0 to send right away.
+             * The default implementation calls HasSendToken(), which does not block unless overridden.
+             */
+            virtual bool ReserveSendToken(long& delayMs)
+            {
+                delayMs = 0;
+                return HasSendToken();
+            }
+
             /**
              * Update status, like the information of retry quota when receiving a response.
              */
@@ -111,11 +123,11 @@ namespace Aws
             virtual bool AcquireRetryQuota(const AWSError<CoreErrors>& error) override;
             virtual void ReleaseRetryQuota(int capacityAmount) override;
             virtual void ReleaseRetryQuota(const AWSError<CoreErrors>& lastError) override;
-            virtual int GetRetryQuota() const override { return m_retryQuota; }
+            virtual int GetRetryQuota() const override { return m_retryQuota.load(std::memory_order_relaxed); }
 
         protected:
-            mutable Aws::Utils::Threading::ReaderWriterLock m_retryQuotaLock;
-            int m_retryQuota;
+            // updated with compare-and-swap, every attempt of every request goes through the container
+            std::atomic<int> m_retryQuota;
         };
 
         class AWS_CORE_API StandardRetryStrategy : public RetryStrategy
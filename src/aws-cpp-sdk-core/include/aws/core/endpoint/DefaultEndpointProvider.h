@@ -11,6 +11,7 @@
 #include <aws/core/endpoint/EndpointParameter.h>
 #include <aws/core/endpoint/ClientContextParameters.h>
 #include <aws/core/endpoint/BuiltInParameters.h>
+#include <aws/core/endpoint/EndpointResolutionCache.h>
 #include <aws/core/utils/memory/stl/AWSArray.h>
 
 #include <aws/crt/endpoints/RuleEngine.h>
@@ -65,6 +66,8 @@ namespace Aws
             void InitBuiltInParameters(const ClientConfigurationT& config) override
             {
                 m_builtInParameters.SetFromClientConfiguration(config);
+                m_endpointCache.Configure(config.endpointResolutionCacheSize,
+                    config.telemetryProvider ? config.telemetryProvider->getMeter(DEFAULT_ENDPOINT_PROVIDER_TAG, {}) : nullptr);
             }
 
             /**
@@ -73,7 +76,25 @@ namespace Aws
             ResolveEndpointOutcome ResolveEndpoint(const EndpointParameters& endpointParameters) const override
             {
                 auto ResolveEndpointDefaultImpl = Aws::Endpoint::ResolveEndpointDefaultImpl;
-                return ResolveEndpointDefaultImpl(m_crtRuleEngine, m_builtInParameters.GetAllParameters(), m_clientContextParameters.GetAllParameters(), endpointParameters);
+                if (!m_endpointCache.IsEnabled())
+                {
+                    return ResolveEndpointDefaultImpl(m_crtRuleEngine, m_builtInParameters.GetAllParameters(), m_clientContextParameters.GetAllParameters(), endpointParameters);
+                }
+
+                const size_t cacheGeneration = m_endpointCache.GetGeneration();
+                Aws::String cacheKey = EndpointResolutionCache::ComputeKey(m_builtInParameters.GetAllParameters(), m_clientContextParameters.GetAllParameters(), endpointParameters);
+                AWSEndpoint cachedEndpoint;
+                if (m_endpointCache.Get(cacheKey, cachedEndpoint))
+                {
+                    return cachedEndpoint;
+                }
+
+                ResolveEndpointOutcome outcome = ResolveEndpointDefaultImpl(m_crtRuleEngine, m_builtInParameters.GetAllParameters(), m_clientContextParameters.GetAllParameters(), endpointParameters);
+                if (outcome.IsSuccess())
+                {
+                    m_endpointCache.Put(std::move(cacheKey), outcome.GetResult(), cacheGeneration);
+                }
+                return outcome;
             };
 
             const ClientContextParametersT& GetClientContextParameters() const override
@@ -82,6 +103,7 @@ namespace Aws
             }
             ClientContextParametersT& AccessClientContextParameters() override
             {
+                m_endpointCache.Invalidate();
                 return m_clientContextParameters;
             }
 
@@ -91,12 +113,22 @@ namespace Aws
             }
             BuiltInParametersT& AccessBuiltInParameters()
             {
+                m_endpointCache.Invalidate();
                 return m_builtInParameters;
             }
 
             void OverrideEndpoint(const Aws::String& endpoint) override
             {
                 m_builtInParameters.OverrideEndpoint(endpoint);
+                m_endpointCache.Invalidate();
+            }
+
+            /**
+             * Read-only access to the memoized endpoint resolutions, i.e. to inspect hit/miss counts.
+             */
+            const EndpointResolutionCache& GetEndpointResolutionCache() const
+            {
+                return m_endpointCache;
             }
 
         protected:
@@ -108,6 +140,9 @@ namespace Aws
 
             /* Also known as parameters on the ClientConfiguration in this SDK */
             BuiltInParametersT m_builtInParameters;
+
+            /* Memoized resolutions, disabled unless ClientConfiguration::endpointResolutionCacheSize is set */
+            mutable EndpointResolutionCache m_endpointCache;
         };
 
         /**
@@ -0,0 +1,129 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/ShardedConcurrentCache.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+    } // namespace Utils
+
+    namespace Endpoint
+    {
+        /**
+         * An endpoint address returned by a service endpoint discovery operation (i.e. DescribeEndpoints)
+         * together with the period it may be used for.
+         */
+        struct AWS_CORE_API DiscoveredEndpoint
+        {
+            Aws::String address;
+            std::chrono::minutes cachePeriod;
+        };
+
+        using DiscoverEndpointOutcome = Aws::Utils::Outcome<DiscoveredEndpoint, Aws::Client::AWSError<Aws::Client::CoreErrors>>;
+        using DiscoverEndpointFunction = std::function<DiscoverEndpointOutcome()>;
+        /**
+         * Called before a background refresh is scheduled. Returns an object held by the refresh task until it completes,
+         * or null when no refresh may be started anymore (i.e. the owning client is shutting down).
+         */
+        using RefreshGuardFunction = std::function<std::shared_ptr<void>()>;
+
+        /**
+         * Endpoint discovery cache shared by the operations of a service client.
+         *
+         * Concurrent misses for the same key are coalesced: a single caller invokes the discovery operation
+         * and all other callers wait for and share its outcome.
+         * Once an entry enters the refresh window (the last part of its cache period) the next lookup schedules
+         * a single background refresh on the provided executor and keeps returning the current address,
+         * so requests only block on discovery when no valid address is cached at all. Callers never wait for a
+         * background refresh: if the entry expires before the refresh ran, e.g. because the executor is busy with the
+         * very requests looking the entry up, the next lookup discovers the endpoint itself.
+         * A background refresh calls the discover function after GetOrDiscover returned: the owner of the cache
+         * either sets a refresh guard keeping itself alive until the refresh completes, or must outlive the executor tasks.
+         */
+        class AWS_CORE_API EndpointDiscoveryCache
+        {
+        public:
+            /**
+             * @param size Maximum number of cached keys.
+             * @param refreshAheadRatio Fraction of the cache period after which the entry is refreshed in background.
+             */
+            explicit EndpointDiscoveryCache(size_t size = 1000, double refreshAheadRatio = 0.8);
+
+            EndpointDiscoveryCache(const EndpointDiscoveryCache&) = delete;
+            EndpointDiscoveryCache& operator=(const EndpointDiscoveryCache&) = delete;
+
+            /**
+             * Returns the cached endpoint address for the key, or discovers it using discover.
+             * @param key The endpoint discovery cache key of the operation.
+             * @param discover Function calling the endpoint discovery operation of the service.
+             * @param executor Executor used to refresh entries ahead of their expiration. If null or rejecting the task,
+             *                 the refresh is performed by the calling thread.
+             */
+            DiscoverEndpointOutcome GetOrDiscover(const Aws::String& key,
+                                                  const DiscoverEndpointFunction& discover,
+                                                  Aws::Utils::Threading::Executor* executor = nullptr);
+
+            /**
+             * Sets the guard acquired for each background refresh, see RefreshGuardFunction.
+             * Service clients hold their operation counter in it, so that shutting down the client waits for the refresh
+             * as for any other operation. Must be called before the cache is used.
+             */
+            void SetRefreshGuard(RefreshGuardFunction refreshGuard);
+
+            /**
+             * Adds or replaces a cache entry.
+             */
+            void Put(const Aws::String& key, const Aws::String& address, std::chrono::minutes cachePeriod);
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct CachedEndpoint
+            {
+                Aws::String address;
+                Clock::time_point refreshAt;
+                Clock::time_point expiresAt;
+            };
+
+            void ScheduleRefresh(const Aws::String& key, const CachedEndpoint& current,
+                                 const DiscoverEndpointFunction& discover, Aws::Utils::Threading::Executor* executor);
+            void CompleteDiscovery(const Aws::String& key, const DiscoverEndpointOutcome& outcome, const CachedEndpoint* current);
+            void EndRefresh(const Aws::String& key);
+
+            struct RefreshTask;
+
+            Aws::Utils::ShardedConcurrentCache<Aws::String, CachedEndpoint> m_cache;
+            const double m_refreshAheadRatio;
+            RefreshGuardFunction m_refreshGuard;
+
+            std::mutex m_inFlightMutex;
+            // discoveries made by callers, which concurrent callers wait for
+            Aws::UnorderedMap<Aws::String, std::shared_future<DiscoverEndpointOutcome>> m_inFlight;
+            // keys with a background refresh scheduled, which nobody waits for
+            Aws::UnorderedSet<Aws::String> m_refreshing;
+        };
+    } // namespace Endpoint
+} // namespace Aws
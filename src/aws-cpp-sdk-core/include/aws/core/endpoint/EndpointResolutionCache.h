@@ -0,0 +1,102 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/endpoint/AWSEndpoint.h>
+#include <aws/core/endpoint/EndpointParameter.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <smithy/tracing/Meter.h>
+
+#include <atomic>
+#include <memory>
+
+namespace Aws
+{
+    namespace Endpoint
+    {
+        /**
+         * Bounded, sharded memoization of successful endpoint resolutions.
+         * Entries are keyed on the full set of built-in, client context and request endpoint parameters,
+         * so a lookup never returns an endpoint that was resolved for a different parameter set.
+         * The cache is disabled (every lookup misses and nothing is stored) until Configure() is called with a non-zero size.
+         */
+        class AWS_CORE_API EndpointResolutionCache
+        {
+        public:
+            static const char ENDPOINT_CACHE_HIT_METRIC[];
+            static const char ENDPOINT_CACHE_MISS_METRIC[];
+
+            EndpointResolutionCache() = default;
+            EndpointResolutionCache(const EndpointResolutionCache&) = delete;
+            EndpointResolutionCache& operator=(const EndpointResolutionCache&) = delete;
+
+            /**
+             * (Re)configures the cache and drops all stored entries.
+             * @param maxEntries Upper bound on the number of memoized endpoints, 0 disables the cache.
+             * @param meter Optional meter used to emit hit/miss counters.
+             * Not safe to call concurrently with lookups, intended to be called while the client is initialized.
+             */
+            void Configure(size_t maxEntries, const std::shared_ptr<smithy::components::tracing::Meter>& meter = nullptr);
+
+            inline bool IsEnabled() const { return m_maxEntriesPerShard.load(std::memory_order_relaxed) > 0; }
+
+            /**
+             * Builds the lookup key for a resolution request.
+             */
+            static Aws::String ComputeKey(const EndpointParameters& builtInParameters,
+                                          const EndpointParameters& clientContextParameters,
+                                          const EndpointParameters& endpointParameters);
+
+            /**
+             * Returns a generation token to be passed to Put(). An Invalidate() in between makes the Put() a no-op,
+             * so a resolution racing with a configuration change can not re-populate the cache with a stale endpoint.
+             */
+            inline size_t GetGeneration() const { return m_generation.load(std::memory_order_acquire); }
+
+            /**
+             * Retrieves a memoized endpoint. Records a hit or a miss.
+             */
+            bool Get(const Aws::String& key, AWSEndpoint& endpoint) const;
+
+            /**
+             * Stores a resolved endpoint if the cache has not been invalidated since generation was obtained.
+             * When a shard is full an arbitrary entry of that shard is evicted.
+             */
+            void Put(Aws::String key, const AWSEndpoint& endpoint, size_t generation);
+
+            /**
+             * Drops all memoized endpoints, i.e. on endpoint override or built-in parameters change.
+             */
+            void Invalidate();
+
+            inline size_t GetHitCount() const { return m_hits.load(std::memory_order_relaxed); }
+            inline size_t GetMissCount() const { return m_misses.load(std::memory_order_relaxed); }
+
+        private:
+            static const size_t SHARD_COUNT = 8;
+
+            struct Shard
+            {
+                mutable Aws::Utils::Threading::ReaderWriterLock lock;
+                Aws::UnorderedMap<Aws::String, AWSEndpoint> entries;
+            };
+
+            Shard& GetShard(const Aws::String& key) const;
+
+            mutable Shard m_shards[SHARD_COUNT];
+            std::atomic<size_t> m_maxEntriesPerShard{0};
+            std::atomic<size_t> m_generation{0};
+            mutable std::atomic<size_t> m_hits{0};
+            mutable std::atomic<size_t> m_misses{0};
+            Aws::UniquePtr<smithy::components::tracing::MonotonicCounter> m_hitCounter;
+            Aws::UniquePtr<smithy::components::tracing::MonotonicCounter> m_missCounter;
+        };
+    } // namespace Endpoint
+} // namespace Aws
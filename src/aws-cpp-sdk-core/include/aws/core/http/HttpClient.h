@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <condition_variable>
 
@@ -43,6 +44,25 @@ namespace Aws
                 Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
                 Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+            /**
+             * Callback receiving the response of a request made with MakeRequestAsync().
+             */
+            using HttpResponseHandler = std::function<void(const std::shared_ptr<HttpResponse>&)>;
+
+            /**
+             * Makes an http request and invokes onResponse with the newly allocated HttpResponse.
+             * The default implementation calls MakeRequest(), blocking the calling thread for the network round-trip and
+             * completing on it. Implementations driven by an event loop can override it to return right away and complete
+             * on a thread they own; none of the http clients of the SDK do so yet.
+             */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                HttpResponseHandler&& onResponse,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const
+            {
+                onResponse(MakeRequest(request, readLimiter, writeLimiter));
+            }
+
             /**
              * If yes, the http client supports transfer-encoding:chunked.
              */
@@ -0,0 +1,99 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+
+        /**
+         * CRC32 (ISO-HDLC, as in zlib) and CRC32C (Castagnoli) checksums, the ones used by flexible checksums.
+         *
+         * On x86, CRC32C uses the SSE4.2 crc32 instruction and CRC32 is folded with PCLMULQDQ, both selected at runtime.
+         * On ARM both use the ARMv8 CRC instructions when the build targets them. A table-driven implementation is used otherwise.
+         *
+         * Checksums of adjacent pieces of data can be combined without the data, see CombineCRC32()/CombineCRC32C().
+         * This allows large buffers to be checksummed in parallel, and part checksums to be merged into a full object checksum.
+         */
+        class AWS_CORE_API CrcUtils
+        {
+        public:
+            /**
+             * Chunk size used by the parallel overloads by default.
+             */
+            static const size_t DEFAULT_PARALLEL_CHUNK_SIZE = 4 * 1024 * 1024;
+
+            /**
+             * Returns the CRC32 of length bytes. Pass the checksum of the preceding data as crc to continue it.
+             */
+            static uint32_t CRC32(const unsigned char* data, size_t length, uint32_t crc = 0);
+
+            /**
+             * Returns the CRC32C of length bytes. Pass the checksum of the preceding data as crc to continue it.
+             */
+            static uint32_t CRC32C(const unsigned char* data, size_t length, uint32_t crc = 0);
+
+            /**
+             * Returns the CRC32 of the whole stream, read from its beginning. The stream position is restored afterwards.
+             */
+            static uint32_t CRC32(Aws::IStream& stream);
+
+            /**
+             * Returns the CRC32C of the whole stream, read from its beginning. The stream position is restored afterwards.
+             */
+            static uint32_t CRC32C(Aws::IStream& stream);
+
+            /**
+             * Given crc1, the CRC32 of a first piece of data, and crc2, the CRC32 of the length2 bytes following it,
+             * returns the CRC32 of both pieces together.
+             */
+            static uint32_t CombineCRC32(uint32_t crc1, uint32_t crc2, uint64_t length2);
+
+            /**
+             * CRC32C counterpart of CombineCRC32().
+             */
+            static uint32_t CombineCRC32C(uint32_t crc1, uint32_t crc2, uint64_t length2);
+
+            /**
+             * Computes the CRC32 of length bytes split in chunks of chunkSize bytes, all but the first one checksummed on the executor,
+             * then combines them. Chunks the executor rejects are checksummed on the calling thread, which blocks until all are done.
+             */
+            static uint32_t ParallelCRC32(const unsigned char* data, size_t length, Threading::Executor& executor,
+                                          size_t chunkSize = DEFAULT_PARALLEL_CHUNK_SIZE);
+
+            /**
+             * CRC32C counterpart of ParallelCRC32().
+             */
+            static uint32_t ParallelCRC32C(const unsigned char* data, size_t length, Threading::Executor& executor,
+                                           size_t chunkSize = DEFAULT_PARALLEL_CHUNK_SIZE);
+
+            /**
+             * Returns the checksum as 4 big-endian bytes, the form used by HashResult and in checksum headers once base64 encoded.
+             */
+            static ByteBuffer ToByteBuffer(uint32_t crc);
+
+            /**
+             * Return true when the checksum is computed with dedicated CPU instructions.
+             */
+            static bool IsCRC32HardwareAccelerated();
+            static bool IsCRC32CHardwareAccelerated();
+        };
+
+    } // namespace Utils
+} // namespace Aws
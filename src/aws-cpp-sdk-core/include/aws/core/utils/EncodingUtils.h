@@ -0,0 +1,152 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Instruction set used by the EncodingUtils codecs.
+         */
+        enum class SimdLevel
+        {
+            Scalar,
+            Sse41,
+            Avx2,
+            Neon
+        };
+
+        /**
+         * Base64 (RFC 4648, standard alphabet with padding) and lowercase hex codecs working on caller-provided buffers.
+         *
+         * Bulk data is processed with SSE4.1 or AVX2 on x86 and with NEON on 64-bit ARM, selected at runtime from the CPU features.
+         * Decoding on ARM and the tail of every input use the portable scalar code, which produces identical output.
+         *
+         * Only the HashingUtils overloads working on caller-provided buffers forward to this class. The existing
+         * HashingUtils::Base64Encode, Base64Decode, HexEncode and HexDecode taking a ByteBuffer or a String, and the SDK
+         * code calling them, do not use it.
+         */
+        class AWS_CORE_API EncodingUtils
+        {
+        public:
+            /**
+             * Returns the instruction set currently used.
+             */
+            static SimdLevel GetSimdLevel();
+
+            /**
+             * Restricts the codecs to the given instruction set, e.g. Scalar for benchmarking against the portable code.
+             * Returns false, leaving the level unchanged, when the CPU does not support it.
+             */
+            static bool SetSimdLevel(SimdLevel level);
+
+            static inline size_t Base64EncodedLength(size_t length) { return (length + 2) / 3 * 4; }
+
+            /**
+             * Upper bound of the decoded length, exact for unpadded input whose length is a multiple of 4.
+             */
+            static inline size_t Base64DecodedLength(size_t length) { return (length + 3) / 4 * 3; }
+
+            /**
+             * Encodes length bytes into output, which must hold Base64EncodedLength(length) chars. Returns the number of chars written.
+             */
+            static size_t Base64Encode(const unsigned char* input, size_t length, char* output);
+
+            /**
+             * Decodes length chars into output, which must hold Base64DecodedLength(length) bytes, setting decodedLength to the number of bytes written.
+             * The final group may be padded or not. Returns false on characters outside of the alphabet or misplaced padding.
+             */
+            static bool Base64Decode(const char* input, size_t length, unsigned char* output, size_t& decodedLength);
+
+            static inline size_t HexEncodedLength(size_t length) { return length * 2; }
+
+            /**
+             * Encodes length bytes into output as lowercase hex, output must hold HexEncodedLength(length) chars. Returns the number of chars written.
+             */
+            static size_t HexEncode(const unsigned char* input, size_t length, char* output);
+
+            /**
+             * Decodes length hex chars, of either case, into output which must hold length / 2 bytes.
+             * Returns false on an odd length or on non hex characters.
+             */
+            static bool HexDecode(const char* input, size_t length, unsigned char* output);
+
+            /**
+             * Reads input until its end and writes it base64 encoded to output, in bounded chunks.
+             * Returns false if reading or writing failed.
+             */
+            static bool Base64Encode(Aws::IStream& input, Aws::OStream& output);
+
+            /**
+             * Reads base64 text from input until its end and writes the decoded bytes to output, in bounded chunks.
+             * Returns false on invalid input or if reading or writing failed.
+             */
+            static bool Base64Decode(Aws::IStream& input, Aws::OStream& output);
+
+            /**
+             * Reads input until its end and writes it hex encoded to output, in bounded chunks.
+             * Returns false if reading or writing failed.
+             */
+            static bool HexEncode(Aws::IStream& input, Aws::OStream& output);
+        };
+
+        /**
+         * Incremental base64 encoder for data arriving in chunks of any size, e.g. read from a stream.
+         * Encoded text is appended to the output string given to each call.
+         */
+        class AWS_CORE_API Base64Encoder
+        {
+        public:
+            void Update(const unsigned char* data, size_t length, Aws::String& output);
+
+            /**
+             * Writes the padded final group. The encoder can then be reused for new data.
+             */
+            void Finish(Aws::String& output);
+
+        private:
+            unsigned char m_pending[2] = {};
+            size_t m_pendingLength = 0;
+        };
+
+        /**
+         * Incremental base64 decoder for text arriving in chunks of any size.
+         * Decoded bytes are appended to the output string given to each call, used as a byte buffer.
+         */
+        class AWS_CORE_API Base64Decoder
+        {
+        public:
+            /**
+             * Returns false on invalid input, after which the decoder keeps failing until Reset().
+             */
+            bool Update(const char* data, size_t length, Aws::String& output);
+
+            /**
+             * Decodes the final group when it was not padded. Returns false if the input ended mid-group or was invalid.
+             */
+            bool Finish(Aws::String& output);
+
+            void Reset();
+
+        private:
+            bool DecodeGroups(const char* data, size_t length, Aws::String& output);
+
+            char m_pending[3] = {};
+            size_t m_pendingLength = 0;
+            bool m_padded = false;
+            bool m_failed = false;
+        };
+
+    } // namespace Utils
+} // namespace Aws
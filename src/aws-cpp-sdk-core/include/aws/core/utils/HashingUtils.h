@@ -10,6 +10,7 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
+#include <aws/core/utils/EncodingUtils.h>
 
 namespace Aws
 {
@@ -42,6 +43,30 @@ namespace Aws
             */
             static ByteBuffer HexDecode(const Aws::String& str);
 
+            /**
+            * Base64 encodes into a caller-provided buffer of EncodingUtils::Base64EncodedLength(length) chars, returns the number of chars written.
+            * See EncodingUtils for this and the following overloads.
+            */
+            static inline size_t Base64Encode(const unsigned char* data, size_t length, char* output) { return EncodingUtils::Base64Encode(data, length, output); }
+
+            /**
+            * Base64 decodes into a caller-provided buffer of EncodingUtils::Base64DecodedLength(length) bytes, returns false on invalid input.
+            */
+            static inline bool Base64Decode(const char* data, size_t length, unsigned char* output, size_t& decodedLength)
+            {
+                return EncodingUtils::Base64Decode(data, length, output, decodedLength);
+            }
+
+            /**
+            * Hex encodes into a caller-provided buffer of 2 * length chars, returns the number of chars written.
+            */
+            static inline size_t HexEncode(const unsigned char* data, size_t length, char* output) { return EncodingUtils::HexEncode(data, length, output); }
+
+            /**
+            * Hex decodes into a caller-provided buffer of length / 2 bytes, returns false on invalid input.
+            */
+            static inline bool HexDecode(const char* data, size_t length, unsigned char* output) { return EncodingUtils::HexDecode(data, length, output); }
+
             /**
             * Calculates a SHA256 HMAC digest (not hex encoded)
             */
@@ -0,0 +1,333 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * In-memory fixed-size cache safe for concurrent use, a drop-in replacement of ConcurrentCache for hot paths.
+         *
+         * Keys are hashed to one of a fixed number of shards, each with its own lock, so operations on different shards
+         * do not contend. Lookups only take the shard's reader lock.
+         * When a shard is full, the entry to evict is chosen with the CLOCK algorithm (an approximation of LRU):
+         * a hand sweeps the entries, evicting the first one which is expired or was not read since the hand last passed,
+         * making eviction amortized O(1) instead of scanning the whole cache.
+         * Expiration uses the steady clock, so it is not affected by changes of the system time.
+         */
+        template <typename TKey, typename TValue, typename THash = std::hash<TKey>>
+        class ShardedConcurrentCache
+        {
+        public:
+            /**
+             * @param size Maximum number of entries, split evenly across the shards.
+             * @param shardCount Number of shards, rounded up to a power of 2.
+             */
+            explicit ShardedConcurrentCache(size_t size = 1000, size_t shardCount = 16) : m_shardMask(0)
+            {
+                size_t shards = 1;
+                while (shards < shardCount && shards < size)
+                {
+                    shards <<= 1;
+                }
+                m_shardMask = shards - 1;
+                const size_t shardCapacity = (size + shards - 1) / shards;
+                m_shards.reserve(shards);
+                for (size_t i = 0; i < shards; ++i)
+                {
+                    m_shards.emplace_back(Aws::MakeUnique<Shard>("ShardedConcurrentCache", shardCapacity > 0 ? shardCapacity : 1));
+                }
+            }
+
+            ShardedConcurrentCache(const ShardedConcurrentCache&) = delete;
+            ShardedConcurrentCache& operator=(const ShardedConcurrentCache&) = delete;
+
+            /**
+             * Retrieves the value associated with the given key if it exists and is not expired and returns true.
+             * Otherwise, returns false.
+             */
+            bool Get(const TKey& key, TValue& value) const
+            {
+                const Shard& shard = GetShard(key);
+                Aws::Utils::Threading::ReaderLockGuard guard(shard.lock);
+                return shard.Get(key, value, Clock::now());
+            }
+
+            /**
+             * Adds or updates a cache entry, which expires after duration.
+             * When the key's shard is full, an expired or not recently read entry of that shard is evicted.
+             */
+            template<typename UValue>
+            void Put(const TKey& key, UValue&& val, std::chrono::milliseconds duration)
+            {
+                Shard& shard = GetShard(key);
+                Aws::Utils::Threading::WriterLockGuard guard(shard.lock);
+                shard.Put(key, std::forward<UValue>(val), Clock::now() + duration);
+            }
+
+            /**
+             * Removes the entry of key, if any.
+             */
+            void Remove(const TKey& key)
+            {
+                Shard& shard = GetShard(key);
+                Aws::Utils::Threading::WriterLockGuard guard(shard.lock);
+                shard.Remove(key);
+            }
+
+            /**
+             * Retrieves the value of key, computing it with compute(value) when it is missing or expired.
+             * compute returns false on failure, the value is then not cached.
+             *
+             * Concurrent misses on the same key are coalesced: only one caller runs compute, the other ones wait and
+             * get its result (or failure). compute is called without holding any lock of the cache.
+             *
+             * @return true if value was set from the cache or by compute.
+             */
+            template<typename ComputeT>
+            bool GetOrCompute(const TKey& key, TValue& value, ComputeT&& compute, std::chrono::milliseconds duration)
+            {
+                Shard& shard = GetShard(key);
+                {
+                    Aws::Utils::Threading::ReaderLockGuard guard(shard.lock);
+                    if (shard.Get(key, value, Clock::now()))
+                    {
+                        return true;
+                    }
+                }
+
+                std::shared_ptr<InFlight> inFlight;
+                bool leader = false;
+                {
+                    std::lock_guard<std::mutex> locker(shard.inFlightMutex);
+                    auto it = shard.inFlight.find(key);
+                    if (it != shard.inFlight.end())
+                    {
+                        inFlight = it->second;
+                    }
+                    else
+                    {
+                        // a computation may have completed between the lookup above and taking the mutex
+                        Aws::Utils::Threading::ReaderLockGuard guard(shard.lock);
+                        if (shard.Get(key, value, Clock::now()))
+                        {
+                            return true;
+                        }
+                        inFlight = Aws::MakeShared<InFlight>("ShardedConcurrentCache");
+                        shard.inFlight.emplace(key, inFlight);
+                        leader = true;
+                    }
+                }
+
+                if (!leader)
+                {
+                    std::unique_lock<std::mutex> locker(inFlight->mutex);
+                    inFlight->done.wait(locker, [&]() { return inFlight->completed; });
+                    if (inFlight->succeeded)
+                    {
+                        value = inFlight->value;
+                    }
+                    return inFlight->succeeded;
+                }
+
+                const bool succeeded = compute(value);
+                if (succeeded)
+                {
+                    Put(key, value, duration);
+                }
+                {
+                    std::lock_guard<std::mutex> locker(shard.inFlightMutex);
+                    shard.inFlight.erase(key);
+                }
+                {
+                    std::lock_guard<std::mutex> locker(inFlight->mutex);
+                    if (succeeded)
+                    {
+                        inFlight->value = value;
+                    }
+                    inFlight->succeeded = succeeded;
+                    inFlight->completed = true;
+                }
+                inFlight->done.notify_all();
+                return succeeded;
+            }
+
+            /**
+             * Number of entries, including expired ones which were not evicted yet.
+             */
+            size_t Size() const
+            {
+                size_t size = 0;
+                for (const auto& shard : m_shards)
+                {
+                    Aws::Utils::Threading::ReaderLockGuard guard(shard->lock);
+                    size += shard->entries.size();
+                }
+                return size;
+            }
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct Entry
+            {
+                template<typename UValue>
+                Entry(UValue&& val, Clock::time_point expires, size_t slot) :
+                    value(std::forward<UValue>(val)), expiration(expires), referenced(false), clockSlot(slot)
+                {
+                }
+
+                TValue value;
+                Clock::time_point expiration;
+                // set by readers under the reader lock, cleared by the clock hand under the writer lock
+                mutable std::atomic<bool> referenced;
+                size_t clockSlot;
+            };
+
+            using EntryMap = std::unordered_map<TKey, Entry, THash, std::equal_to<TKey>, Aws::Allocator<std::pair<const TKey, Entry>>>;
+
+            struct InFlight
+            {
+                std::mutex mutex;
+                std::condition_variable done;
+                bool completed = false;
+                bool succeeded = false;
+                TValue value;
+            };
+
+            struct Shard
+            {
+                explicit Shard(size_t maxSize) : capacity(maxSize), hand(0)
+                {
+                    entries.reserve(capacity);
+                    clock.reserve(capacity);
+                }
+
+                bool Get(const TKey& key, TValue& value, Clock::time_point now) const
+                {
+                    auto it = entries.find(key);
+                    if (it == entries.end() || now > it->second.expiration)
+                    {
+                        return false;
+                    }
+                    if (!it->second.referenced.load(std::memory_order_relaxed))
+                    {
+                        it->second.referenced.store(true, std::memory_order_relaxed);
+                    }
+                    value = it->second.value;
+                    return true;
+                }
+
+                template<typename UValue>
+                void Put(const TKey& key, UValue&& val, Clock::time_point expiration)
+                {
+                    auto it = entries.find(key);
+                    if (it != entries.end())
+                    {
+                        it->second.value = std::forward<UValue>(val);
+                        it->second.expiration = expiration;
+                        return;
+                    }
+
+                    size_t slot = clock.size();
+                    if (slot >= capacity)
+                    {
+                        slot = Evict();
+                    }
+                    auto inserted = entries.emplace(std::piecewise_construct,
+                                                    std::forward_as_tuple(key),
+                                                    std::forward_as_tuple(std::forward<UValue>(val), expiration, slot));
+                    if (slot == clock.size())
+                    {
+                        clock.push_back(&*inserted.first);
+                    }
+                    else
+                    {
+                        clock[slot] = &*inserted.first;
+                    }
+                }
+
+                void Remove(const TKey& key)
+                {
+                    auto it = entries.find(key);
+                    if (it == entries.end())
+                    {
+                        return;
+                    }
+                    const size_t slot = it->second.clockSlot;
+                    clock[slot] = clock.back();
+                    clock[slot]->second.clockSlot = slot;
+                    clock.pop_back();
+                    if (hand >= clock.size())
+                    {
+                        hand = 0;
+                    }
+                    entries.erase(it);
+                }
+
+                /**
+                 * Evicts an entry and returns its clock slot. The hand passes each entry at most twice.
+                 */
+                size_t Evict()
+                {
+                    const Clock::time_point now = Clock::now();
+                    for (size_t step = 0; step < 2 * clock.size(); ++step)
+                    {
+                        Entry& entry = clock[hand]->second;
+                        if (now <= entry.expiration && entry.referenced.load(std::memory_order_relaxed))
+                        {
+                            entry.referenced.store(false, std::memory_order_relaxed);
+                            hand = (hand + 1) % clock.size();
+                            continue;
+                        }
+                        break;
+                    }
+                    const size_t slot = hand;
+                    entries.erase(entries.find(clock[slot]->first));
+                    hand = (hand + 1) % clock.size();
+                    return slot;
+                }
+
+                const size_t capacity;
+                EntryMap entries;
+                // entries in clock order, the hand points to the next eviction candidate
+                Aws::Vector<typename EntryMap::value_type*> clock;
+                size_t hand;
+                mutable Aws::Utils::Threading::ReaderWriterLock lock;
+
+                std::mutex inFlightMutex;
+                std::unordered_map<TKey, std::shared_ptr<InFlight>, THash, std::equal_to<TKey>,
+                                   Aws::Allocator<std::pair<const TKey, std::shared_ptr<InFlight>>>> inFlight;
+            };
+
+            Shard& GetShard(const TKey& key) const
+            {
+                // mix the high bits in, std::hash is the identity for integers on common implementations
+                size_t hash = THash()(key);
+                hash ^= hash >> 16;
+                return *m_shards[hash & m_shardMask];
+            }
+
+            Aws::Vector<Aws::UniquePtr<Shard>> m_shards;
+            size_t m_shardMask;
+        };
+    }
+}
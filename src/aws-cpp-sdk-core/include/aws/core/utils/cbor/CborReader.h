@@ -0,0 +1,175 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstdint>
+#include <streambuf>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Cbor
+        {
+            enum class CborToken
+            {
+                None,
+                StartMap,
+                EndMap,
+                StartArray,
+                EndArray,
+                Key,
+                String,
+                Bytes,
+                Integer,
+                Float,
+                Bool,
+                Null,
+                End,
+                Error
+            };
+
+            /**
+             * Forward-only pull parser reading CBOR (RFC 8949) data items directly from a stream, the counterpart of
+             * Aws::Utils::Json::JsonReader: the document is consumed one token at a time and only the current key,
+             * string or byte string is buffered.
+             *
+             * Definite and indefinite length containers and strings are both supported, and map keys must be text strings.
+             * Tags are not tokens of their own: the tag of the current value, e.g. 1 for epoch-based timestamps, is
+             * available from GetTag(). Undefined is reported as Null.
+             *
+             * Typical use, for a reader positioned on the StartMap token of a structure:
+             *
+             *     while (reader.NextMember())
+             *     {
+             *         const Aws::String& name = reader.GetString();
+             *         reader.Next(); // positions the reader on the member value
+             *         ...            // either consume the value or call reader.SkipValue()
+             *     }
+             *
+             * Any malformed input moves the reader to the Error token, which it then never leaves.
+             */
+            class AWS_CORE_API CborReader
+            {
+            public:
+                static const uint64_t NO_TAG = ~static_cast<uint64_t>(0);
+
+                /**
+                 * The stream must outlive the reader.
+                 */
+                explicit CborReader(Aws::IStream& input);
+
+                CborReader(const CborReader&) = delete;
+                CborReader& operator=(const CborReader&) = delete;
+
+                /**
+                 * Advances to the next token and returns it.
+                 * End is returned once the top level data item has been consumed.
+                 */
+                CborToken Next();
+
+                /**
+                 * Returns the current token.
+                 */
+                inline CborToken GetToken() const { return m_token; }
+
+                /**
+                 * Advances within a map. Returns true when positioned on the next key,
+                 * false on the closing EndMap or on error.
+                 */
+                inline bool NextMember() { return Next() == CborToken::Key; }
+
+                /**
+                 * Advances within an array. Returns true when positioned on the first token of the next element,
+                 * false on the closing EndArray or on error.
+                 */
+                inline bool NextElement()
+                {
+                    const CborToken token = Next();
+                    return token != CborToken::EndArray && token != CborToken::Error && token != CborToken::End;
+                }
+
+                /**
+                 * Skips the value starting at the current token, including all nested entries or elements.
+                 * Returns false on error.
+                 */
+                bool SkipValue();
+
+                /**
+                 * Content of the current Key, String or Bytes token.
+                 */
+                inline const Aws::String& GetString() const { return m_text; }
+
+                /**
+                 * Moves out the content of the current Key or String token, avoiding a copy for large values.
+                 */
+                inline Aws::String TakeString() { return std::move(m_text); }
+
+                /**
+                 * Content of the current Bytes token, or of a String token, empty for other tokens.
+                 */
+                ByteBuffer GetBytes() const;
+
+                /**
+                 * Value of the current Integer or Float token, converted as needed, 0 or false for other token types.
+                 */
+                int GetInteger() const;
+                long long GetInt64() const;
+                double GetDouble() const;
+                inline bool GetBool() const { return m_token == CborToken::Bool && m_boolValue; }
+
+                /**
+                 * Tag of the current value, NO_TAG if it has none. Nested tags report the innermost one.
+                 */
+                inline uint64_t GetTag() const { return m_tag; }
+
+                /**
+                 * Returns false once malformed input was encountered.
+                 */
+                inline bool WasParseSuccessful() const { return m_token != CborToken::Error; }
+
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                struct Container
+                {
+                    bool isMap;
+                    bool indefinite;
+                    // data items of a definite length container, keys and values both count for maps
+                    uint64_t itemCount;
+                    uint64_t itemsRead;
+                };
+
+                CborToken ReadItem(int initialByte, bool isKey);
+                bool ReadArgument(int additionalInformation, uint64_t& argument);
+                bool ReadString(int majorType, int additionalInformation);
+                bool ReadBytes(uint64_t length);
+                CborToken ReadSimpleValue(int additionalInformation);
+                CborToken Fail(const char* message);
+
+                std::streambuf* m_input;
+                CborToken m_token = CborToken::None;
+                bool m_boolValue = false;
+                bool m_negative = false;
+                uint64_t m_integerValue = 0;
+                double m_floatValue = 0.0;
+                uint64_t m_tag = NO_TAG;
+                Aws::String m_text;
+                Aws::Vector<Container> m_containers;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Cbor
+    } // namespace Utils
+} // namespace Aws
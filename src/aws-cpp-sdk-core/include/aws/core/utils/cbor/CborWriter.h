@@ -0,0 +1,110 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        class DateTime;
+
+        namespace Cbor
+        {
+            /**
+             * Forward-only CBOR (RFC 8949) writer appending encoded data items directly into a caller-provided string,
+             * used as a byte buffer. Binary values are written as raw byte strings, unlike JSON which needs them base64 encoded.
+             * The output string is appended to, not cleared, so a single buffer can be reused across payloads.
+             *
+             * Maps and arrays are written with an indefinite length by StartMap()/StartArray(), and must then be closed
+             * by EndMap()/EndArray(), or with a definite length when the number of entries is known up front, in which case
+             * they are closed implicitly after their last entry.
+             *
+             * The writer does not validate the structure it is asked to produce,
+             * every Key() must be followed by exactly one value.
+             */
+            class AWS_CORE_API CborWriter
+            {
+            public:
+                explicit CborWriter(Aws::String& output) : m_output(output) {}
+
+                CborWriter(const CborWriter&) = delete;
+                CborWriter& operator=(const CborWriter&) = delete;
+
+                CborWriter& StartMap();
+                CborWriter& StartMap(size_t pairCount);
+                CborWriter& EndMap();
+                CborWriter& StartArray();
+                CborWriter& StartArray(size_t elementCount);
+                CborWriter& EndArray();
+
+                /**
+                 * Writes a map key, as a text string. Must be followed by a value.
+                 */
+                inline CborWriter& Key(const char* key, size_t length) { return AsString(key, length); }
+                inline CborWriter& Key(const char* key) { return AsString(key, std::strlen(key)); }
+                inline CborWriter& Key(const Aws::String& key) { return AsString(key.c_str(), key.size()); }
+
+                CborWriter& AsString(const char* value, size_t length);
+                inline CborWriter& AsString(const char* value) { return AsString(value, std::strlen(value)); }
+                inline CborWriter& AsString(const Aws::String& value) { return AsString(value.c_str(), value.size()); }
+
+                CborWriter& AsBytes(const unsigned char* value, size_t length);
+                inline CborWriter& AsBytes(const ByteBuffer& value) { return AsBytes(value.GetUnderlyingData(), value.GetLength()); }
+
+                CborWriter& AsBool(bool value);
+                inline CborWriter& AsInteger(int value) { return AsInt64(value); }
+                CborWriter& AsInt64(long long value);
+                /**
+                 * Writes a single precision float when it represents the value exactly, a double otherwise.
+                 */
+                CborWriter& AsDouble(double value);
+                CborWriter& AsNull();
+
+                /**
+                 * Writes an epoch-based date/time (tag 1), in whole seconds when possible.
+                 */
+                CborWriter& AsTimestamp(const DateTime& value);
+
+                /*
+                 * Shorthands for map entries, named after their JsonWriter counterparts.
+                 */
+                template<typename KeyT, typename ValueT>
+                inline CborWriter& WithString(const KeyT& key, const ValueT& value) { return Key(key).AsString(value); }
+                template<typename KeyT>
+                inline CborWriter& WithBytes(const KeyT& key, const ByteBuffer& value) { return Key(key).AsBytes(value); }
+                template<typename KeyT>
+                inline CborWriter& WithBool(const KeyT& key, bool value) { return Key(key).AsBool(value); }
+                template<typename KeyT>
+                inline CborWriter& WithInteger(const KeyT& key, int value) { return Key(key).AsInteger(value); }
+                template<typename KeyT>
+                inline CborWriter& WithInt64(const KeyT& key, long long value) { return Key(key).AsInt64(value); }
+                template<typename KeyT>
+                inline CborWriter& WithDouble(const KeyT& key, double value) { return Key(key).AsDouble(value); }
+                template<typename KeyT>
+                inline CborWriter& WithTimestamp(const KeyT& key, const DateTime& value) { return Key(key).AsTimestamp(value); }
+
+                /**
+                 * Returns the number of bytes written to the output so far, including any content it had before.
+                 */
+                inline size_t GetLength() const { return m_output.size(); }
+
+            private:
+                void WriteHead(uint8_t majorType, uint64_t argument);
+
+                Aws::String& m_output;
+            };
+
+        } // namespace Cbor
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,127 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+
+        namespace Crypto
+        {
+            /**
+             * Computes the SHA256 tree hash of Glacier archives and parts (1 MiB leaves, see
+             * http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html) together with the linear SHA256
+             * of the same payload, in a single pass over the data.
+             *
+             * Full leaves are hashed on the executor while more data is fed, and the tree is reduced as leaves complete,
+             * so only the hashes of O(log n) subtrees are kept. Without an executor, or for leaves it rejects, leaves are hashed
+             * on the calling thread. Update() blocks while maxLeavesInFlight leaves are waiting to be hashed, which bounds memory
+             * to that many leaf buffers; it must not be called from a thread of the executor itself.
+             *
+             * An instance is not thread safe, it is meant to be fed by one thread.
+             */
+            class AWS_CORE_API Sha256TreeHasher
+            {
+            public:
+                static const size_t LEAF_SIZE = 1024 * 1024;
+                static const size_t DEFAULT_MAX_LEAVES_IN_FLIGHT = 64;
+
+                struct Result
+                {
+                    /**
+                     * The tree hash, as sent hex encoded in x-amz-sha256-tree-hash.
+                     */
+                    ByteBuffer treeHash;
+
+                    /**
+                     * The SHA256 of the payload, as sent hex encoded in x-amz-content-sha256.
+                     */
+                    ByteBuffer payloadHash;
+                };
+
+                explicit Sha256TreeHasher(Threading::Executor* executor = nullptr, size_t maxLeavesInFlight = DEFAULT_MAX_LEAVES_IN_FLIGHT);
+
+                /**
+                 * Waits for the leaves still being hashed.
+                 */
+                ~Sha256TreeHasher();
+
+                Sha256TreeHasher(const Sha256TreeHasher&) = delete;
+                Sha256TreeHasher& operator=(const Sha256TreeHasher&) = delete;
+
+                void Update(const unsigned char* data, size_t length);
+
+                /**
+                 * Feeds stream from its current position until its end, reading directly into leaf buffers.
+                 * Returns false if reading failed before the end of the stream.
+                 */
+                bool Update(Aws::IStream& stream);
+
+                /**
+                 * Waits for all leaves and returns both hashes. Empty input hashes as SHA256 of the empty string.
+                 * The hasher is then reset and can be used for new data.
+                 */
+                Result Finalize();
+
+                /**
+                 * Hashes the whole stream, read from its beginning, with leaves hashed on executor.
+                 * The stream position is restored afterwards. Both hashes are empty if reading failed.
+                 */
+                static Result Calculate(Aws::IStream& stream, Threading::Executor& executor,
+                                        size_t maxLeavesInFlight = DEFAULT_MAX_LEAVES_IN_FLIGHT);
+
+            private:
+                struct Subtree
+                {
+                    size_t level;
+                    ByteBuffer hash;
+                };
+
+                std::shared_ptr<ByteBuffer> AcquireLeafBuffer();
+                void SubmitLeaf();
+                void HashLeaf(size_t index, const std::shared_ptr<ByteBuffer>& leaf, size_t length);
+                void ReduceCompletedLeaves();
+                void WaitForLeaves();
+                void Reset();
+
+                Threading::Executor* m_executor;
+                size_t m_maxLeavesInFlight;
+                std::shared_ptr<Sha256> m_payloadHash;
+
+                std::shared_ptr<ByteBuffer> m_leaf;
+                size_t m_leafLength;
+                size_t m_leafCount;
+
+                // guarded by m_mutex, leaves complete out of order on the executor threads
+                std::mutex m_mutex;
+                std::condition_variable m_leafHashed;
+                size_t m_leavesInFlight;
+                size_t m_nextLeafToReduce;
+                Aws::Map<size_t, ByteBuffer> m_completedLeaves;
+                Aws::Vector<Subtree> m_subtrees;
+                Aws::Vector<std::shared_ptr<ByteBuffer>> m_freeLeaves;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
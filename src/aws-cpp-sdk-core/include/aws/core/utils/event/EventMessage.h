@@ -45,12 +45,29 @@ namespace Aws
                     TEXT_PLAIN
                 };
 
+                /**
+                 * Headers which handlers look up on every message, indexed by EventStreamHandler when received.
+                 */
+                enum class KnownHeader
+                {
+                    EVENT_TYPE,
+                    MESSAGE_TYPE,
+                    CONTENT_TYPE,
+                    ERROR_CODE,
+                    ERROR_MESSAGE,
+                    EXCEPTION_TYPE,
+                    UNKNOWN
+                };
+
                 static MessageType GetMessageTypeForName(const Aws::String& name);
+                static MessageType GetMessageTypeForName(const char* name, size_t length);
                 static Aws::String GetNameForMessageType(MessageType value);
 
                 static ContentType GetContentTypeForName(const Aws::String& name);
                 static Aws::String GetNameForContentType(ContentType value);
 
+                static KnownHeader GetKnownHeaderForName(const char* name, size_t length);
+
 
                 /**
                  * Clean up the message, including the metadata, headers and payload received.
@@ -59,11 +76,15 @@ namespace Aws
 
                 /**
                  * Get/set the total length of this message: prelude(8 bytes) + prelude CRC(4 bytes) + Data(headers length + payload length) + message CRC(4 bytes).
+                 * Unless reservePayload is false, the payload storage is grown to hold the message.
                  */
-                inline void SetTotalLength(size_t length)
+                inline void SetTotalLength(size_t length, bool reservePayload = true)
                 {
                     m_totalLength = length;
-                    m_eventPayload.reserve(length);
+                    if (reservePayload)
+                    {
+                        m_eventPayload.reserve(length);
+                    }
                 }
 
                 inline size_t GetTotalLength() const { return m_totalLength; }
@@ -83,10 +104,11 @@ namespace Aws
 
                 /**
                  * Set/get event headers.
+                 * Returns the value stored for headerName, which stays valid until Reset().
                  */
-                inline void InsertEventHeader(const Aws::String& headerName, const EventHeaderValue& eventHeaderValue)
+                inline const EventHeaderValue& InsertEventHeader(const Aws::String& headerName, const EventHeaderValue& eventHeaderValue)
                 {
-                    m_eventHeaders.emplace(Aws::Utils::Event::EventHeaderValuePair(headerName, eventHeaderValue));
+                    return m_eventHeaders.emplace(Aws::Utils::Event::EventHeaderValuePair(headerName, eventHeaderValue)).first->second;
                 }
 
                 inline const Aws::Utils::Event::EventHeaderValueCollection& GetEventHeaders() const { return m_eventHeaders; }
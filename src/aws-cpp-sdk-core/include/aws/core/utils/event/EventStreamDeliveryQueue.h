@@ -0,0 +1,140 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/event/EventStreamHandler.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <smithy/tracing/Meter.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        }
+
+        namespace Event
+        {
+            extern AWS_CORE_API const size_t DEFAULT_EVENT_QUEUE_CAPACITY;
+            extern AWS_CORE_API const char EVENT_STREAM_QUEUE_DEPTH_METRIC[];
+            extern AWS_CORE_API const char EVENT_STREAM_EVENT_LAG_METRIC[];
+
+            /**
+             * Event stream handler which decouples decoding from event handling.
+             *
+             * Set as the handler of an EventStreamDecoder in place of handler: each decoded message is moved into a
+             * bounded queue, and replayed to handler on executor, in order and one at a time, so a slow handler does not
+             * run on the thread reading the response.
+             * When the queue is full, OnEvent() blocks the decoding thread until handler catches up: the response is not
+             * read any further, which applies TCP flow control to the connection instead of buffering without bound.
+             *
+             * The decoding thread therefore waits on tasks queued to the executor: the executor must not be one whose threads
+             * may all be busy with work waiting on this queue, such as the bounded executor of the client running the request
+             * (i.e. an async call of the operation), or the deliveries never start and the stream deadlocks. Without an executor,
+             * the queue uses a dedicated thread of its own.
+             */
+            class AWS_CORE_API EventStreamDeliveryQueue : public EventStreamHandler
+            {
+            public:
+                /**
+                 * @param handler Receives the events, must outlive the queue.
+                 * @param executor Runs the deliveries to handler, null for a dedicated thread. Must not run the request itself.
+                 * @param capacity Maximum number of events decoded but not delivered yet.
+                 */
+                EventStreamDeliveryQueue(EventStreamHandler& handler,
+                                         const std::shared_ptr<Aws::Utils::Threading::Executor>& executor = nullptr,
+                                         size_t capacity = DEFAULT_EVENT_QUEUE_CAPACITY);
+
+                /**
+                 * Waits for the events already queued to be delivered.
+                 */
+                ~EventStreamDeliveryQueue();
+
+                EventStreamDeliveryQueue(const EventStreamDeliveryQueue&) = delete;
+                EventStreamDeliveryQueue& operator=(const EventStreamDeliveryQueue&) = delete;
+
+                /**
+                 * Reports the queue depth and the event lag (EVENT_STREAM_QUEUE_DEPTH_METRIC and
+                 * EVENT_STREAM_EVENT_LAG_METRIC) as gauges of meter, until the queue is destroyed.
+                 */
+                void RegisterMetrics(const smithy::components::tracing::Meter& meter,
+                                     const Aws::Map<Aws::String, Aws::String>& attributes = {});
+
+                /**
+                 * The executor running the deliveries.
+                 */
+                inline const std::shared_ptr<Aws::Utils::Threading::Executor>& GetExecutor() const { return m_executor; }
+
+                /**
+                 * Number of events decoded but not delivered yet.
+                 */
+                size_t GetDepth() const;
+
+                /**
+                 * Time spent in the queue by the oldest event not delivered yet, zero when the queue is empty.
+                 */
+                std::chrono::microseconds GetLag() const;
+
+                /**
+                 * Blocks until every event queued so far is delivered.
+                 */
+                void WaitUntilDrained();
+
+                void Reset() override;
+                void SetMessageMetadata(size_t totalLength, size_t headersLength, size_t payloadLength) override;
+                bool IsMessageCompleted() override;
+                void WriteMessageEventPayload(const unsigned char* data, size_t dataLength) override;
+                void InsertMessageEventHeader(const Aws::String& eventHeaderName, size_t eventHeaderLength, const EventHeaderValue& eventHeaderValue) override;
+                void OnEvent() override;
+
+            private:
+                struct QueuedHeader
+                {
+                    Aws::String name;
+                    size_t length;
+                    EventHeaderValue value;
+                };
+
+                struct QueuedEvent
+                {
+                    size_t totalLength = 0;
+                    size_t headersLength = 0;
+                    size_t payloadLength = 0;
+                    size_t headersBytesReceived = 0;
+                    Aws::Vector<QueuedHeader> headers;
+                    Aws::Vector<unsigned char> payload;
+                    bool failed = false;
+                    EventStreamErrors internalError = EventStreamErrors::EVENT_STREAM_NO_ERROR;
+                    std::chrono::steady_clock::time_point enqueued;
+                };
+
+                void DeliverQueuedEvents();
+                void Deliver(QueuedEvent& event);
+
+                EventStreamHandler& m_handler;
+                std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
+                const size_t m_capacity;
+                // message being decoded, only accessed by the decoding thread
+                QueuedEvent m_pending;
+
+                mutable std::mutex m_lock;
+                std::condition_variable m_signal;
+                Aws::Deque<QueuedEvent> m_queue;
+                bool m_delivering;
+                Aws::Vector<Aws::UniquePtr<smithy::components::tracing::GaugeHandle>> m_gauges;
+            };
+        }
+    }
+}
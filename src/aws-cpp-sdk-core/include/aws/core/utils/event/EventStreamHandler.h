@@ -13,7 +13,9 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 
 namespace Aws
 {
@@ -29,7 +31,8 @@ namespace Aws
             {
             public:
                 EventStreamHandler() :
-                    m_failure(false), m_internalError(EventStreamErrors::EVENT_STREAM_NO_ERROR), m_headersBytesReceived(0), m_payloadBytesReceived(0), m_message()
+                    m_failure(false), m_internalError(EventStreamErrors::EVENT_STREAM_NO_ERROR), m_headersBytesReceived(0), m_payloadBytesReceived(0), m_message(),
+                    m_borrowPayload(false), m_borrowedPayload(nullptr), m_knownHeaders()
                 {}
 
                 virtual ~EventStreamHandler() = default;
@@ -53,10 +56,22 @@ namespace Aws
                     m_internalError = EventStreamErrors::EVENT_STREAM_NO_ERROR;
                     m_headersBytesReceived = 0;
                     m_payloadBytesReceived = 0;
+                    m_borrowedPayload = nullptr;
+                    std::fill(std::begin(m_knownHeaders), std::end(m_knownHeaders), nullptr);
 
                     m_message.Reset();
                 }
 
+                /**
+                 * When enabled, a payload received in a single segment (the common case) is not copied: the handler refers to
+                 * the decoder's input buffer, which is only valid until OnEvent() returns. Use GetEventPayloadData() and
+                 * GetEventPayloadLength() to read it in place, the other accessors copy it.
+                 * Payloads split across several segments are still accumulated, in storage reused from one message to the next.
+                 * Disabled by default.
+                 */
+                inline void SetPayloadBorrowing(bool enabled) { m_borrowPayload = enabled; }
+                inline bool IsPayloadBorrowing() const { return m_borrowPayload; }
+
                 /**
                  * Set internal Event Stream Errors, which is associated with errors in aws-c-event-stream library.
                  */
@@ -89,7 +104,7 @@ namespace Aws
                  */
                 inline virtual void SetMessageMetadata(size_t totalLength, size_t headersLength, size_t payloadLength)
                 {
-                    m_message.SetTotalLength(totalLength);
+                    m_message.SetTotalLength(totalLength, !m_borrowPayload);
                     m_message.SetHeadersLength(headersLength);
                     m_message.SetPayloadLength(payloadLength);
                     assert(totalLength == 12/*prelude length*/ + headersLength + payloadLength + 4/*message crc length*/);
@@ -104,31 +119,91 @@ namespace Aws
                  */
                 inline virtual void WriteMessageEventPayload(const unsigned char* data, size_t dataLength)
                 {
-                    m_message.WriteEventPayload(data, dataLength);
+                    if (m_borrowPayload && m_payloadBytesReceived == 0 && dataLength == m_message.GetPayloadLength())
+                    {
+                        m_borrowedPayload = data;
+                    }
+                    else
+                    {
+                        m_message.WriteEventPayload(data, dataLength);
+                    }
                     m_payloadBytesReceived += dataLength;
                 }
-                
+
                 /**
                  * Get underlying byte array of the message just received.
                  */
-                inline virtual Aws::Vector<unsigned char>&& GetEventPayloadWithOwnership() { return m_message.GetEventPayloadWithOwnership(); }
+                inline virtual Aws::Vector<unsigned char>&& GetEventPayloadWithOwnership()
+                {
+                    CopyBorrowedPayload();
+                    return m_message.GetEventPayloadWithOwnership();
+                }
 
                 /**
                  * Convert underlying byte array to string without transferring ownership.
                  */
-                inline virtual Aws::String GetEventPayloadAsString() { return m_message.GetEventPayloadAsString(); }
+                inline virtual Aws::String GetEventPayloadAsString()
+                {
+                    if (m_borrowedPayload)
+                    {
+                        return Aws::String(reinterpret_cast<const char*>(m_borrowedPayload), m_payloadBytesReceived);
+                    }
+                    return m_message.GetEventPayloadAsString();
+                }
+
+                /**
+                 * The payload of the message just received, without copying or transferring ownership.
+                 * Valid until OnEvent() returns.
+                 */
+                inline const unsigned char* GetEventPayloadData() const
+                {
+                    return m_borrowedPayload ? m_borrowedPayload : m_message.GetEventPayload().data();
+                }
+
+                inline size_t GetEventPayloadLength() const
+                {
+                    return m_borrowedPayload ? m_payloadBytesReceived : m_message.GetEventPayload().size();
+                }
 
                 /**
                  * Insert event header to a underlying event header value map, and update headers bytes received.
                  */
                 inline virtual void InsertMessageEventHeader(const String& eventHeaderName, size_t eventHeaderLength, const Aws::Utils::Event::EventHeaderValue& eventHeaderValue)
                 {
-                    m_message.InsertEventHeader(eventHeaderName, eventHeaderValue);
+                    const EventHeaderValue& inserted = m_message.InsertEventHeader(eventHeaderName, eventHeaderValue);
+                    const Message::KnownHeader knownHeader = Message::GetKnownHeaderForName(eventHeaderName.c_str(), eventHeaderName.size());
+                    if (knownHeader != Message::KnownHeader::UNKNOWN)
+                    {
+                        m_knownHeaders[static_cast<size_t>(knownHeader)] = &inserted;
+                    }
                     m_headersBytesReceived += eventHeaderLength;
                 }
 
                 inline virtual const Aws::Utils::Event::EventHeaderValueCollection& GetEventHeaders() { return m_message.GetEventHeaders(); }
 
+                /**
+                 * Get one of the well-known headers of the message just received without a lookup by name, or nullptr if the
+                 * message does not have it.
+                 */
+                inline const EventHeaderValue* GetKnownHeader(Message::KnownHeader header) const
+                {
+                    return header == Message::KnownHeader::UNKNOWN ? nullptr : m_knownHeaders[static_cast<size_t>(header)];
+                }
+
+                /**
+                 * Get the type of the message just received from its :message-type header, UNKNOWN if it is missing.
+                 */
+                inline Message::MessageType GetMessageType() const
+                {
+                    const EventHeaderValue* header = GetKnownHeader(Message::KnownHeader::MESSAGE_TYPE);
+                    if (!header || header->GetType() != EventHeaderValue::EventHeaderType::STRING)
+                    {
+                        return Message::MessageType::UNKNOWN;
+                    }
+                    const ByteBuffer& value = header->GetUnderlyingBuffer();
+                    return Message::GetMessageTypeForName(reinterpret_cast<const char*>(value.GetUnderlyingData()), value.GetLength());
+                }
+
                 /**
                  * Entry point of all callback functions.
                  * Will trigger associated functions based on m_message.
@@ -136,11 +211,24 @@ namespace Aws
                 virtual void OnEvent() = 0;
 
             private:
+                inline void CopyBorrowedPayload()
+                {
+                    if (m_borrowedPayload)
+                    {
+                        m_message.WriteEventPayload(m_borrowedPayload, m_payloadBytesReceived);
+                        m_borrowedPayload = nullptr;
+                    }
+                }
+
                 bool m_failure;
                 EventStreamErrors m_internalError;
                 size_t m_headersBytesReceived;
                 size_t m_payloadBytesReceived;
                 Aws::Utils::Event::Message m_message;
+                bool m_borrowPayload;
+                // points to the decoder's input buffer while the payload is borrowed
+                const unsigned char* m_borrowedPayload;
+                const EventHeaderValue* m_knownHeaders[static_cast<size_t>(Message::KnownHeader::UNKNOWN)];
             };
         }
     }
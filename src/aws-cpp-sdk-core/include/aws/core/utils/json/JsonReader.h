@@ -0,0 +1,149 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <streambuf>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            enum class JsonToken
+            {
+                None,
+                StartObject,
+                EndObject,
+                StartArray,
+                EndArray,
+                Key,
+                String,
+                Number,
+                Bool,
+                Null,
+                End,
+                Error
+            };
+
+            /**
+             * Forward-only pull parser reading JSON tokens directly from a stream.
+             * Unlike JsonValue, no DOM is built: the document is consumed one token at a time and only the text of the
+             * current key, string or number is buffered, so models can be populated in a single pass over the payload.
+             *
+             * Typical use, for a reader positioned on the StartObject token of a structure:
+             *
+             *     while (reader.NextMember())
+             *     {
+             *         const Aws::String& name = reader.GetString();
+             *         reader.Next(); // positions the reader on the member value
+             *         ...            // either consume the value or call reader.SkipValue()
+             *     }
+             *
+             * Any syntax error moves the reader to the Error token, which it then never leaves.
+             */
+            class AWS_CORE_API JsonReader
+            {
+            public:
+                /**
+                 * The stream must outlive the reader.
+                 */
+                explicit JsonReader(Aws::IStream& input);
+
+                JsonReader(const JsonReader&) = delete;
+                JsonReader& operator=(const JsonReader&) = delete;
+
+                /**
+                 * Advances to the next token and returns it.
+                 * End is returned once the top level value and any trailing whitespace have been consumed, and right away
+                 * for an input holding no value at all (i.e. an empty response body), which is not an error.
+                 */
+                JsonToken Next();
+
+                /**
+                 * Returns the current token.
+                 */
+                inline JsonToken GetToken() const { return m_token; }
+
+                /**
+                 * Advances within an object. Returns true when positioned on the next member name (Key),
+                 * false on the closing EndObject or on error.
+                 */
+                inline bool NextMember() { return Next() == JsonToken::Key; }
+
+                /**
+                 * Advances within an array. Returns true when positioned on the first token of the next element,
+                 * false on the closing EndArray or on error.
+                 */
+                inline bool NextElement()
+                {
+                    const JsonToken token = Next();
+                    return token != JsonToken::EndArray && token != JsonToken::Error && token != JsonToken::End;
+                }
+
+                /**
+                 * Skips the value starting at the current token, including all nested members or elements.
+                 * Returns false on error.
+                 */
+                bool SkipValue();
+
+                /**
+                 * Text of the current Key or String token, unescaped. Also the literal text of a Number token.
+                 */
+                inline const Aws::String& GetString() const { return m_text; }
+
+                /**
+                 * Moves out the text of the current Key or String token, avoiding a copy for large values.
+                 */
+                inline Aws::String TakeString() { return std::move(m_text); }
+
+                /**
+                 * Value of the current token converted the way JsonView converts it, i.e. 0 or false for other token types.
+                 */
+                int GetInteger() const;
+                long long GetInt64() const;
+                double GetDouble() const;
+                inline bool GetBool() const { return m_token == JsonToken::Bool && m_boolValue; }
+
+                /**
+                 * Returns false once a syntax error was encountered.
+                 */
+                inline bool WasParseSuccessful() const { return m_token != JsonToken::Error; }
+
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                JsonToken ReadValue(int c);
+                JsonToken ReadLiteral(const char* literal, JsonToken token, bool boolValue);
+                bool ReadString();
+                bool ReadUnicodeEscape();
+                bool ReadHex4(unsigned& codePoint);
+                JsonToken ReadNumber();
+                JsonToken Fail(const char* message);
+
+                inline int Peek() { return m_input->sgetc(); }
+                inline int Bump() { return m_input->sbumpc(); }
+                int PeekSignificant();
+
+                std::streambuf* m_input;
+                JsonToken m_token = JsonToken::None;
+                bool m_boolValue = false;
+                Aws::String m_text;
+                // one entry per open container, true for objects
+                Aws::Vector<bool> m_containers;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,112 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            class JsonView;
+
+            /**
+             * Forward-only JSON writer producing compact JSON directly into a caller-provided string.
+             * Unlike JsonValue, no intermediate DOM is built: keys and values are escaped and appended as they are written.
+             * The output string is appended to, not cleared, so a single buffer can be reused across payloads.
+             *
+             * The writer does not validate the structure it is asked to produce,
+             * every Key() must be followed by exactly one value, and every Start* call must be matched by its End* call.
+             */
+            class AWS_CORE_API JsonWriter
+            {
+            public:
+                explicit JsonWriter(Aws::String& output) : m_output(output) {}
+
+                JsonWriter(const JsonWriter&) = delete;
+                JsonWriter& operator=(const JsonWriter&) = delete;
+
+                JsonWriter& StartObject();
+                JsonWriter& EndObject();
+                JsonWriter& StartArray();
+                JsonWriter& EndArray();
+
+                /**
+                 * Writes an object member name. Must be followed by a value.
+                 */
+                JsonWriter& Key(const char* key, size_t length);
+                inline JsonWriter& Key(const char* key) { return Key(key, std::strlen(key)); }
+                inline JsonWriter& Key(const Aws::String& key) { return Key(key.c_str(), key.size()); }
+
+                JsonWriter& AsString(const char* value, size_t length);
+                inline JsonWriter& AsString(const char* value) { return AsString(value, std::strlen(value)); }
+                inline JsonWriter& AsString(const Aws::String& value) { return AsString(value.c_str(), value.size()); }
+
+                /**
+                 * Writes binary data as a base64 encoded string value.
+                 */
+                JsonWriter& AsBase64(const ByteBuffer& value);
+
+                JsonWriter& AsBool(bool value);
+                JsonWriter& AsInteger(int value);
+                JsonWriter& AsInt64(long long value);
+                JsonWriter& AsDouble(double value);
+                JsonWriter& AsNull();
+
+                /**
+                 * Writes a JSON DOM value compactly, used for members which are not (yet) written natively, such as documents.
+                 */
+                JsonWriter& AsJson(const JsonView& value);
+
+                /*
+                 * Shorthands for object members, named after their JsonValue counterparts.
+                 */
+                template<typename KeyT, typename ValueT>
+                inline JsonWriter& WithString(const KeyT& key, const ValueT& value) { return Key(key).AsString(value); }
+                template<typename KeyT>
+                inline JsonWriter& WithBool(const KeyT& key, bool value) { return Key(key).AsBool(value); }
+                template<typename KeyT>
+                inline JsonWriter& WithInteger(const KeyT& key, int value) { return Key(key).AsInteger(value); }
+                template<typename KeyT>
+                inline JsonWriter& WithInt64(const KeyT& key, long long value) { return Key(key).AsInt64(value); }
+                template<typename KeyT>
+                inline JsonWriter& WithDouble(const KeyT& key, double value) { return Key(key).AsDouble(value); }
+
+                /**
+                 * Returns the number of bytes written to the output so far, including any content it had before.
+                 */
+                inline size_t GetLength() const { return m_output.size(); }
+
+            private:
+                inline void BeginValue()
+                {
+                    if (m_afterKey)
+                    {
+                        m_afterKey = false;
+                    }
+                    else if (m_needsComma)
+                    {
+                        m_output.push_back(',');
+                    }
+                }
+
+                void WriteEscaped(const char* value, size_t length);
+
+                Aws::String& m_output;
+                bool m_needsComma = false;
+                bool m_afterKey = false;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
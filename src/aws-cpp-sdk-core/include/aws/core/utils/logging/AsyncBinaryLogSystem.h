@@ -0,0 +1,137 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Logger for verbose logging under concurrency, writing the same [LEVEL] timestamp tag [threadid] message lines
+             * as DefaultLogSystem.
+             *
+             * Each logging thread appends binary records to its own single-producer/single-consumer ring buffer, without
+             * taking any lock: Log() captures the format string pointer and copies the raw arguments (and the contents of
+             * string arguments), and LogStream() copies the message. A background thread formats the records and writes
+             * them to the output stream. It is only woken up when it is idle.
+             *
+             * When a thread's ring is full its statements are dropped rather than blocking the caller. The number of
+             * dropped statements is written to the log by the background thread and reported by GetDroppedCount().
+             *
+             * As with the AWS_LOG_* macros, format strings passed to Log() must have static storage duration (string
+             * literals). Formats using conversions which can not be deferred (%n, wide strings) are formatted on the
+             * calling thread instead.
+             */
+            class AWS_CORE_API AsyncBinaryLogSystem : public LogSystemInterface
+            {
+            public:
+                static const size_t DEFAULT_RING_SIZE = 64 * 1024;
+
+                /**
+                 * Initialize the logging system to write to the supplied logfile output. Creates logging thread on construction.
+                 * @param ringSize Size in bytes of the ring buffer of each logging thread, rounded up to a power of 2.
+                 */
+                AsyncBinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t ringSize = DEFAULT_RING_SIZE);
+
+                /**
+                 * Initialize the logging system to write to a computed file path filenamePrefix + "timestamp.log".
+                 * Creates logging thread on construction.
+                 */
+                AsyncBinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t ringSize = DEFAULT_RING_SIZE);
+
+                /**
+                 * Writes the pending statements and stops the logging thread.
+                 */
+                virtual ~AsyncBinaryLogSystem();
+
+                AsyncBinaryLogSystem(const AsyncBinaryLogSystem&) = delete;
+                AsyncBinaryLogSystem& operator=(const AsyncBinaryLogSystem&) = delete;
+
+                LogLevel GetLogLevel(void) const override { return m_logLevel; }
+
+                /**
+                 * Set a new log level. This has the immediate effect of changing the log output to the new level.
+                 */
+                void SetLogLevel(LogLevel logLevel) { m_logLevel.store(logLevel); }
+
+                /**
+                 * Queues a printf style statement, formatted on the logging thread.
+                 */
+                void Log(LogLevel logLevel, const char* tag, const char* formatStr, ...) override;
+
+                /**
+                 * Queues the content of the stream.
+                 */
+                void LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream& messageStream) override;
+
+                /**
+                 * Blocks until the statements queued so far are written to the output stream, then flushes it.
+                 * This method is thread-safe.
+                 */
+                void Flush() override;
+
+                /**
+                 * Total number of statements dropped because the ring of the logging thread was full.
+                 */
+                uint64_t GetDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+
+            private:
+                class Ring;
+                struct ThreadRing;
+
+                Ring* GetThreadRing();
+                void Enqueue(const unsigned char* record, size_t length);
+                void WakeWriter();
+                void Run();
+                bool WritePendingRecords();
+                bool HasPendingRecords();
+                void WriteRecord(const std::thread::id& threadId, const unsigned char* record, size_t length);
+
+                std::atomic<LogLevel> m_logLevel;
+                std::shared_ptr<Aws::OStream> m_logFile;
+                const size_t m_ringSize;
+                const uint64_t m_instanceId;
+                std::atomic<uint64_t> m_droppedCount;
+
+                std::mutex m_ringsMutex;
+                Aws::Vector<std::shared_ptr<Ring>> m_rings;
+
+                // only used to put the logging thread to sleep and to wait for flushes
+                std::mutex m_lock;
+                std::condition_variable m_signal;
+                std::atomic<bool> m_writerSleeping;
+                bool m_stop;
+                uint64_t m_flushRequested;
+                uint64_t m_flushCompleted;
+
+                // logging thread state
+                Aws::String m_line;
+                Aws::Vector<unsigned char> m_record;
+                int64_t m_cachedSecond;
+                Aws::String m_cachedSecondString;
+
+                std::thread m_loggingThread;
+            };
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
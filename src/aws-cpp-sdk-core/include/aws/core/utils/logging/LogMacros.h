@@ -10,6 +10,7 @@
 #include <aws/core/utils/logging/LogLevel.h>
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
+#include <aws/core/utils/logging/TagLogLevels.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 // While macros are usually grotty, using them here lets us have a simple function call interface for logging that
@@ -17,6 +18,16 @@
 //  (1) Can be compiled out completely, so you don't even have to pay the cost to check the log level (which will be a virtual function call and a std::atomic<> read) if you don't want any AWS logging
 //  (2) If you use logging and the log statement doesn't pass the conditional log filter level, not only do you not pay the cost of building the log string, you don't pay the cost for allocating or
 //      getting any of the values used in building the log string, as they're in a scope (if-statement) that never gets entered.
+//  (3) Statements more verbose than AWS_LOG_MIN_LEVEL are behind a constant condition, so the compiler removes them from optimized builds.
+//
+// AWS_LOG_MIN_LEVEL is the integer value of the most verbose LogLevel compiled in, e.g. -DAWS_LOG_MIN_LEVEL=4 keeps Info, Warn, Error
+// and Fatal statements only. The log level of the log system, and the levels given to tags with SetLogLevelForTag(), still apply at runtime.
+
+#ifndef AWS_LOG_MIN_LEVEL
+    #define AWS_LOG_MIN_LEVEL 6
+#endif
+
+#define AWS_LOG_LEVEL_COMPILED_IN(level) (static_cast<int>(level) <= AWS_LOG_MIN_LEVEL)
 
 #ifdef DISABLE_AWS_LOGGING
 
@@ -51,10 +62,13 @@
 
     #define AWS_LOG(level, tag, ...) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
+            if ( AWS_LOG_LEVEL_COMPILED_IN(level) ) \
             { \
-                logSystem->Log(level, tag, __VA_ARGS__); \
+                Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+                if ( logSystem && Aws::Utils::Logging::IsLogLevelEnabled(*logSystem, level, tag) ) \
+                { \
+                    logSystem->Log(level, tag, __VA_ARGS__); \
+                } \
             } \
         }
 
@@ -67,12 +81,15 @@
 
     #define AWS_LOGSTREAM(level, tag, streamExpression) \
         { \
-            Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
-            if ( logSystem && logSystem->GetLogLevel() >= level ) \
+            if ( AWS_LOG_LEVEL_COMPILED_IN(level) ) \
             { \
-                Aws::OStringStream logStream; \
-                logStream << streamExpression; \
-                logSystem->LogStream( level, tag, logStream ); \
+                Aws::Utils::Logging::LogSystemInterface* logSystem = Aws::Utils::Logging::GetLogSystem(); \
+                if ( logSystem && Aws::Utils::Logging::IsLogLevelEnabled(*logSystem, level, tag) ) \
+                { \
+                    Aws::OStringStream logStream; \
+                    logStream << streamExpression; \
+                    logSystem->LogStream( level, tag, logStream ); \
+                } \
             } \
         }
 
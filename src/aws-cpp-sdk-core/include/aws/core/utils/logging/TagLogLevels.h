@@ -0,0 +1,72 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/logging/LogSystemInterface.h>
+
+#include <atomic>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            /**
+             * Maximum number of distinct tags which can be given a log level, and maximum length of these tags.
+             */
+            static const size_t MAX_TAG_LOG_LEVELS = 64;
+            static const size_t MAX_LOG_TAG_LENGTH = 63;
+
+            /**
+             * Number of tags currently given a log level. Read by IsLogLevelEnabled() to skip the tag lookup when there is none.
+             */
+            extern AWS_CORE_API std::atomic<size_t> TagLogLevelCount;
+
+            /**
+             * Overrides the level of the log system for the statements logged with tag, e.g. to enable Trace for
+             * "AWSClient" only. The level can be more or less verbose than the one of the log system.
+             * Returns false if tag is longer than MAX_LOG_TAG_LENGTH, or if MAX_TAG_LOG_LEVELS distinct tags were
+             * already given a level.
+             * This method is thread-safe.
+             */
+            AWS_CORE_API bool SetLogLevelForTag(const char* tag, LogLevel logLevel);
+
+            /**
+             * Removes the level given to tag, its statements use the level of the log system again.
+             */
+            AWS_CORE_API void ClearLogLevelForTag(const char* tag);
+
+            /**
+             * Removes the levels given to every tag.
+             */
+            AWS_CORE_API void ClearLogLevelsForTags();
+
+            /**
+             * Looks up the level given to tag, without locking. Returns false if tag has none.
+             */
+            AWS_CORE_API bool GetLogLevelForTag(const char* tag, LogLevel& logLevel);
+
+            /**
+             * Whether a statement of logLevel logged with tag passes the level of tag, or the level of logSystem if tag
+             * has none. Used by the logging macros before building the statement.
+             */
+            inline bool IsLogLevelEnabled(const LogSystemInterface& logSystem, LogLevel logLevel, const char* tag)
+            {
+                LogLevel tagLogLevel;
+                if (TagLogLevelCount.load(std::memory_order_relaxed) > 0 && GetLogLevelForTag(tag, tagLogLevel))
+                {
+                    return tagLogLevel >= logLevel;
+                }
+                return logSystem.GetLogLevel() >= logLevel;
+            }
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
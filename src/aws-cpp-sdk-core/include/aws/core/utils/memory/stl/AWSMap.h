@@ -28,7 +28,7 @@ struct CompareStrings
     }
 };
 
-template<typename V> using CStringMap = std::map<const char*, V, CompareStrings, Aws::Allocator<std::pair<const char*, V> > >;
+template<typename V> using CStringMap = std::map<const char*, V, CompareStrings, Aws::Allocator<std::pair<const char* const, V> > >;
 
 template<typename K, typename V>
 V GetWithDefault(const Aws::Map<K,V> &map, const K &key, V &&defaultValue) {
@@ -0,0 +1,126 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/signer/AWSAuthChunkSigner.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Hash;
+        } // namespace Crypto
+
+        namespace Stream
+        {
+            /**
+             * Read-only streambuf producing the aws-chunked encoding of a body stream, each chunk signed with its rolling SigV4 signature.
+             *
+             * The body is read once, one chunk at a time, as the HTTP client reads this buffer, so its length does not need to be known
+             * and it is never buffered whole. Chunk data is served from the chunk buffer in place, only the small chunk headers are formatted.
+             * When a checksum is given, the body is also fed to it and the checksum is sent base64 encoded as a signed trailing header.
+             *
+             * If reading the body fails, the final chunk is not produced so the truncated upload is rejected by the service.
+             */
+            class AWS_CORE_API AwsChunkedSigningStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * @param body the stream to upload, read from its current position to its end.
+                 * @param signer the chunk signer, seeded with the signature of the request.
+                 * @param chunkSize the data size of every chunk but the last one.
+                 * @param checksumHeaderName the trailing header to send the checksum in, e.g. x-amz-checksum-crc32, unused without checksum.
+                 * @param checksum the checksum to compute over the body, may be null.
+                 */
+                AwsChunkedSigningStreamBuf(const std::shared_ptr<Aws::IOStream>& body,
+                                           Aws::Auth::ChunkSigner&& signer,
+                                           size_t chunkSize,
+                                           const Aws::String& checksumHeaderName = "",
+                                           const std::shared_ptr<Aws::Utils::Crypto::Hash>& checksum = nullptr);
+
+                AwsChunkedSigningStreamBuf(const AwsChunkedSigningStreamBuf&) = delete;
+                AwsChunkedSigningStreamBuf& operator=(const AwsChunkedSigningStreamBuf&) = delete;
+
+                /**
+                 * The body stream, at the position it had when this buffer was created as long as nothing was read yet.
+                 */
+                const std::shared_ptr<Aws::IOStream>& GetBody() const { return m_body; }
+
+                /**
+                 * Position of the body when this buffer was created, where its encoding starts. -1 if the body cannot seek.
+                 */
+                std::streampos GetBodyStart() const { return m_bodyStart; }
+
+                /**
+                 * Returns the length of the aws-chunked encoding of decodedLength bytes, the Content-Length to send.
+                 * checksumLength is the size of the checksum digest in bytes, 0 when no trailing checksum is sent.
+                 */
+                static uint64_t GetEncodedLength(uint64_t decodedLength, size_t chunkSize,
+                                                 const Aws::String& checksumHeaderName = "", size_t checksumLength = 0);
+
+            protected:
+                int_type underflow() override;
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                struct Segment
+                {
+                    const char* data;
+                    size_t length;
+                };
+
+                bool ReadNextChunk();
+                void SetSegments(std::initializer_list<Segment> segments);
+
+                std::shared_ptr<Aws::IOStream> m_body;
+                std::streampos m_bodyStart;
+                Aws::Auth::ChunkSigner m_signer;
+                Aws::String m_checksumHeaderName;
+                std::shared_ptr<Aws::Utils::Crypto::Hash> m_checksum;
+
+                Aws::Utils::Array<char> m_chunk;
+                Aws::String m_chunkHeader;
+                Aws::String m_trailer;
+                Segment m_segments[3];
+                size_t m_segmentCount;
+                size_t m_nextSegment;
+                // bytes produced before the current get area
+                uint64_t m_position;
+                bool m_finished;
+            };
+
+            /**
+             * Input stream over an AwsChunkedSigningStreamBuf, to be used as the content body of an aws-chunked request.
+             */
+            class AWS_CORE_API AwsChunkedSigningStream : public Aws::IOStream
+            {
+            public:
+                AwsChunkedSigningStream(const std::shared_ptr<Aws::IOStream>& body,
+                                        Aws::Auth::ChunkSigner&& signer,
+                                        size_t chunkSize,
+                                        const Aws::String& checksumHeaderName = "",
+                                        const std::shared_ptr<Aws::Utils::Crypto::Hash>& checksum = nullptr);
+
+                const std::shared_ptr<Aws::IOStream>& GetBody() const { return m_buffer.GetBody(); }
+                std::streampos GetBodyStart() const { return m_buffer.GetBodyStart(); }
+
+            private:
+                AwsChunkedSigningStreamBuf m_buffer;
+            };
+        } // namespace Stream
+    } // namespace Utils
+} // namespace Aws
@@ -8,6 +8,9 @@
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/common/array_list.h>
 
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
 #include <streambuf>
@@ -25,14 +28,33 @@ namespace Aws
              * NOTE: iostreams maintain state for readers and writers. This means that you can have at most two
              * concurrent threads, one for reading and one for writing. Multiple readers or multiple writers are not
              * thread-safe and will result in race-conditions.
+             *
+             * Data is exchanged through a single-producer/single-consumer ring buffer: the put area and the get area
+             * are windows of the ring itself, so every byte is copied once into the ring and read from it in place.
+             * The writer and the reader only synchronize through two atomic positions, the mutex and condition
+             * variable are used to sleep when the ring is full or empty. Written data becomes visible to the reader
+             * when the put area is full or on sync(), and a blocked writer is only woken once a quarter of the ring
+             * is free again (or the ring is drained), so wakeups are batched.
              */
             class AWS_CORE_API ConcurrentStreamBuf : public std::streambuf
             {
             public:
 
+                /**
+                 * @param bufferLength Capacity of the ring buffer, rounded up to a power of 2.
+                 */
                 explicit ConcurrentStreamBuf(size_t bufferLength = 8 * 1024);
 
+                /**
+                 * Called by the writer to signal the end of the input. Data written so far (including the data buffered
+                 * by pStreamToClose, if given) is made visible to the reader, which then reads EOF once it consumed it.
+                 */
                 void SetEofInput(Aws::IOStream* pStreamToClose = nullptr);
+
+                /**
+                 * Closes the stream for both sides: further writes fail and the reader reads EOF.
+                 * Unblocks a writer waiting for the reader.
+                 */
                 void CloseStream();
 
                 /**
@@ -41,27 +63,63 @@ namespace Aws
                  */
                 bool WaitForDrain(int64_t timeoutMs);
 
+                /**
+                 * Reader side zero-copy access: blocks until data is available and returns the longest contiguous
+                 * readable region of the ring in data/length, or returns false at EOF.
+                 * The region stays valid until ConsumeReadSpan() or any other read from this buffer.
+                 */
+                bool GetReadSpan(const unsigned char*& data, size_t& length);
+
+                /**
+                 * Marks count bytes (at most the length returned by GetReadSpan()) as read.
+                 */
+                void ConsumeReadSpan(size_t count);
+
+                /**
+                 * Writer side zero-copy access: blocks until space is available and returns the longest contiguous
+                 * writable region of the ring in data/length, or returns false once the stream is closed.
+                 */
+                bool GetWriteSpan(unsigned char*& data, size_t& length);
+
+                /**
+                 * Marks count bytes (at most the length returned by GetWriteSpan()) as written.
+                 * As with the stream interface, they become visible to the reader on sync() or once the span is full.
+                 */
+                void CommitWriteSpan(size_t count);
+
             protected:
                 std::streampos seekoff(std::streamoff off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
                 std::streampos seekpos(std::streampos pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
 
                 int underflow() override;
-                int uflow() override;
                 int overflow(int ch) override;
                 int sync() override;
                 std::streamsize showmanyc() override;
 
+                /**
+                 * Publishes the written part of the put area to the reader.
+                 */
                 void FlushPutArea();
 
             private:
-                Aws::Vector<unsigned char> m_getArea;
-                Aws::Vector<unsigned char> m_putArea;
-                Aws::Vector<unsigned char> m_backbuf; // used to shuttle data from the put area to the get area
-                std::mutex m_lock; // synchronize access to the common backbuffer
+                void ReleaseGetArea();
+                bool AcquirePutArea();
+                void WakeReader();
+                void WakeWriter();
+
+                Aws::UniqueArrayPtr<unsigned char> m_ring;
+                size_t m_capacity;
+                size_t m_wakeWriterThreshold;
+                // total number of bytes published by the writer, only modified by the writer
+                std::atomic<size_t> m_writePos;
+                // total number of bytes released by the reader, only modified by the reader
+                std::atomic<size_t> m_readPos;
+                std::atomic<bool> m_readerWaiting;
+                std::atomic<bool> m_writerWaiting;
+                std::atomic<bool> m_eofInput;
+                std::atomic<bool> m_eofOutput;
+                std::mutex m_lock; // only used to sleep and wake up
                 std::condition_variable m_signal;
-                bool m_eofInput = false;
-                bool m_eofOutput = false;
-                Aws::IOStream* m_pStreamToClose = nullptr;
             };
         }
     }
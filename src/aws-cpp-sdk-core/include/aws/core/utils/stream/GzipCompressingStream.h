@@ -0,0 +1,89 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <iostream>
+#include <memory>
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+
+        namespace Stream
+        {
+            /**
+             * Read-only streambuf producing the gzip compression of an input stream on the fly, as it is read.
+             *
+             * The input is read and deflated a block at a time when the HTTP client pulls bytes, so compression overlaps with sending
+             * and neither the input nor its compressed form is ever held whole in memory. The compressed length is not known in advance:
+             * requests using it are sent with Transfer-Encoding: chunked.
+             *
+             * With an executor, the input is split in blocks compressed in parallel (each primed with the last 32 KiB of the block before it,
+             * as pigz does), up to maxBlocksInFlight ahead of the reader, and the output is a single gzip member. The thread reading this
+             * buffer then blocks on the blocks queued to the executor, so it must not be a thread of the executor itself, e.g. the executor
+             * running the request the stream is the body of.
+             * Without one, a single deflate stream is used.
+             *
+             * Requires a build with ENABLE_ZLIB_REQUEST_COMPRESSION; otherwise the stream fails on its first read.
+             * If reading the input or compressing fails, the stream ends without the gzip trailer so the truncated body is rejected.
+             */
+            class AWS_CORE_API GzipCompressingStreamBuf : public std::streambuf
+            {
+            public:
+                static const size_t DEFAULT_BLOCK_SIZE = 128 * 1024;
+
+                /**
+                 * @param input the stream to compress, read from its current position to its end.
+                 * @param blockSize the amount of input read and compressed at a time.
+                 * @param executor compresses blocks in parallel when not null, it must outlive this buffer and must not be the executor
+                 * the buffer is read from.
+                 * @param maxBlocksInFlight the number of blocks compressed ahead of the reader, 0 for twice the number of hardware threads.
+                 */
+                explicit GzipCompressingStreamBuf(const std::shared_ptr<Aws::IOStream>& input,
+                                                  size_t blockSize = DEFAULT_BLOCK_SIZE,
+                                                  Threading::Executor* executor = nullptr,
+                                                  size_t maxBlocksInFlight = 0);
+
+                ~GzipCompressingStreamBuf();
+
+                GzipCompressingStreamBuf(const GzipCompressingStreamBuf&) = delete;
+                GzipCompressingStreamBuf& operator=(const GzipCompressingStreamBuf&) = delete;
+
+            protected:
+                int_type underflow() override;
+
+            private:
+                struct CompressionState;
+
+                std::shared_ptr<CompressionState> m_state;
+            };
+
+            /**
+             * Input stream over a GzipCompressingStreamBuf, to be used as the content body of a compressed request.
+             */
+            class AWS_CORE_API GzipCompressingStream : public Aws::IOStream
+            {
+            public:
+                explicit GzipCompressingStream(const std::shared_ptr<Aws::IOStream>& input,
+                                               size_t blockSize = GzipCompressingStreamBuf::DEFAULT_BLOCK_SIZE,
+                                               Threading::Executor* executor = nullptr,
+                                               size_t maxBlocksInFlight = 0);
+
+            private:
+                GzipCompressingStreamBuf m_buffer;
+            };
+        } // namespace Stream
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,64 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSMultiMap.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Runs tasks after a delay on a single thread, started on the first call to Schedule().
+            * Tasks should be short, typically submitting the actual work to an Executor, as they delay all later timers.
+            * Used to wait out retry back-off without holding an executor thread.
+            * The thread is joined by Stop() and the destructor, which must therefore not be called from a task run by the queue.
+            */
+            class AWS_CORE_API TimerQueue
+            {
+            public:
+                TimerQueue() = default;
+                ~TimerQueue();
+
+                TimerQueue(const TimerQueue&) = delete;
+                TimerQueue& operator =(const TimerQueue&) = delete;
+                TimerQueue(TimerQueue&&) = delete;
+                TimerQueue& operator =(TimerQueue&&) = delete;
+
+                /**
+                * Runs task once delay has elapsed. Returns false, without running the task, once the queue is stopped.
+                */
+                bool Schedule(std::chrono::milliseconds delay, std::function<void()>&& task);
+
+                /**
+                * Stops and joins the timer thread, waiting for the task running if any. Tasks which are not due yet are discarded.
+                * Must not be called from a task run by the queue.
+                */
+                void Stop();
+
+            private:
+                using Clock = std::chrono::steady_clock;
+
+                void Run();
+
+                std::mutex m_mutex;
+                std::condition_variable m_signal;
+                Aws::MultiMap<Clock::time_point, std::function<void()>> m_tasks;
+                std::thread m_thread;
+                bool m_stopped = false;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,119 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Thread pool executor without a shared task queue.
+            *
+            * Every worker owns a lock-free work-stealing deque. Tasks submitted from a worker thread (i.e. by a callback of
+            * an async operation) are pushed onto that worker's own deque, tasks submitted from any other thread are pushed
+            * onto the lock-free inbox of a worker picked round-robin. Idle workers drain their inbox, then steal from the
+            * other workers, and only block once no work is left anywhere. Tasks are executed in no particular order.
+            *
+            * Task nodes are recycled: those of tasks submitted by a worker for the tasks that worker submits next, those of tasks
+            * submitted from outside the pool through a shared list of spare nodes, so submissions do not allocate a node in
+            * steady state (the std::function may still allocate for large captures).
+            *
+            * Optionally the number of queued (submitted but not yet started) tasks can be bounded. When the bound is reached,
+            * submissions from outside the pool either block until a task is started (QUEUE_TASKS_EVENLY_ACROSS_THREADS)
+            * or are rejected (REJECT_IMMEDIATELY). Submissions from the pool's own workers are never blocked nor rejected,
+            * as waiting on themselves could deadlock the pool.
+            */
+            class AWS_CORE_API WorkStealingExecutor : public Executor
+            {
+            public:
+                /**
+                * @param poolSize Number of worker threads, at least 1.
+                * @param maxQueuedTasks Maximum number of queued tasks, 0 for unbounded.
+                * @param overflowPolicy What to do with a submission when maxQueuedTasks is reached.
+                */
+                WorkStealingExecutor(size_t poolSize, size_t maxQueuedTasks = 0,
+                                     OverflowPolicy overflowPolicy = OverflowPolicy::QUEUE_TASKS_EVENLY_ACROSS_THREADS);
+                ~WorkStealingExecutor();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+                WorkStealingExecutor& operator =(const WorkStealingExecutor&) = delete;
+                WorkStealingExecutor(WorkStealingExecutor&&) = delete;
+                WorkStealingExecutor& operator =(WorkStealingExecutor&&) = delete;
+
+                /**
+                * Call to ensure the threadpool can be safely destroyed. It blocks until all threads finished.
+                * As with PooledThreadExecutor, tasks which have not been started yet are discarded.
+                */
+                void WaitUntilStopped() override;
+
+                /**
+                * Number of submitted tasks which have not been started yet.
+                */
+                inline size_t GetQueuedTaskCount() const { return m_queuedTasks.load(std::memory_order_relaxed); }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+
+            private:
+                struct Task;
+                class Worker;
+
+                bool AcquireQueueSlot();
+                void ReleaseQueueSlot();
+                Task* NewSpareTask(std::function<void()>&& fn);
+                void RecycleTask(Worker& worker, Task* task);
+                void WakeWorker();
+                void WaitForWork();
+                Task* TakeInbox(Worker& from, Worker& to);
+                Task* FindTask(Worker& worker);
+                void WorkerLoop(Worker& worker);
+
+                Aws::Vector<Worker*> m_workers;
+                Aws::Vector<std::thread> m_threads;
+                std::atomic<size_t> m_nextWorker{0};
+
+                const size_t m_maxQueuedTasks;
+                const OverflowPolicy m_overflowPolicy;
+                std::atomic<size_t> m_queuedTasks{0};
+                std::atomic<size_t> m_blockedSubmitters{0};
+                std::mutex m_capacityMutex;
+                std::condition_variable m_capacityAvailable;
+
+                // Nodes of the tasks submitted from outside the pool, pushed lock-free by the workers once executed. Popping
+                // takes m_spareTasksMutex, so that no node can be popped and pushed again while another pop reads its next.
+                std::atomic<Task*> m_spareTasks{nullptr};
+                std::atomic<size_t> m_spareTaskCount{0};
+                std::mutex m_spareTasksMutex;
+
+                // Tasks pushed and not started yet. Unlike m_queuedTasks, counted once the task is visible to the workers,
+                // so that a worker woken up for it finds it. Briefly negative when a task is started before being counted.
+                std::atomic<std::int64_t> m_pendingTasks{0};
+                std::atomic<size_t> m_sleepingWorkers{0};
+                std::mutex m_sleepMutex;
+                std::condition_variable m_workAvailable;
+
+                std::atomic<bool> m_stopped{false};
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
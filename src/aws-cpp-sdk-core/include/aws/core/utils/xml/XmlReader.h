@@ -0,0 +1,173 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <streambuf>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            enum class XmlToken
+            {
+                None,
+                StartElement,
+                EndElement,
+                Text,
+                End,
+                Error
+            };
+
+            /**
+             * Forward-only pull parser reading XML tokens directly from a stream.
+             * Unlike XmlDocument, no DOM is built: the document is consumed one token at a time and only the name, attributes
+             * and text of the current element are buffered, in buffers reused from one element to the next, so models can be
+             * populated in a single pass over the payload.
+             * Entities and character references are decoded as the text is read. The XML declaration, processing instructions,
+             * comments and the document type declaration are skipped, CDATA sections are returned as text.
+             *
+             * Typical use, for a reader positioned on the StartElement token of a structure:
+             *
+             *     while (reader.NextChild())
+             *     {
+             *         if (reader.GetName() == "member")
+             *         {
+             *             reader.ReadElementText(); // or any other way of consuming the child element
+             *             member = reader.TakeText();
+             *         }
+             *         else
+             *         {
+             *             reader.SkipElement();
+             *         }
+             *     }
+             *
+             * Any syntax error moves the reader to the Error token, which it then never leaves.
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * The stream must outlive the reader.
+                 */
+                explicit XmlReader(Aws::IStream& input);
+
+                XmlReader(const XmlReader&) = delete;
+                XmlReader& operator=(const XmlReader&) = delete;
+
+                /**
+                 * Advances to the next token and returns it. An empty element <a/> is returned as a StartElement followed by an EndElement.
+                 * End is returned once the root element and anything after it have been consumed.
+                 */
+                inline XmlToken Next() { return ReadToken(TextMode::Replace); }
+
+                /**
+                 * Returns the current token.
+                 */
+                inline XmlToken GetToken() const { return m_token; }
+
+                /**
+                 * Advances within an element, skipping its text. Returns true when positioned on the StartElement of its next child,
+                 * false on its EndElement or on error.
+                 * The reader must be either on the StartElement of the element or on the EndElement of its previous child,
+                 * i.e. every child returned must be consumed before calling this again.
+                 */
+                bool NextChild();
+
+                /**
+                 * Skips the element starting at the current StartElement token, up to its EndElement. Returns false on error.
+                 */
+                bool SkipElement();
+
+                /**
+                 * Reads the text of the element starting at the current StartElement token and moves to its EndElement.
+                 * The text of child elements is not included. Returns false on error.
+                 */
+                bool ReadElementText();
+
+                /**
+                 * Name of the current StartElement or EndElement, including its namespace prefix if any.
+                 */
+                inline const Aws::String& GetName() const { return m_elements[m_nameIndex]; }
+
+                /**
+                 * Value of an attribute of the current StartElement, unescaped. Empty if the element has no such attribute.
+                 */
+                const Aws::String& GetAttributeValue(const char* name) const;
+
+                /**
+                 * Text of the current Text token, or of the element read by ReadElementText, unescaped.
+                 */
+                inline const Aws::String& GetText() const { return m_text; }
+
+                /**
+                 * Trims the whitespace around the current text in place and returns it, for values that are parsed.
+                 */
+                const Aws::String& GetTrimmedText();
+
+                /**
+                 * Moves out the current text, avoiding a copy for values stored as is.
+                 */
+                inline Aws::String TakeText() { return std::move(m_text); }
+
+                /**
+                 * Returns false once a syntax error was encountered.
+                 */
+                inline bool WasParseSuccessful() const { return m_token != XmlToken::Error; }
+
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                enum class TextMode
+                {
+                    Replace,
+                    Append,
+                    Discard
+                };
+
+                XmlToken ReadToken(TextMode mode);
+                XmlToken ReadStartTag();
+                XmlToken ReadEndTag();
+                bool ReadName(Aws::String& name);
+                bool ReadAttributes();
+                bool ReadCharacterData(Aws::String* text);
+                bool ReadReference(Aws::String* text);
+                bool ReadCData(Aws::String* text);
+                bool SkipComment();
+                bool SkipUntil(const char* terminator);
+                bool SkipDeclaration();
+                XmlToken Fail(const char* message);
+
+                inline int Peek() { return m_input->sgetc(); }
+                inline int Bump() { return m_input->sbumpc(); }
+                void SkipWhitespace();
+
+                std::streambuf* m_input;
+                XmlToken m_token = XmlToken::None;
+                // names of the open elements, kept allocated once the elements are closed to be reused
+                Aws::Vector<Aws::String> m_elements;
+                size_t m_depth = 0;
+                size_t m_nameIndex = 0;
+                bool m_emptyElement = false;
+                bool m_rootRead = false;
+                // attributes of the current StartElement, the first m_attributeCount entries are in use
+                Aws::Vector<std::pair<Aws::String, Aws::String>> m_attributes;
+                size_t m_attributeCount = 0;
+                Aws::String m_text;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
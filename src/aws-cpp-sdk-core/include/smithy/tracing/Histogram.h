@@ -7,10 +7,16 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <smithy/Smithy_EXPORTS.h>
+#include <memory>
 
 namespace smithy {
     namespace components {
         namespace tracing {
+            /**
+             * An immutable set of attributes shared between many measurements.
+             */
+            using MetricAttributes = std::shared_ptr<const Aws::Map<Aws::String, Aws::String>>;
+
             /**
              * Measures a value where the statistics are likely meaningful.
              */
@@ -25,6 +31,17 @@ namespace smithy {
                  * @param attributes the attributes or dimensions associate with this measurement.
                  */
                 virtual void record(double value, Aws::Map<Aws::String, Aws::String> attributes) = 0;
+
+                /**
+                 * Records a value to the histogram with a shared attribute set. By default the attributes are copied
+                 * into record(), implementations should override this to record without copying them.
+                 *
+                 * @param value the value that be recorded in a statistical distribution.
+                 * @param attributes the attributes or dimensions associate with this measurement, must not be null.
+                 */
+                virtual void recordShared(double value, const MetricAttributes& attributes) {
+                    record(value, *attributes);
+                }
             };
         }
     }
@@ -52,6 +52,11 @@ namespace smithy {
                     AWS_UNREFERENCED_PARAM(value);
                     AWS_UNREFERENCED_PARAM(attributes);
                 }
+
+                void recordShared(double value, const MetricAttributes& attributes) override {
+                    AWS_UNREFERENCED_PARAM(value);
+                    AWS_UNREFERENCED_PARAM(attributes);
+                }
             };
 
             /**
@@ -0,0 +1,97 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#pragma once
+
+#include <smithy/Smithy_EXPORTS.h>
+#include <smithy/tracing/Histogram.h>
+#include <smithy/tracing/Meter.h>
+#include <smithy/tracing/TelemetryProvider.h>
+#include <smithy/tracing/Tracer.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/threading/ReaderWriterLock.h>
+#include <memory>
+
+namespace smithy {
+    namespace components {
+        namespace tracing {
+            /**
+             * The tracer, meter and instruments used by every call of one operation of a service client,
+             * together with the span name and attributes of that operation. Created once, then immutable.
+             */
+            class SMITHY_API OperationTelemetry {
+            public:
+                OperationTelemetry(TelemetryProvider& telemetryProvider,
+                    const char* serviceName,
+                    const char* operationName);
+
+                OperationTelemetry(const OperationTelemetry&) = delete;
+                OperationTelemetry& operator=(const OperationTelemetry&) = delete;
+
+                /**
+                 * Starts the client span of a call to this operation.
+                 */
+                std::shared_ptr<TraceSpan> CreateSpan() const;
+
+                const Aws::String& GetOperationName() const { return m_operationName; }
+                const std::shared_ptr<Meter>& GetMeter() const { return m_meter; }
+
+                /**
+                 * Histogram of TracingUtils::SMITHY_CLIENT_DURATION_METRIC.
+                 */
+                Histogram& GetDurationHistogram() const { return *m_durationHistogram; }
+
+                /**
+                 * Histogram of TracingUtils::SMITHY_CLIENT_ENDPOINT_RESOLUTION_METRIC.
+                 */
+                Histogram& GetEndpointResolutionHistogram() const { return *m_endpointResolutionHistogram; }
+
+                /**
+                 * The method and service dimensions of the operation's metrics.
+                 */
+                const MetricAttributes& GetMetricAttributes() const { return m_metricAttributes; }
+
+            private:
+                Aws::UniquePtr<Histogram> CreateHistogram(const char* metricName) const;
+
+                const Aws::String m_operationName;
+                const Aws::String m_spanName;
+                Aws::Map<Aws::String, Aws::String> m_spanAttributes;
+                MetricAttributes m_metricAttributes;
+                std::shared_ptr<Tracer> m_tracer;
+                std::shared_ptr<Meter> m_meter;
+                Aws::UniquePtr<Histogram> m_durationHistogram;
+                Aws::UniquePtr<Histogram> m_endpointResolutionHistogram;
+            };
+
+            /**
+             * Lazily built OperationTelemetry of every operation called on a service client.
+             * Lookups of operations already seen only take a reader lock and do not allocate.
+             */
+            class SMITHY_API OperationTelemetryCache {
+            public:
+                OperationTelemetryCache() = default;
+
+                /**
+                 * Copies start empty, the instruments are resolved again from the copy's telemetry provider.
+                 */
+                OperationTelemetryCache(const OperationTelemetryCache&) {}
+                OperationTelemetryCache& operator=(const OperationTelemetryCache& other);
+
+                /**
+                 * Returns the telemetry of operationName, creating it from telemetryProvider on first use.
+                 * The reference stays valid for the lifetime of the cache.
+                 */
+                const OperationTelemetry& Get(TelemetryProvider& telemetryProvider,
+                    const char* serviceName,
+                    const char* operationName) const;
+
+            private:
+                mutable Aws::Utils::Threading::ReaderWriterLock m_lock;
+                // keys point to the operation name owned by the mapped value
+                mutable Aws::CStringMap<Aws::UniquePtr<OperationTelemetry>> m_operations;
+            };
+        }
+    }
+}
@@ -102,6 +102,29 @@ namespace smithy {
                     histogram->record((double) duration, std::forward<Aws::Map<Aws::String, Aws::String>>(attributes));
                 }
 
+                /**
+                 * Will run a function and record the duration of that function in microsecond timing to an
+                 * already created histogram. Unlike the overloads taking a Meter, nothing is allocated to record
+                 * the measurement.
+                 * @tparam T The type that is being returned from the function.
+                 * @param func A function that returns T.
+                 * @param histogram The histogram recording the measurement, see OperationTelemetry.
+                 * @param attributes The attributes or dimensions associate with this measurement.
+                 * @return the result of func.
+                 */
+                template<typename T, typename FuncT>
+                static T MakeCallWithTiming(FuncT&& func,
+                    Histogram &histogram,
+                    const MetricAttributes &attributes)
+                {
+                    auto before = std::chrono::steady_clock::now();
+                    T returnValue = func();
+                    auto after = std::chrono::steady_clock::now();
+                    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(after - before).count();
+                    histogram.recordShared((double) duration, attributes);
+                    return returnValue;
+                }
+
                 /**
                  * Emits http metrics to a specified meter.
                  * @param metrics A http metrics collection that we will emit.
@@ -134,32 +157,20 @@ namespace smithy {
                  * @return A tuple of metric name to measurement unit.
                  */
                 static std::pair<Aws::String, Aws::String> ConvertCoreMetricToSmithy(const Aws::String &name) {
-                    //TODO: Make static map, Aws::Map cannot be made static with a customer memory manager as of the moment.
-                    Aws::Map<int, std::pair<Aws::String, Aws::String>> metricsTypeToName =
-                        {
-                            std::pair<int, std::pair<Aws::String, Aws::String>>(
-                                static_cast<int>(Aws::Monitoring::HttpClientMetricsType::DnsLatency),
-                                std::make_pair(SMITHY_METRICS_DNS_DURATION, MICROSECOND_METRIC_TYPE)),
-                            std::pair<int, std::pair<Aws::String, Aws::String>>(
-                                static_cast<int>(Aws::Monitoring::HttpClientMetricsType::ConnectLatency),
-                                std::make_pair(SMITHY_METRICS_CONNECT_DURATION, MICROSECOND_METRIC_TYPE)),
-                            std::pair<int, std::pair<Aws::String, Aws::String>>(
-                                static_cast<int>(Aws::Monitoring::HttpClientMetricsType::SslLatency),
-                                std::make_pair(SMITHY_METRICS_SSL_DURATION, MICROSECOND_METRIC_TYPE)),
-                            std::pair<int, std::pair<Aws::String, Aws::String>>(
-                                static_cast<int>(Aws::Monitoring::HttpClientMetricsType::DownloadSpeed),
-                                std::make_pair(SMITHY_METRICS_DOWNLOAD_SPEED_METRIC, BYTES_PER_SECOND_METRIC_TYPE)),
-                            std::pair<int, std::pair<Aws::String, Aws::String>>(
-                                static_cast<int>(Aws::Monitoring::HttpClientMetricsType::UploadSpeed),
-                                std::make_pair(SMITHY_METRICS_UPLOAD_SPEED_METRIC, BYTES_PER_SECOND_METRIC_TYPE)),
-                        };
-
-                    auto metricType = Aws::Monitoring::GetHttpClientMetricTypeByName(name);
-                    auto it = metricsTypeToName.find(static_cast<int>(metricType));
-                    if (it == metricsTypeToName.end()) {
-                        return std::make_pair(SMITHY_METRICS_UNKNOWN_METRIC, "unknown");
+                    switch (Aws::Monitoring::GetHttpClientMetricTypeByName(name)) {
+                        case Aws::Monitoring::HttpClientMetricsType::DnsLatency:
+                            return std::make_pair(SMITHY_METRICS_DNS_DURATION, MICROSECOND_METRIC_TYPE);
+                        case Aws::Monitoring::HttpClientMetricsType::ConnectLatency:
+                            return std::make_pair(SMITHY_METRICS_CONNECT_DURATION, MICROSECOND_METRIC_TYPE);
+                        case Aws::Monitoring::HttpClientMetricsType::SslLatency:
+                            return std::make_pair(SMITHY_METRICS_SSL_DURATION, MICROSECOND_METRIC_TYPE);
+                        case Aws::Monitoring::HttpClientMetricsType::DownloadSpeed:
+                            return std::make_pair(SMITHY_METRICS_DOWNLOAD_SPEED_METRIC, BYTES_PER_SECOND_METRIC_TYPE);
+                        case Aws::Monitoring::HttpClientMetricsType::UploadSpeed:
+                            return std::make_pair(SMITHY_METRICS_UPLOAD_SPEED_METRIC, BYTES_PER_SECOND_METRIC_TYPE);
+                        default:
+                            return std::make_pair(SMITHY_METRICS_UNKNOWN_METRIC, "unknown");
                     }
-                    return it->second;
                 }
             };
         }
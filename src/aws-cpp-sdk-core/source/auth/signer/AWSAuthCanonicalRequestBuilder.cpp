@@ -0,0 +1,142 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/signer/AWSAuthCanonicalRequestBuilder.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/URI.h>
+
+#include <cctype>
+
+using namespace Aws::Auth;
+using namespace Aws::Http;
+
+static const size_t INITIAL_CANONICAL_REQUEST_CAPACITY = 1024;
+
+CanonicalRequestBuilder& CanonicalRequestBuilder::ForCurrentThread()
+{
+    static thread_local CanonicalRequestBuilder builder;
+    return builder;
+}
+
+void CanonicalRequestBuilder::Build(HttpRequest& request,
+                                    bool urlEscapePath,
+                                    const Aws::String& payloadHash,
+                                    const HeaderFilter& shouldSignHeader)
+{
+    m_canonicalRequest.clear();
+    m_signedHeaders.clear();
+    m_canonicalRequest.reserve(INITIAL_CANONICAL_REQUEST_CAPACITY);
+
+    AppendRequestLines(request, urlEscapePath);
+
+    for (const auto& header : request.GetHeaders())
+    {
+        if (!shouldSignHeader(header.first))
+        {
+            continue;
+        }
+        m_canonicalRequest.append(header.first).append(1, ':');
+        AppendHeaderValue(header.second);
+        m_canonicalRequest.append(1, '\n');
+
+        if (!m_signedHeaders.empty())
+        {
+            m_signedHeaders.append(1, ';');
+        }
+        m_signedHeaders.append(header.first);
+    }
+
+    m_canonicalRequest.append(1, '\n')
+                      .append(m_signedHeaders).append(1, '\n')
+                      .append(payloadHash);
+}
+
+void CanonicalRequestBuilder::AppendRequestLines(HttpRequest& request, bool urlEscapePath)
+{
+    request.CanonicalizeRequest();
+    m_canonicalRequest.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod())).append(1, '\n');
+
+    if (urlEscapePath)
+    {
+        // the path is sent RFC3986 encoded, and SigV4 encodes it once more
+        URI uriCopy = request.GetUri();
+        uriCopy.SetPath(uriCopy.GetURLEncodedPathRFC3986());
+        m_canonicalRequest.append(uriCopy.GetURLEncodedPath());
+    }
+    else
+    {
+        m_canonicalRequest.append(request.GetUri().GetURLEncodedPath());
+    }
+    m_canonicalRequest.append(1, '\n');
+
+    const Aws::String& queryString = request.GetUri().GetQueryString();
+    if (queryString.find('=') != Aws::String::npos)
+    {
+        m_canonicalRequest.append(queryString, 1, Aws::String::npos);
+    }
+    else if (queryString.size() > 1)
+    {
+        m_canonicalRequest.append(queryString, 1, Aws::String::npos).append(1, '=');
+    }
+    m_canonicalRequest.append(1, '\n');
+}
+
+void CanonicalRequestBuilder::AppendHeaderValue(const Aws::String& value)
+{
+    // Trims the value, joins its lines with ',' (trimming every line but the first, skipping empty ones)
+    // and collapses runs of spaces, the same way as AWSAuthHelper::CanonicalizeHeaders.
+    size_t begin = 0;
+    size_t end = value.size();
+    while (begin < end && std::isspace(static_cast<unsigned char>(value[begin])))
+    {
+        ++begin;
+    }
+    while (end > begin && std::isspace(static_cast<unsigned char>(value[end - 1])))
+    {
+        --end;
+    }
+
+    const size_t valueStart = m_canonicalRequest.size();
+    bool firstLine = true;
+    while (begin < end)
+    {
+        size_t lineEnd = value.find('\n', begin);
+        if (lineEnd == Aws::String::npos || lineEnd > end)
+        {
+            lineEnd = end;
+        }
+        size_t lineBegin = begin;
+        begin = lineEnd + 1;
+        if (lineEnd == lineBegin)
+        {
+            continue;
+        }
+
+        size_t lineLast = lineEnd;
+        if (!firstLine)
+        {
+            while (lineBegin < lineLast && std::isspace(static_cast<unsigned char>(value[lineBegin])))
+            {
+                ++lineBegin;
+            }
+            while (lineLast > lineBegin && std::isspace(static_cast<unsigned char>(value[lineLast - 1])))
+            {
+                --lineLast;
+            }
+            m_canonicalRequest.append(1, ',');
+        }
+        firstLine = false;
+
+        for (size_t i = lineBegin; i < lineLast; ++i)
+        {
+            const char c = value[i];
+            if (c == ' ' && m_canonicalRequest.size() > valueStart && m_canonicalRequest.back() == ' ')
+            {
+                continue;
+            }
+            m_canonicalRequest.append(1, c);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/signer/AWSAuthChunkSigner.h>
+#include <aws/core/auth/signer/AWSAuthSignerHelper.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/Sha256.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+namespace Aws
+{
+    namespace Auth
+    {
+        const char STREAMING_AWS4_HMAC_SHA256_PAYLOAD[] = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+        const char STREAMING_AWS4_HMAC_SHA256_PAYLOAD_TRAILER[] = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD-TRAILER";
+    } // namespace Auth
+} // namespace Aws
+
+static const char AWS4_HMAC_SHA256_PAYLOAD[] = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char AWS4_HMAC_SHA256_TRAILER[] = "AWS4-HMAC-SHA256-TRAILER";
+// hex encoded SHA256 of the empty string, the chunk string to sign has a slot for chunk headers which are never sent
+static const char EMPTY_STRING_SHA256[] = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+ChunkSigner::ChunkSigner(const ByteBuffer& signingKey, const Aws::String& dateTime,
+                         const Aws::String& scope, const Aws::String& seedSignature) :
+    m_signingKey(signingKey),
+    m_dateTime(dateTime),
+    m_scope(scope),
+    m_priorSignature(seedSignature)
+{
+}
+
+Aws::String ChunkSigner::SignChunk(const unsigned char* data, size_t length)
+{
+    Crypto::Sha256 hash;
+    if (length > 0)
+    {
+        hash.Update(const_cast<unsigned char*>(data), length);
+    }
+
+    Aws::String hashes;
+    hashes.reserve(2 * 64 + 1);
+    hashes.append(EMPTY_STRING_SHA256);
+    hashes.append(AWSAuthHelper::NEWLINE);
+    hashes.append(HashingUtils::HexEncode(hash.GetHash().GetResult()));
+    return Sign(AWS4_HMAC_SHA256_PAYLOAD, hashes);
+}
+
+Aws::String ChunkSigner::SignTrailer(const Aws::String& trailingHeaders)
+{
+    return Sign(AWS4_HMAC_SHA256_TRAILER, HashingUtils::HexEncode(HashingUtils::CalculateSHA256(trailingHeaders)));
+}
+
+Aws::String ChunkSigner::Sign(const char* algorithm, const Aws::String& hashes)
+{
+    Aws::String stringToSign;
+    stringToSign.reserve(32 + m_dateTime.size() + m_scope.size() + m_priorSignature.size() + hashes.size());
+    stringToSign.append(algorithm).append(AWSAuthHelper::NEWLINE);
+    stringToSign.append(m_dateTime).append(AWSAuthHelper::NEWLINE);
+    stringToSign.append(m_scope).append(AWSAuthHelper::NEWLINE);
+    stringToSign.append(m_priorSignature).append(AWSAuthHelper::NEWLINE);
+    stringToSign.append(hashes);
+
+    const ByteBuffer toSign(reinterpret_cast<const unsigned char*>(stringToSign.c_str()), stringToSign.length());
+    m_priorSignature = HashingUtils::HexEncode(HashingUtils::CalculateSHA256HMAC(toSign, m_signingKey));
+    return m_priorSignature;
+}
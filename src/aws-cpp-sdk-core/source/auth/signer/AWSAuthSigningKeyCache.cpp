@@ -0,0 +1,56 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/signer/AWSAuthSigningKeyCache.h>
+#include <aws/core/auth/AWSCredentials.h>
+
+#include <chrono>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+// a signing key is scoped to a single day, keep it a little longer than that so that clock skew adjustments around
+// midnight do not evict the key still in use
+static const std::chrono::milliseconds SIGNING_KEY_CACHE_DURATION = std::chrono::hours(25);
+
+SigningKeyCache::SigningKeyCache(size_t size) :
+    m_keys(size, 4)
+{
+}
+
+ByteBuffer SigningKeyCache::GetSigningKey(const AWSCredentials& credentials,
+                                          const Aws::String& simpleDate,
+                                          const Aws::String& region,
+                                          const Aws::String& serviceName,
+                                          const DeriveKeyFunction& deriveKey) const
+{
+    Aws::String cacheKey;
+    cacheKey.reserve(credentials.GetAWSAccessKeyId().size() + simpleDate.size() + region.size() + serviceName.size() + 3);
+    cacheKey.append(credentials.GetAWSAccessKeyId()).append(1, '/')
+            .append(simpleDate).append(1, '/')
+            .append(region).append(1, '/')
+            .append(serviceName);
+
+    CachedKey cached;
+    const bool found = m_keys.GetOrCompute(cacheKey, cached, [&](CachedKey& derived)
+        {
+            derived.secretKey = credentials.GetAWSSecretKey();
+            derived.signingKey = deriveKey();
+            return derived.signingKey.GetLength() > 0;
+        }, SIGNING_KEY_CACHE_DURATION);
+
+    if (found && cached.secretKey == credentials.GetAWSSecretKey())
+    {
+        return cached.signingKey;
+    }
+
+    // derivation failed or the secret key behind this access key id changed
+    ByteBuffer signingKey = deriveKey();
+    if (signingKey.GetLength() > 0)
+    {
+        m_keys.Put(cacheKey, CachedKey{credentials.GetAWSSecretKey(), signingKey}, SIGNING_KEY_CACHE_DURATION);
+    }
+    return signingKey;
+}
@@ -0,0 +1,28 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/signer/AWSAuthV4Signer.h>
+#include <aws/core/auth/signer/AWSAuthSigningKeyCache.h>
+#include <aws/core/auth/AWSCredentials.h>
+
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+// The keys are scoped by access key id and checked against the secret key, so the signers can share a single cache,
+// which also keeps it out of the layout of the exported signer.
+static Aws::Auth::SigningKeyCache& GetSharedSigningKeyCache()
+{
+    static Aws::Auth::SigningKeyCache signingKeyCache;
+    return signingKeyCache;
+}
+
+ByteBuffer AWSAuthV4Signer::GetSigningKey(const Aws::Auth::AWSCredentials& credentials,
+                                          const Aws::String& simpleDate,
+                                          const Aws::String& region,
+                                          const Aws::String& serviceName) const
+{
+    return GetSharedSigningKeyCache().GetSigningKey(credentials, simpleDate, region, serviceName,
+        [&]() { return ComputeHash(credentials.GetAWSSecretKey(), simpleDate, region, serviceName); });
+}
@@ -0,0 +1,221 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/auth/signer/AWSAuthV4Signer.h>
+#include <aws/core/auth/signer/AWSAuthCanonicalRequestBuilder.h>
+#include <aws/core/auth/signer/AWSAuthChunkSigner.h>
+#include <aws/core/auth/signer/AWSAuthSignerCommon.h>
+#include <aws/core/auth/signer/AWSAuthSignerHelper.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/Sha1.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/stream/AwsChunkedSigningStream.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char V4_STREAMING_LOG_TAG[] = "AWSAuthV4Signer";
+static const char CHECKSUM_HEADER_PREFIX[] = "x-amz-checksum-";
+
+namespace
+{
+    /**
+     * Bytes left in body from its current position, or -1 if it cannot seek.
+     */
+    int64_t GetRemainingLength(Aws::IOStream& body)
+    {
+        const auto current = body.tellg();
+        if (current == std::streampos(std::streamoff(-1)))
+        {
+            body.clear();
+            return -1;
+        }
+        body.seekg(0, std::ios_base::end);
+        const auto end = body.tellg();
+        body.clear();
+        body.seekg(current, std::ios_base::beg);
+        if (end == std::streampos(std::streamoff(-1)))
+        {
+            return -1;
+        }
+        return static_cast<int64_t>(end - current);
+    }
+
+    /**
+     * Digest size of the flexible checksum algorithms, 0 when unknown.
+     */
+    size_t GetChecksumLength(const Aws::String& algorithmName)
+    {
+        if (algorithmName == "crc32" || algorithmName == "crc32c")
+        {
+            return 4;
+        }
+        if (algorithmName == "sha1")
+        {
+            return 20;
+        }
+        if (algorithmName == "sha256")
+        {
+            return 32;
+        }
+        return 0;
+    }
+
+    /**
+     * A new hash of the flexible checksum algorithm, null when unknown.
+     */
+    std::shared_ptr<Aws::Utils::Crypto::Hash> CreateChecksum(const Aws::String& algorithmName)
+    {
+        if (algorithmName == "crc32")
+        {
+            return Aws::MakeShared<Aws::Utils::Crypto::CRC32>(V4_STREAMING_LOG_TAG);
+        }
+        if (algorithmName == "crc32c")
+        {
+            return Aws::MakeShared<Aws::Utils::Crypto::CRC32C>(V4_STREAMING_LOG_TAG);
+        }
+        if (algorithmName == "sha1")
+        {
+            return Aws::MakeShared<Aws::Utils::Crypto::Sha1>(V4_STREAMING_LOG_TAG);
+        }
+        if (algorithmName == "sha256")
+        {
+            return Aws::MakeShared<Aws::Utils::Crypto::Sha256>(V4_STREAMING_LOG_TAG);
+        }
+        return nullptr;
+    }
+}
+
+bool AWSAuthV4Signer::SignStreamingRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName, size_t chunkSize) const
+{
+    const Aws::String signingRegion = region ? region : m_region;
+    const Aws::String signingServiceName = serviceName ? serviceName : m_serviceName;
+
+    if (m_signingAlgorithm == AWSSigningAlgorithm::ASYMMETRIC_SIGV4)
+    {
+        AWS_LOGSTREAM_ERROR(V4_STREAMING_LOG_TAG, "Streaming payload signing is not supported with SigV4a");
+        return false;
+    }
+
+    const auto serviceSpecificParameters = request.GetServiceSpecificParameters();
+    const AWSCredentials credentials = GetCredentials(serviceSpecificParameters ? *serviceSpecificParameters : ServiceSpecificParameters());
+
+    //don't sign anonymous requests
+    if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
+    {
+        return true;
+    }
+
+    std::shared_ptr<Aws::IOStream> body = request.GetContentBody();
+    if (!body)
+    {
+        return SignRequest(request, signingRegion.c_str(), signingServiceName.c_str(), true);
+    }
+    // signed again, e.g. for a retry: encode the original body from its start, not the previous encoding
+    const auto previousEncoding = std::dynamic_pointer_cast<Aws::Utils::Stream::AwsChunkedSigningStream>(body);
+    if (previousEncoding)
+    {
+        body = previousEncoding->GetBody();
+        const std::streampos bodyStart = previousEncoding->GetBodyStart();
+        if (body && bodyStart != std::streampos(std::streamoff(-1)))
+        {
+            body->clear();
+            body->seekg(bodyStart, std::ios_base::beg);
+        }
+        if (!body || bodyStart == std::streampos(std::streamoff(-1)) || !*body)
+        {
+            AWS_LOGSTREAM_ERROR(V4_STREAMING_LOG_TAG, "Unable to sign the request again, its body cannot be rewound to where its upload started");
+            return false;
+        }
+    }
+
+    if (!credentials.GetSessionToken().empty())
+    {
+        request.SetAwsSessionToken(credentials.GetSessionToken());
+    }
+
+    const DateTime now = GetSigningTimestamp();
+    const Aws::String dateHeaderValue = now.ToGmtString(DateFormat::ISO_8601_BASIC);
+    const Aws::String simpleDate = now.ToGmtString(AWSAuthHelper::SIMPLE_DATE_FORMAT_STR);
+    request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
+
+    // the checksum is computed while the body is read, every encoding needs a hash of its own
+    auto requestHash = request.GetRequestHash();
+    Aws::String checksumHeaderName;
+    size_t checksumLength = 0;
+    if (requestHash.second)
+    {
+        requestHash.second = CreateChecksum(requestHash.first);
+        if (!requestHash.second)
+        {
+            AWS_LOGSTREAM_ERROR(V4_STREAMING_LOG_TAG, "Unsupported checksum algorithm for a trailing checksum: " << requestHash.first);
+            return false;
+        }
+        request.SetRequestHash(requestHash.first, requestHash.second);
+        checksumHeaderName = CHECKSUM_HEADER_PREFIX + requestHash.first;
+        checksumLength = GetChecksumLength(requestHash.first);
+        request.DeleteHeader(checksumHeaderName.c_str());
+        request.SetHeaderValue(AWS_TRAILER_HEADER, checksumHeaderName);
+    }
+    const Aws::String payloadHash = requestHash.second ? STREAMING_AWS4_HMAC_SHA256_PAYLOAD_TRAILER : STREAMING_AWS4_HMAC_SHA256_PAYLOAD;
+    request.SetHeaderValue(AWSAuthHelper::X_AMZ_CONTENT_SHA256, payloadHash);
+
+    Aws::String contentEncoding = AWS_CHUNKED_VALUE;
+    if (request.HasHeader(CONTENT_ENCODING_HEADER))
+    {
+        const Aws::String& currentEncoding = request.GetHeaderValue(CONTENT_ENCODING_HEADER);
+        contentEncoding = currentEncoding.find(AWS_CHUNKED_VALUE) == Aws::String::npos ?
+            contentEncoding + "," + currentEncoding : currentEncoding;
+    }
+    request.SetHeaderValue(CONTENT_ENCODING_HEADER, contentEncoding);
+
+    const int64_t decodedLength = GetRemainingLength(*body);
+    if (decodedLength >= 0)
+    {
+        request.SetHeaderValue(DECODED_CONTENT_LENGTH_HEADER, StringUtils::to_string(decodedLength));
+        request.SetContentLength(StringUtils::to_string(Aws::Utils::Stream::AwsChunkedSigningStreamBuf::GetEncodedLength(
+            static_cast<uint64_t>(decodedLength), chunkSize, checksumHeaderName, checksumLength)));
+        request.DeleteHeader(TRANSFER_ENCODING_HEADER);
+    }
+    else
+    {
+        request.DeleteHeader(CONTENT_LENGTH_HEADER);
+        request.SetTransferEncoding(CHUNKED_VALUE);
+    }
+
+    CanonicalRequestBuilder& builder = CanonicalRequestBuilder::ForCurrentThread();
+    builder.Build(request, m_urlEscapePath, payloadHash, [this](const Aws::String& header) { return ShouldSignHeader(header); });
+    AWS_LOGSTREAM_DEBUG(V4_STREAMING_LOG_TAG, "Canonical Header String: " << builder.GetCanonicalRequest());
+
+    const Aws::String canonicalRequestHash = HashingUtils::HexEncode(HashingUtils::CalculateSHA256(builder.GetCanonicalRequest()));
+    const Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, canonicalRequestHash, signingRegion, signingServiceName);
+    const ByteBuffer signingKey = GetSigningKey(credentials, simpleDate, signingRegion, signingServiceName);
+    const Aws::String signature = GenerateSignature(stringToSign, signingKey);
+
+    Aws::String scope;
+    scope.reserve(simpleDate.size() + signingRegion.size() + signingServiceName.size() + 16);
+    scope.append(simpleDate).append("/").append(signingRegion).append("/").append(signingServiceName).append("/").append(AWSAuthHelper::AWS4_REQUEST);
+
+    Aws::String authorization;
+    authorization.append(AWSAuthHelper::AWS_HMAC_SHA256).append(" ");
+    authorization.append(AWSAuthHelper::CREDENTIAL).append(AWSAuthHelper::EQ).append(credentials.GetAWSAccessKeyId()).append("/").append(scope).append(", ");
+    authorization.append(AWSAuthHelper::SIGNED_HEADERS).append(AWSAuthHelper::EQ).append(builder.GetSignedHeaders()).append(", ");
+    authorization.append(SIGNATURE).append(AWSAuthHelper::EQ).append(signature);
+    request.SetAwsAuthorization(authorization);
+    request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
+    request.SetSigningRegion(signingRegion);
+
+    request.AddContentBody(Aws::MakeShared<Aws::Utils::Stream::AwsChunkedSigningStream>(V4_STREAMING_LOG_TAG,
+        body, ChunkSigner(signingKey, dateHeaderValue, scope, signature), chunkSize, checksumHeaderName, requestHash.second));
+    return true;
+}
@@ -0,0 +1,436 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/HedgingPolicy.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/auth/signer/AWSAuthSignerBase.h>
+#include <aws/core/auth/signer/AWSAuthV4Signer.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/monitoring/CoreMetrics.h>
+#include <aws/core/monitoring/MonitoringManager.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UUID.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/TimerQueue.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+using namespace Aws;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char AWS_CLIENT_ASYNC_LOG_TAG[] = "AWSClientAsync";
+
+/**
+ * State of an asynchronous request, shared by its attempts.
+ */
+struct AWSClient::AsyncRequestContext
+{
+    URI uri;
+    std::shared_ptr<const AmazonWebServiceRequest> request;
+    HttpMethod method;
+    Aws::String signerName;
+    Aws::String signerRegionOverride;
+    Aws::String signerServiceNameOverride;
+    Threading::Executor* executor;
+    HttpResponseOutcomeHandler handler;
+    Aws::String invocationId;
+    long retries = 0;
+    AWSError<CoreErrors> lastError;
+    // set when another attempt of a hedged request won, the remaining attempts are abandoned
+    std::shared_ptr<std::atomic<bool>> cancelled;
+    // set while the attempt waits on the timer for the send token it reserved
+    bool sendTokenReserved = false;
+    // http request of the last attempt sent
+    std::shared_ptr<HttpRequest> httpRequest;
+    // started with the first attempt, as AttemptExhaustively does
+    Aws::Vector<void*> monitoringContexts;
+    bool monitoringStarted = false;
+};
+
+/**
+ * State of a hedged request, shared by its first attempt and its hedge.
+ */
+struct AWSClient::HedgedRequestState
+{
+    URI uri;
+    std::shared_ptr<const AmazonWebServiceRequest> request;
+    HttpMethod method;
+    Aws::String signerName;
+    Aws::String signerRegionOverride;
+    Aws::String signerServiceNameOverride;
+    Threading::Executor* executor;
+    std::shared_ptr<HedgingPolicy> policy;
+    HttpResponseOutcomeHandler handler;
+    Aws::String invocationId;
+    std::chrono::steady_clock::time_point start;
+
+    std::mutex mutex;
+    // cancellation flags of the attempts sent so far
+    Aws::Vector<std::shared_ptr<std::atomic<bool>>> attempts;
+    size_t pendingAttempts = 0;
+    bool completed = false;
+};
+
+static void RunOnExecutor(Threading::Executor* executor, std::function<void()>&& task)
+{
+    if (!executor || !executor->Submit(std::function<void()>(task)))
+    {
+        task();
+    }
+}
+
+/**
+ * Signs an attempt. Chunked requests signed with SigV4 are sent aws-chunked, each chunk signed as the body is read.
+ */
+static bool SignAttempt(AWSAuthSigner* signer, HttpRequest& httpRequest, const AmazonWebServiceRequest& request,
+                        const char* signerRegion, const char* signerServiceName)
+{
+    if (!signer)
+    {
+        return false;
+    }
+    if (request.IsChunked())
+    {
+        const auto v4Signer = dynamic_cast<const AWSAuthV4Signer*>(signer);
+        if (v4Signer && std::strcmp(v4Signer->GetName(), Aws::Auth::SIGV4_SIGNER) == 0)
+        {
+            return v4Signer->SignStreamingRequest(httpRequest, signerRegion, signerServiceName);
+        }
+    }
+    return signer->SignRequest(httpRequest, signerRegion, signerServiceName, request.SignBody());
+}
+
+void AWSClient::AttemptExhaustivelyAsync(const URI& uri,
+                                         const std::shared_ptr<const AmazonWebServiceRequest>& request,
+                                         HttpMethod httpMethod,
+                                         const char* signerName,
+                                         Threading::Executor* executor,
+                                         HttpResponseOutcomeHandler&& handler,
+                                         const char* signerRegionOverride,
+                                         const char* signerServiceNameOverride) const
+{
+    AttemptOneRequestAsync(CreateAsyncRequestContext(uri, request, httpMethod, signerName, executor, std::move(handler),
+                                                     signerRegionOverride, signerServiceNameOverride));
+}
+
+std::shared_ptr<AWSClient::AsyncRequestContext> AWSClient::CreateAsyncRequestContext(const URI& uri,
+                                                                                     const std::shared_ptr<const AmazonWebServiceRequest>& request,
+                                                                                     HttpMethod httpMethod,
+                                                                                     const char* signerName,
+                                                                                     Threading::Executor* executor,
+                                                                                     HttpResponseOutcomeHandler&& handler,
+                                                                                     const char* signerRegionOverride,
+                                                                                     const char* signerServiceNameOverride) const
+{
+    auto context = Aws::MakeShared<AsyncRequestContext>(AWS_CLIENT_ASYNC_LOG_TAG);
+    context->uri = uri;
+    context->request = request;
+    context->method = httpMethod;
+    context->signerName = signerName;
+    context->signerRegionOverride = signerRegionOverride ? signerRegionOverride : "";
+    context->signerServiceNameOverride = signerServiceNameOverride ? signerServiceNameOverride : "";
+    context->executor = executor;
+    context->handler = std::move(handler);
+    context->invocationId = UUID::PseudoRandomUUID();
+    return context;
+}
+
+void AWSClient::AttemptHedgedAsync(const URI& uri,
+                                   const std::shared_ptr<const AmazonWebServiceRequest>& request,
+                                   HttpMethod httpMethod,
+                                   const char* signerName,
+                                   Threading::Executor* executor,
+                                   const std::shared_ptr<HedgingPolicy>& hedgingPolicy,
+                                   HttpResponseOutcomeHandler&& handler,
+                                   const char* signerRegionOverride,
+                                   const char* signerServiceNameOverride) const
+{
+    if (!hedgingPolicy)
+    {
+        AttemptExhaustivelyAsync(uri, request, httpMethod, signerName, executor, std::move(handler), signerRegionOverride, signerServiceNameOverride);
+        return;
+    }
+
+    auto state = Aws::MakeShared<HedgedRequestState>(AWS_CLIENT_ASYNC_LOG_TAG);
+    state->uri = uri;
+    state->request = request;
+    state->method = httpMethod;
+    state->signerName = signerName;
+    state->signerRegionOverride = signerRegionOverride ? signerRegionOverride : "";
+    state->signerServiceNameOverride = signerServiceNameOverride ? signerServiceNameOverride : "";
+    state->executor = executor;
+    state->policy = hedgingPolicy;
+    state->handler = std::move(handler);
+    state->invocationId = UUID::PseudoRandomUUID();
+    state->start = std::chrono::steady_clock::now();
+
+    auto context = CreateAsyncRequestContext(uri, request, httpMethod, signerName, executor,
+        HedgedRequestHandler(state, 0), signerRegionOverride, signerServiceNameOverride);
+    context->invocationId = state->invocationId;
+    context->cancelled = Aws::MakeShared<std::atomic<bool>>(AWS_CLIENT_ASYNC_LOG_TAG, false);
+    state->attempts.push_back(context->cancelled);
+    state->pendingAttempts = 1;
+
+    const auto hedgeDelay = std::chrono::duration_cast<std::chrono::milliseconds>(hedgingPolicy->GetHedgeDelay() + std::chrono::microseconds(999));
+    GetRetryTimer()->Schedule(hedgeDelay, [this, state]()
+    {
+        RunOnExecutor(state->executor, [this, state]() { SendHedgeAsync(state); });
+    });
+
+    AttemptOneRequestAsync(context);
+}
+
+void AWSClient::SendHedgeAsync(const std::shared_ptr<HedgedRequestState>& state) const
+{
+    std::shared_ptr<AsyncRequestContext> context;
+    {
+        std::lock_guard<std::mutex> locker(state->mutex);
+        if (state->completed || !state->policy->TryAcquireHedge())
+        {
+            return;
+        }
+        context = CreateAsyncRequestContext(state->uri, state->request, state->method, state->signerName.c_str(), state->executor,
+            HedgedRequestHandler(state, state->attempts.size()),
+            state->signerRegionOverride.empty() ? nullptr : state->signerRegionOverride.c_str(),
+            state->signerServiceNameOverride.empty() ? nullptr : state->signerServiceNameOverride.c_str());
+        context->invocationId = state->invocationId;
+        context->cancelled = Aws::MakeShared<std::atomic<bool>>(AWS_CLIENT_ASYNC_LOG_TAG, false);
+        state->attempts.push_back(context->cancelled);
+        state->pendingAttempts++;
+    }
+
+    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_ASYNC_LOG_TAG, "First attempt of " << state->request->GetServiceRequestName()
+        << " did not complete within the hedge delay, sending a hedge.");
+    AttemptOneRequestAsync(context);
+}
+
+HttpResponseOutcomeHandler AWSClient::HedgedRequestHandler(const std::shared_ptr<HedgedRequestState>& state, size_t attempt)
+{
+    return [state, attempt](HttpResponseOutcome&& outcome)
+    {
+        bool hedged = false;
+        {
+            std::lock_guard<std::mutex> locker(state->mutex);
+            if (state->completed)
+            {
+                return;
+            }
+            state->pendingAttempts--;
+            // keep waiting for the other attempt, its outcome is returned whether it succeeds or not
+            if (!outcome.IsSuccess() && state->pendingAttempts > 0)
+            {
+                return;
+            }
+            state->completed = true;
+            hedged = state->attempts.size() > 1;
+            for (size_t i = 0; i < state->attempts.size(); ++i)
+            {
+                if (i != attempt)
+                {
+                    state->attempts[i]->store(true);
+                }
+            }
+        }
+
+        if (attempt > 0 && outcome.IsSuccess())
+        {
+            state->policy->RecordHedgeWon();
+        }
+        state->policy->RecordRequest(outcome.IsSuccess(), hedged,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - state->start));
+        state->handler(std::move(outcome));
+    };
+}
+
+void AWSClient::AttemptOneRequestAsync(const std::shared_ptr<AsyncRequestContext>& context) const
+{
+    const AmazonWebServiceRequest& request = *context->request;
+    if (context->cancelled && context->cancelled->load())
+    {
+        FinishRequestAsync(context, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::USER_CANCELLED, "", "Request was cancelled", false)));
+        return;
+    }
+    if (!context->sendTokenReserved)
+    {
+        long delayMs = 0;
+        if (!m_retryStrategy->ReserveSendToken(delayMs))
+        {
+            AWS_LOGSTREAM_ERROR(AWS_CLIENT_ASYNC_LOG_TAG, "Unable to acquire enough send tokens to execute request.");
+            FinishRequestAsync(context, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::SLOW_DOWN, "", "Unable to acquire enough send tokens to execute request.", false)));
+            return;
+        }
+        if (delayMs > 0)
+        {
+            // the rate limit is waited out on the timer rather than on this thread, the attempt is sent once it fires
+            auto attempt = [this, context]() { AttemptOneRequestAsync(context); };
+            context->sendTokenReserved = true;
+            if (GetRetryTimer()->Schedule(std::chrono::milliseconds(delayMs), [context, attempt]() { RunOnExecutor(context->executor, attempt); }))
+            {
+                return;
+            }
+        }
+    }
+    context->sendTokenReserved = false;
+    std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(context->uri, context->method, request.GetResponseStreamFactory()));
+    context->httpRequest = httpRequest;
+    if (!context->monitoringStarted)
+    {
+        context->monitoringContexts = Aws::Monitoring::OnRequestStarted(GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
+        context->monitoringStarted = true;
+    }
+    BuildHttpRequest(request, httpRequest);
+    httpRequest->SetEventStreamRequest(request.IsEventStreamRequest());
+    if (context->cancelled)
+    {
+        // abort the transfer once another attempt won
+        ContinueRequestHandler continueRequest = httpRequest->GetContinueRequestHandler();
+        std::shared_ptr<std::atomic<bool>> cancelled = context->cancelled;
+        httpRequest->SetContinueRequestHandle([continueRequest, cancelled](const HttpRequest* pRequest)
+        {
+            return !cancelled->load() && (!continueRequest || continueRequest(pRequest));
+        });
+    }
+    AppendRecursionDetectionHeader(httpRequest);
+    httpRequest->SetHeaderValue(SDK_INVOCATION_ID_HEADER, context->invocationId);
+    Aws::String requestInfo = "attempt=" + StringUtils::to_string(context->retries + 1);
+    if (m_retryStrategy->GetMaxAttempts() > 0)
+    {
+        requestInfo += "; max=" + StringUtils::to_string(m_retryStrategy->GetMaxAttempts());
+    }
+    httpRequest->SetHeaderValue(SDK_REQUEST_HEADER, requestInfo);
+
+    AWSAuthSigner* signer = GetSignerByName(context->signerName.c_str());
+    const char* signerRegion = context->signerRegionOverride.empty() ? nullptr : context->signerRegionOverride.c_str();
+    const char* signerServiceName = context->signerServiceNameOverride.empty() ? nullptr : context->signerServiceNameOverride.c_str();
+    if (!SignAttempt(signer, *httpRequest, request, signerRegion, signerServiceName))
+    {
+        AWS_LOGSTREAM_ERROR(AWS_CLIENT_ASYNC_LOG_TAG, "Request signing failed. Returning error.");
+        HttpResponseOutcome outcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false));
+        Aws::Monitoring::OnRequestFailed(GetServiceClientName(), request.GetServiceRequestName(), httpRequest, outcome,
+            Aws::Monitoring::CoreMetricsCollection(), context->monitoringContexts);
+        FinishRequestAsync(context, std::move(outcome));
+        return;
+    }
+    if (request.GetRequestSignedHandler())
+    {
+        request.GetRequestSignedHandler()(*httpRequest);
+    }
+
+    AWS_LOGSTREAM_TRACE(AWS_CLIENT_ASYNC_LOG_TAG, "Sending asynchronous request, attempt " << context->retries + 1 << ".");
+    m_httpClient->MakeRequestAsync(httpRequest,
+        [this, context](const std::shared_ptr<HttpResponse>& response)
+        {
+            // leave the http client's thread before unmarshalling anything
+            RunOnExecutor(context->executor, [this, context, response]() { CompleteAttemptAsync(context, response); });
+        },
+        m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
+
+void AWSClient::CompleteAttemptAsync(const std::shared_ptr<AsyncRequestContext>& context, const std::shared_ptr<HttpResponse>& response) const
+{
+    if (context->cancelled && context->cancelled->load())
+    {
+        // another attempt of the hedged request won, this one was aborted and is neither accounted for nor retried
+        FinishRequestAsync(context, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::USER_CANCELLED, "", "Request was cancelled", false)));
+        return;
+    }
+
+    HttpResponseOutcome outcome;
+    if (!response || DoesResponseGenerateError(response))
+    {
+        outcome = HttpResponseOutcome(BuildAWSError(response));
+    }
+    else if (context->request->HasEmbeddedError(response->GetResponseBody(), response->GetHeaders()))
+    {
+        outcome = HttpResponseOutcome(GetErrorMarshaller()->Marshall(*response));
+    }
+    else
+    {
+        outcome = HttpResponseOutcome(response);
+    }
+
+    const AmazonWebServiceRequest& request = *context->request;
+    Aws::Monitoring::CoreMetricsCollection coreMetrics;
+    coreMetrics.httpClientMetrics = context->httpRequest->GetRequestMetrics();
+    if (outcome.IsSuccess())
+    {
+        m_retryStrategy->RequestBookkeeping(outcome);
+        Aws::Monitoring::OnRequestSucceeded(GetServiceClientName(), request.GetServiceRequestName(), context->httpRequest, outcome,
+            coreMetrics, context->monitoringContexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_ASYNC_LOG_TAG, "Request successful returning.");
+        FinishRequestAsync(context, std::move(outcome));
+        return;
+    }
+
+    m_retryStrategy->RequestBookkeeping(outcome, context->lastError);
+    Aws::Monitoring::OnRequestFailed(GetServiceClientName(), request.GetServiceRequestName(), context->httpRequest, outcome,
+        coreMetrics, context->monitoringContexts);
+    if (!m_httpClient->IsRequestProcessingEnabled() || !m_retryStrategy->ShouldRetry(outcome.GetError(), context->retries))
+    {
+        FinishRequestAsync(context, std::move(outcome));
+        return;
+    }
+
+    const long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), context->retries);
+    // AdjustClockSkew returns true when the clock skew was the problem and was adjusted, retry right away in that case.
+    const bool shouldSleep = !AdjustClockSkew(outcome, context->signerName.c_str());
+    context->lastError = outcome.GetError();
+    context->retries++;
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_ASYNC_LOG_TAG, "Request failed, now waiting " << (shouldSleep ? sleepMillis : 0)
+        << " ms before attempting again. " << context->lastError);
+
+    auto retry = [this, context]()
+    {
+        const AmazonWebServiceRequest& retriedRequest = *context->request;
+        if (retriedRequest.GetRequestRetryHandler())
+        {
+            retriedRequest.GetRequestRetryHandler()(retriedRequest);
+        }
+        Aws::Monitoring::OnRequestRetry(GetServiceClientName(), retriedRequest.GetServiceRequestName(), context->httpRequest,
+            context->monitoringContexts);
+        AttemptOneRequestAsync(context);
+    };
+    if (!shouldSleep || sleepMillis <= 0 ||
+        !GetRetryTimer()->Schedule(std::chrono::milliseconds(sleepMillis), [context, retry]() { RunOnExecutor(context->executor, retry); }))
+    {
+        RunOnExecutor(context->executor, retry);
+    }
+}
+
+void AWSClient::FinishRequestAsync(const std::shared_ptr<AsyncRequestContext>& context, HttpResponseOutcome&& outcome) const
+{
+    if (context->monitoringStarted)
+    {
+        Aws::Monitoring::OnFinish(GetServiceClientName(), context->request->GetServiceRequestName(), context->httpRequest,
+            context->monitoringContexts);
+    }
+    context->handler(std::move(outcome));
+}
+
+std::shared_ptr<Threading::TimerQueue> AWSClient::GetRetryTimer() const
+{
+    // most clients never retry asynchronously, the timer and its thread are only created when needed
+    std::shared_ptr<Threading::TimerQueue> timer = std::atomic_load(&m_retryTimer);
+    if (!timer)
+    {
+        auto created = Aws::MakeShared<Threading::TimerQueue>(AWS_CLIENT_ASYNC_LOG_TAG);
+        timer = std::atomic_compare_exchange_strong(&m_retryTimer, &timer, created) ? created : timer;
+    }
+    return timer;
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/AWSJsonClient.h>
+#include <aws/core/client/HedgingPolicy.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/AmazonWebServiceRequest.h>
+#include <aws/core/endpoint/AWSEndpoint.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+using namespace Aws;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+static const char AWS_JSON_CLIENT_ASYNC_LOG_TAG[] = "AWSJsonClientAsync";
+
+void AWSJsonClient::MakeRequestAsync(const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                                     const Aws::Endpoint::AWSEndpoint& endpoint,
+                                     Aws::Utils::Threading::Executor* executor,
+                                     JsonOutcomeHandler&& handler,
+                                     Http::HttpMethod method,
+                                     const char* signerName,
+                                     const std::shared_ptr<HedgingPolicy>& hedgingPolicy) const
+{
+    const char* signerRegionOverride = nullptr;
+    const char* signerServiceNameOverride = nullptr;
+    if (endpoint.GetAttributes())
+    {
+        signerName = endpoint.GetAttributes()->authScheme.GetName().c_str();
+        if (endpoint.GetAttributes()->authScheme.GetSigningRegion())
+        {
+            signerRegionOverride = endpoint.GetAttributes()->authScheme.GetSigningRegion()->c_str();
+        }
+        if (endpoint.GetAttributes()->authScheme.GetSigningRegionSet())
+        {
+            signerRegionOverride = endpoint.GetAttributes()->authScheme.GetSigningRegionSet()->c_str();
+        }
+        if (endpoint.GetAttributes()->authScheme.GetSigningName())
+        {
+            signerServiceNameOverride = endpoint.GetAttributes()->authScheme.GetSigningName()->c_str();
+        }
+    }
+
+    const std::shared_ptr<HedgingPolicy> policy =
+        hedgingPolicy && hedgingPolicy->IsHedgeable(request->GetServiceRequestName()) ? hedgingPolicy : nullptr;
+    // the signer arguments are copied by AttemptHedgedAsync, the endpoint does not have to outlive this call
+    AttemptHedgedAsync(endpoint.GetURI(), request, method, signerName, executor, policy,
+        [handler](HttpResponseOutcome&& httpOutcome)
+        {
+            if (!httpOutcome.IsSuccess())
+            {
+                handler(JsonOutcome(std::move(httpOutcome)));
+                return;
+            }
+
+            const std::shared_ptr<HttpResponse>& response = httpOutcome.GetResult();
+            if (response->GetResponseBody().tellp() > 0)
+            {
+                JsonValue jsonValue(response->GetResponseBody());
+                if (!jsonValue.WasParseSuccessful())
+                {
+                    AWS_LOGSTREAM_ERROR(AWS_JSON_CLIENT_ASYNC_LOG_TAG, "Failed to parse response: " << jsonValue.GetErrorMessage());
+                    handler(JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false)));
+                    return;
+                }
+                handler(JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue), response->GetHeaders(), response->GetResponseCode())));
+                return;
+            }
+
+            handler(JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), response->GetHeaders())));
+        },
+        signerRegionOverride, signerServiceNameOverride);
+}
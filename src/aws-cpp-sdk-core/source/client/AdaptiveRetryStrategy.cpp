@@ -0,0 +1,387 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/AdaptiveRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+namespace Client
+{
+
+static const char TAG[] = "AdaptiveRetryStrategy";
+
+static const double MIN_FILL_RATE = 0.5;
+static const double MIN_CAPACITY = 1;
+
+static const double SMOOTH = 0.8;
+static const double BETA = 0.7;
+static const double SCALE_CONSTANT = 0.4;
+
+static const char RATE_METRIC_TYPE[] = "{request}/s";
+
+const char RETRY_TOKEN_BUCKET_FILL_RATE_METRIC[] = "smithy.client.retry.token_bucket.fill_rate";
+const char RETRY_TOKEN_BUCKET_MEASURED_TX_RATE_METRIC[] = "smithy.client.retry.token_bucket.measured_tx_rate";
+
+// A list of errors that are considered throttling errors.
+static const char* THROTTLING_EXCEPTIONS[] {
+    "Throttling", "ThrottlingException", "ThrottledException", "RequestThrottledException",
+    "TooManyRequestsException", "ProvisionedThroughputExceededException", "TransactionInProgressException",
+    "RequestLimitExceeded", "BandwidthLimitExceeded", "LimitExceededException", "RequestThrottled",
+    "SlowDown", "PriorRequestNotComplete", "EC2ThrottledException"};
+
+static const size_t THROTTLING_EXCEPTIONS_SZ = sizeof(THROTTLING_EXCEPTIONS) / sizeof(THROTTLING_EXCEPTIONS[0]);
+
+static int64_t ToNanoseconds(const RetryTokenBucket::Clock::time_point& timestamp)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count();
+}
+
+static double ToSeconds(const RetryTokenBucket::Clock::duration& duration)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double>>(duration).count();
+}
+
+// Maps a wall clock time of the former DateTime based interface to the monotonic clock, relative to the current time.
+static RetryTokenBucket::Clock::time_point ToClockTime(const DateTime& timestamp)
+{
+    return RetryTokenBucket::Clock::now() + std::chrono::milliseconds(timestamp.Millis() - DateTime::CurrentTimeMillis());
+}
+
+RetryTokenBucket::RetryTokenBucket(double fillRate, double maxCapacity, double currentCapacity,
+                                   const Clock::time_point& lastTimestamp, double measuredTxRate, double lastTxRateBucket,
+                                   size_t requestCount, bool enabled, double lastMaxRate, const Clock::time_point& lastThrottleTime) :
+    m_fillRate(fillRate),
+    m_maxCapacity(maxCapacity),
+    m_emptyTimestamp(ToNanoseconds(lastTimestamp) - (fillRate > 0 ? static_cast<int64_t>(currentCapacity / fillRate * 1e9) : 0)),
+    m_measuredTxRate(measuredTxRate),
+    m_lastTxRateBucket(static_cast<int64_t>(std::floor(lastTxRateBucket * 2.0))),
+    m_requestCount(requestCount),
+    m_enabled(enabled),
+    m_lastMaxRate(lastMaxRate),
+    m_lastThrottleTime(lastThrottleTime)
+{}
+
+RetryTokenBucket::RetryTokenBucket(double fillRate, double maxCapacity, double currentCapacity,
+                                   const DateTime& lastTimestamp, double measuredTxRate, double lastTxRateBucket,
+                                   size_t requestCount, bool enabled, double lastMaxRate, const DateTime& lastThrottleTime) :
+    RetryTokenBucket(fillRate, maxCapacity, currentCapacity, ToClockTime(lastTimestamp), measuredTxRate,
+                     ToSeconds(Clock::now().time_since_epoch()) + lastTxRateBucket - static_cast<double>(DateTime::CurrentTimeMillis()) / 1000.0,
+                     requestCount, enabled, lastMaxRate, ToClockTime(lastThrottleTime))
+{}
+
+RetryTokenBucket::~RetryTokenBucket()
+{
+    for (auto& gauge : m_gauges)
+    {
+        gauge->Stop();
+    }
+}
+
+bool RetryTokenBucket::Acquire(size_t amount, bool fastFail)
+{
+    // the common case of a client which was never throttled, without reading the clock
+    if (!m_enabled.load(std::memory_order_acquire))
+        return true;
+
+    return Acquire(amount, fastFail, Clock::now());
+}
+
+bool RetryTokenBucket::Reserve(size_t amount, bool fastFail, std::chrono::nanoseconds& wait)
+{
+    wait = std::chrono::nanoseconds(0);
+    if (!m_enabled.load(std::memory_order_acquire))
+        return true;
+
+    return Reserve(amount, fastFail, Clock::now(), wait);
+}
+
+bool RetryTokenBucket::Acquire(size_t amount, bool fastFail, const Clock::time_point& now)
+{
+    std::chrono::nanoseconds wait;
+    if (!Reserve(amount, fastFail, now, wait))
+        return false;
+
+    if (wait.count() > 0)
+    {
+        std::this_thread::sleep_for(wait);
+    }
+    return true;
+}
+
+bool RetryTokenBucket::Reserve(size_t amount, bool fastFail, const Clock::time_point& now, std::chrono::nanoseconds& wait)
+{
+    wait = std::chrono::nanoseconds(0);
+    if (!m_enabled.load(std::memory_order_acquire))
+        return true;
+
+    const int64_t nowNs = ToNanoseconds(now);
+    int64_t emptyTimestamp = m_emptyTimestamp.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const double fillRate = m_fillRate.load(std::memory_order_relaxed);
+        if (fillRate <= 0)
+            return true;
+
+        const double capacity = (std::min)(m_maxCapacity.load(std::memory_order_relaxed),
+                                           static_cast<double>(nowNs - emptyTimestamp) / 1e9 * fillRate);
+        const double remaining = capacity - static_cast<double>(amount);
+        if (remaining < 0 && fastFail)
+            return false;
+
+        // If there is not enough capacity, the tokens are reserved now and the caller waits until they are refilled,
+        // so that concurrent callers queue behind each other rather than waking up together.
+        const int64_t newEmptyTimestamp = nowNs - static_cast<int64_t>(remaining / fillRate * 1e9);
+        if (m_emptyTimestamp.compare_exchange_weak(emptyTimestamp, newEmptyTimestamp, std::memory_order_relaxed))
+        {
+            if (remaining < 0)
+            {
+                wait = std::chrono::nanoseconds(newEmptyTimestamp - nowNs);
+            }
+            return true;
+        }
+    }
+}
+
+double RetryTokenBucket::GetCurrentCapacity(const Clock::time_point& now) const
+{
+    return (std::min)(m_maxCapacity.load(std::memory_order_relaxed),
+                      static_cast<double>(ToNanoseconds(now) - m_emptyTimestamp.load(std::memory_order_relaxed)) / 1e9 *
+                      m_fillRate.load(std::memory_order_relaxed));
+}
+
+void RetryTokenBucket::UpdateRate(double newRps, const Clock::time_point& now)
+{
+    const double fillRate = (std::max)(newRps, MIN_FILL_RATE);
+    const double maxCapacity = (std::max)(newRps, MIN_CAPACITY);
+    // The rate is not updated before rate limiting is enabled, the bucket then starts full.
+    double capacity = maxCapacity;
+    if (m_fillRate.load(std::memory_order_relaxed) > 0)
+    {
+        capacity = (std::min)(GetCurrentCapacity(now), maxCapacity);
+    }
+
+    m_fillRate.store(fillRate, std::memory_order_relaxed);
+    m_maxCapacity.store(maxCapacity, std::memory_order_relaxed);
+    m_emptyTimestamp.store(ToNanoseconds(now) - static_cast<int64_t>(capacity / fillRate * 1e9), std::memory_order_relaxed);
+}
+
+void RetryTokenBucket::Refill(const DateTime&)
+{
+}
+
+void RetryTokenBucket::UpdateMeasuredRate(const Clock::time_point& now)
+{
+    const int64_t timeBucket = static_cast<int64_t>(std::floor(ToSeconds(now.time_since_epoch()) * 2.0));
+    m_requestCount.fetch_add(1, std::memory_order_relaxed);
+
+    int64_t lastTxRateBucket = m_lastTxRateBucket.load(std::memory_order_relaxed);
+    // only the response which moves to a new time bucket updates the smoothed rate
+    if (timeBucket > lastTxRateBucket &&
+        m_lastTxRateBucket.compare_exchange_strong(lastTxRateBucket, timeBucket, std::memory_order_relaxed))
+    {
+        const size_t requestCount = m_requestCount.exchange(0, std::memory_order_relaxed);
+        const double currentRate = static_cast<double>(requestCount) / (static_cast<double>(timeBucket - lastTxRateBucket) / 2.0);
+        m_measuredTxRate.store((currentRate * SMOOTH) + (m_measuredTxRate.load(std::memory_order_relaxed) * (1 - SMOOTH)),
+                               std::memory_order_relaxed);
+    }
+}
+
+void RetryTokenBucket::UpdateClientSendingRate(bool isThrottlingResponse)
+{
+    UpdateClientSendingRate(isThrottlingResponse, Clock::now());
+}
+
+void RetryTokenBucket::UpdateClientSendingRate(bool isThrottlingResponse, const DateTime& now)
+{
+    UpdateClientSendingRate(isThrottlingResponse, ToClockTime(now));
+}
+
+void RetryTokenBucket::UpdateClientSendingRate(bool isThrottlingResponse, const Clock::time_point& now)
+{
+    UpdateMeasuredRate(now);
+
+    // The fill rate only matters once rate limiting is enabled by a throttling response.
+    if (!isThrottlingResponse && !m_enabled.load(std::memory_order_relaxed))
+        return;
+
+    std::unique_lock<std::mutex> locker(m_rateMutex, std::defer_lock);
+    if (isThrottlingResponse)
+    {
+        locker.lock();
+    }
+    else if (!locker.try_lock())
+    {
+        // another response is updating the rate, which already accounts for the rate measured so far
+        return;
+    }
+
+    const double measuredTxRate = m_measuredTxRate.load(std::memory_order_relaxed);
+    double calculatedRate = 0.0;
+    if (isThrottlingResponse)
+    {
+        double rateToUse = measuredTxRate;
+        if (m_enabled.load(std::memory_order_relaxed))
+            rateToUse = (std::min)(rateToUse, m_fillRate.load(std::memory_order_relaxed));
+
+        m_lastMaxRate = rateToUse;
+        m_lastThrottleTime = now;
+
+        calculatedRate = CUBICThrottle(rateToUse);
+    }
+    else
+    {
+        double timeWindow = CalculateTimeWindow();
+        calculatedRate = CUBICSuccess(now, timeWindow);
+    }
+
+    double newRate = (std::min)(calculatedRate, 2.0 * measuredTxRate);
+    UpdateRate(newRate, now);
+    if (isThrottlingResponse)
+        Enable();
+}
+
+void RetryTokenBucket::Enable()
+{
+    m_enabled.store(true, std::memory_order_release);
+}
+
+double RetryTokenBucket::CalculateTimeWindow() const
+{
+    return pow(((m_lastMaxRate * (1.0 - BETA)) / SCALE_CONSTANT), (1.0 / 3));
+}
+
+double RetryTokenBucket::CUBICSuccess(const Clock::time_point& timestamp, const double timeWindow) const
+{
+    double dt = ToSeconds(timestamp - m_lastThrottleTime);
+    double calculatedRate = SCALE_CONSTANT * pow(dt - timeWindow, 3.0) + m_lastMaxRate;
+    return calculatedRate;
+}
+
+double RetryTokenBucket::CUBICThrottle(const double rateToUse) const
+{
+    double calculatedRate = rateToUse * BETA;
+    return calculatedRate;
+}
+
+void RetryTokenBucket::RegisterMetrics(const smithy::components::tracing::Meter& meter,
+                                       const Aws::Map<Aws::String, Aws::String>& attributes)
+{
+    using namespace smithy::components::tracing;
+    auto fillRateGauge = meter.CreateGauge(RETRY_TOKEN_BUCKET_FILL_RATE_METRIC,
+        [this, attributes](Aws::UniquePtr<AsyncMeasurement> measurement)
+        {
+            measurement->Record(IsEnabled() ? GetFillRate() : 0.0, attributes);
+        },
+        RATE_METRIC_TYPE,
+        "Rate at which the adaptive retry token bucket refills, 0 while it does not limit the sending rate");
+    auto measuredTxRateGauge = meter.CreateGauge(RETRY_TOKEN_BUCKET_MEASURED_TX_RATE_METRIC,
+        [this, attributes](Aws::UniquePtr<AsyncMeasurement> measurement)
+        {
+            measurement->Record(GetMeasuredTxRate(), attributes);
+        },
+        RATE_METRIC_TYPE,
+        "Smoothed sending rate measured by the adaptive retry token bucket");
+
+    std::lock_guard<std::mutex> locker(m_rateMutex);
+    m_gauges.emplace_back(std::move(fillRateGauge));
+    m_gauges.emplace_back(std::move(measuredTxRateGauge));
+}
+
+AdaptiveRetryStrategy::AdaptiveRetryStrategy(long maxAttempts) :
+    StandardRetryStrategy(maxAttempts),
+    m_retryTokenBucket(Aws::MakeShared<RetryTokenBucket>(TAG))
+{}
+
+AdaptiveRetryStrategy::AdaptiveRetryStrategy(std::shared_ptr<RetryQuotaContainer> retryQuotaContainer, long maxAttempts) :
+    StandardRetryStrategy(retryQuotaContainer, maxAttempts),
+    m_retryTokenBucket(Aws::MakeShared<RetryTokenBucket>(TAG))
+{}
+
+AdaptiveRetryStrategy::AdaptiveRetryStrategy(std::shared_ptr<RetryTokenBucket> retryTokenBucket,
+                                             std::shared_ptr<RetryQuotaContainer> retryQuotaContainer, long maxAttempts) :
+    StandardRetryStrategy(retryQuotaContainer, maxAttempts),
+    m_retryTokenBucket(retryTokenBucket ? retryTokenBucket : Aws::MakeShared<RetryTokenBucket>(TAG))
+{}
+
+bool AdaptiveRetryStrategy::HasSendToken()
+{
+    return m_retryTokenBucket->Acquire(1, m_fastFail);
+}
+
+bool AdaptiveRetryStrategy::ReserveSendToken(long& delayMs)
+{
+    std::chrono::nanoseconds wait;
+    const bool reserved = m_retryTokenBucket->Reserve(1, m_fastFail, wait);
+    // rounded up, sending early would exceed the rate
+    delayMs = static_cast<long>((wait.count() + 999999) / 1000000);
+    return reserved;
+}
+
+void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome)
+{
+    if (httpResponseOutcome.IsSuccess())
+    {
+        m_retryQuotaContainer->ReleaseRetryQuota(Aws::Client::NO_RETRY_INCREMENT);
+        m_retryTokenBucket->UpdateClientSendingRate(false);
+    }
+    else
+    {
+        m_retryTokenBucket->UpdateClientSendingRate(IsThrottlingResponse(httpResponseOutcome));
+    }
+}
+
+void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError)
+{
+    if (httpResponseOutcome.IsSuccess())
+    {
+        m_retryQuotaContainer->ReleaseRetryQuota(lastError);
+        m_retryTokenBucket->UpdateClientSendingRate(false);
+    }
+    else
+    {
+        m_retryTokenBucket->UpdateClientSendingRate(IsThrottlingResponse(httpResponseOutcome));
+    }
+}
+
+bool AdaptiveRetryStrategy::IsThrottlingResponse(const HttpResponseOutcome& httpResponseOutcome)
+{
+    if(httpResponseOutcome.IsSuccess())
+        return false;
+
+    const AWSError<CoreErrors>& error = httpResponseOutcome.GetError();
+    const Aws::Client::CoreErrors enumValue = error.GetErrorType();
+    switch(enumValue)
+    {
+        case Aws::Client::CoreErrors::THROTTLING:
+        case Aws::Client::CoreErrors::SLOW_DOWN:
+            return true;
+        default:
+            break;
+    }
+
+    if(std::find(THROTTLING_EXCEPTIONS,
+                 THROTTLING_EXCEPTIONS + THROTTLING_EXCEPTIONS_SZ, error.GetExceptionName()) != THROTTLING_EXCEPTIONS + THROTTLING_EXCEPTIONS_SZ)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace Client
+} // namespace Aws
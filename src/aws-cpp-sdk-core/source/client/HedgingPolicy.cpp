@@ -0,0 +1,149 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/HedgingPolicy.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Aws
+{
+    namespace Client
+    {
+        static const int64_t TOKEN = 1000;
+
+        static size_t GetLatencyBucket(int64_t latencyUs, size_t bucketCount)
+        {
+            if (latencyUs <= 1)
+            {
+                return 0;
+            }
+            const size_t bucket = static_cast<size_t>(std::log2(static_cast<double>(latencyUs)) * 4.0);
+            return (std::min)(bucket, bucketCount - 1);
+        }
+
+        static int64_t GetLatencyBucketUpperBound(size_t bucket)
+        {
+            return static_cast<int64_t>(std::ceil(std::exp2(static_cast<double>(bucket + 1) / 4.0)));
+        }
+
+        HedgingPolicy::HedgingPolicy(const Aws::Set<Aws::String>& hedgeableOperations,
+                                     std::chrono::milliseconds hedgeDelay,
+                                     double latencyPercentile,
+                                     std::chrono::milliseconds minHedgeDelay,
+                                     double budgetRatio,
+                                     size_t maxBudget) :
+            m_hedgeableOperations(hedgeableOperations),
+            m_hedgeDelay(hedgeDelay),
+            m_latencyPercentile((std::min)((std::max)(latencyPercentile, 0.0), 1.0)),
+            m_minHedgeDelay(minHedgeDelay),
+            m_tokensPerRequest(static_cast<int64_t>((std::max)(budgetRatio, 0.0) * TOKEN)),
+            m_maxTokens(static_cast<int64_t>(maxBudget) * TOKEN),
+            m_tokens(static_cast<int64_t>(maxBudget) * TOKEN),
+            m_latencyWindow(0),
+            m_latencySamples(0),
+            m_adaptiveDelayUs(0),
+            m_hedgesSent(0),
+            m_hedgesWon(0)
+        {
+            for (auto& window : m_latencyCounts)
+            {
+                for (auto& count : window)
+                {
+                    count.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool HedgingPolicy::IsHedgeable(const char* operationName) const
+        {
+            return operationName && m_hedgeableOperations.find(operationName) != m_hedgeableOperations.end();
+        }
+
+        std::chrono::microseconds HedgingPolicy::GetHedgeDelay() const
+        {
+            if (m_hedgeDelay.count() > 0)
+            {
+                return m_hedgeDelay;
+            }
+            return (std::max)(m_minHedgeDelay, std::chrono::microseconds(m_adaptiveDelayUs.load(std::memory_order_relaxed)));
+        }
+
+        bool HedgingPolicy::TryAcquireHedge()
+        {
+            int64_t tokens = m_tokens.load(std::memory_order_relaxed);
+            do
+            {
+                if (tokens < TOKEN)
+                {
+                    return false;
+                }
+            } while (!m_tokens.compare_exchange_weak(tokens, tokens - TOKEN, std::memory_order_relaxed));
+            m_hedgesSent.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void HedgingPolicy::RecordRequest(bool success, bool hedged, std::chrono::microseconds latency)
+        {
+            if (!success)
+            {
+                return;
+            }
+            RecordLatency(latency);
+            if (hedged)
+            {
+                return;
+            }
+
+            int64_t tokens = m_tokens.load(std::memory_order_relaxed);
+            while (tokens < m_maxTokens &&
+                   !m_tokens.compare_exchange_weak(tokens, (std::min)(tokens + m_tokensPerRequest, m_maxTokens), std::memory_order_relaxed))
+            {
+            }
+        }
+
+        double HedgingPolicy::GetAvailableBudget() const
+        {
+            return static_cast<double>(m_tokens.load(std::memory_order_relaxed)) / TOKEN;
+        }
+
+        void HedgingPolicy::RecordLatency(std::chrono::microseconds latency)
+        {
+            const size_t window = m_latencyWindow.load(std::memory_order_acquire);
+            m_latencyCounts[window][GetLatencyBucket(latency.count(), LATENCY_BUCKETS)].fetch_add(1, std::memory_order_relaxed);
+            // the request completing the window computes its percentile and starts the other one
+            if (m_latencySamples.fetch_add(1, std::memory_order_acq_rel) + 1 == LATENCY_WINDOW)
+            {
+                UpdateAdaptiveDelay(window);
+                for (auto& count : m_latencyCounts[1 - window])
+                {
+                    count.store(0, std::memory_order_relaxed);
+                }
+                m_latencyWindow.store(1 - window, std::memory_order_release);
+                m_latencySamples.store(0, std::memory_order_release);
+            }
+        }
+
+        void HedgingPolicy::UpdateAdaptiveDelay(size_t window)
+        {
+            uint64_t total = 0;
+            for (const auto& count : m_latencyCounts[window])
+            {
+                total += count.load(std::memory_order_relaxed);
+            }
+            const uint64_t rank = static_cast<uint64_t>(std::ceil(static_cast<double>(total) * m_latencyPercentile));
+            uint64_t seen = 0;
+            for (size_t bucket = 0; bucket < LATENCY_BUCKETS; ++bucket)
+            {
+                seen += m_latencyCounts[window][bucket].load(std::memory_order_relaxed);
+                if (seen >= rank)
+                {
+                    m_adaptiveDelayUs.store(GetLatencyBucketUpperBound(bucket), std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    } // namespace Client
+} // namespace Aws
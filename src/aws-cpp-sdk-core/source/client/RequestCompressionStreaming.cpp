@@ -0,0 +1,35 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/client/RequestCompression.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/stream/GzipCompressingStream.h>
+
+static const char AWS_REQUEST_COMPRESSION_LOG_TAG[] = "RequestCompression";
+
+iostream_outcome Aws::Client::RequestCompression::compressStreaming(
+    std::shared_ptr<Aws::IOStream> input, const CompressionAlgorithm &algorithm,
+    Aws::Utils::Threading::Executor *executor) const {
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+  if (algorithm == CompressionAlgorithm::GZIP) {
+    return std::shared_ptr<Aws::IOStream>(
+        Aws::MakeShared<Aws::Utils::Stream::GzipCompressingStream>(
+            AWS_REQUEST_COMPRESSION_LOG_TAG, input,
+            Aws::Utils::Stream::GzipCompressingStreamBuf::DEFAULT_BLOCK_SIZE,
+            executor));
+  }
+#else
+  AWS_UNREFERENCED_PARAM(input);
+  AWS_UNREFERENCED_PARAM(executor);
+  AWS_LOGSTREAM_ERROR(AWS_REQUEST_COMPRESSION_LOG_TAG,
+                      "Compressed request not supported when ZLIB is not enabled");
+  return false;
+#endif
+  AWS_LOGSTREAM_ERROR(AWS_REQUEST_COMPRESSION_LOG_TAG,
+                      "Compress request requested in runtime without support: "
+                          << GetCompressionAlgorithmId(algorithm));
+  return false;
+}
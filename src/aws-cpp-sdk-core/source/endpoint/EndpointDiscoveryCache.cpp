@@ -0,0 +1,190 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/endpoint/EndpointDiscoveryCache.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
+
+using namespace Aws::Endpoint;
+
+static const char ENDPOINT_DISCOVERY_CACHE_TAG[] = "EndpointDiscoveryCache";
+// Delay before retrying a failed background refresh while the cached address is still valid.
+static const std::chrono::seconds FAILED_REFRESH_RETRY_DELAY(30);
+
+/**
+ * State of a background refresh, owned by its task: the key is released when the task is destroyed, whether it ran or
+ * was dropped unrun by the executor.
+ */
+struct EndpointDiscoveryCache::RefreshTask
+{
+    RefreshTask(EndpointDiscoveryCache& refreshedCache, const Aws::String& refreshedKey, std::shared_ptr<void>&& ownerGuard) :
+        cache(refreshedCache), key(refreshedKey), guard(std::move(ownerGuard))
+    {
+    }
+
+    ~RefreshTask()
+    {
+        cache.EndRefresh(key);
+    }
+
+    EndpointDiscoveryCache& cache;
+    Aws::String key;
+    // released after the key, keeps the owner of the cache alive
+    std::shared_ptr<void> guard;
+};
+
+EndpointDiscoveryCache::EndpointDiscoveryCache(size_t size, double refreshAheadRatio) :
+    m_cache(size),
+    m_refreshAheadRatio(refreshAheadRatio > 0.0 && refreshAheadRatio < 1.0 ? refreshAheadRatio : 1.0)
+{
+}
+
+DiscoverEndpointOutcome EndpointDiscoveryCache::GetOrDiscover(const Aws::String& key,
+                                                              const DiscoverEndpointFunction& discover,
+                                                              Aws::Utils::Threading::Executor* executor)
+{
+    CachedEndpoint cached;
+    if (m_cache.Get(key, cached))
+    {
+        const auto now = Clock::now();
+        if (now >= cached.refreshAt)
+        {
+            ScheduleRefresh(key, cached, discover, executor);
+        }
+        return DiscoveredEndpoint{cached.address, std::chrono::duration_cast<std::chrono::minutes>(cached.expiresAt - now)};
+    }
+
+    std::shared_ptr<std::promise<DiscoverEndpointOutcome>> promise;
+    std::shared_future<DiscoverEndpointOutcome> inFlight;
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightMutex);
+        auto it = m_inFlight.find(key);
+        if (it != m_inFlight.end())
+        {
+            inFlight = it->second;
+        }
+        else
+        {
+            promise = Aws::MakeShared<std::promise<DiscoverEndpointOutcome>>(ENDPOINT_DISCOVERY_CACHE_TAG);
+            inFlight = promise->get_future().share();
+            m_inFlight.emplace(key, inFlight);
+        }
+    }
+
+    if (!promise)
+    {
+        AWS_LOGSTREAM_TRACE(ENDPOINT_DISCOVERY_CACHE_TAG, "Waiting for in-flight endpoint discovery of key: " << key);
+        return inFlight.get();
+    }
+
+    // Completes the discovery from its destructor, so that the waiters are released and the in-flight entry erased
+    // even if discover() exits with an exception.
+    struct InFlightDiscovery
+    {
+        InFlightDiscovery(EndpointDiscoveryCache& discoveryCache, const Aws::String& discoveredKey, std::promise<DiscoverEndpointOutcome>& discoveryPromise) :
+            cache(discoveryCache), key(discoveredKey), promise(discoveryPromise),
+            outcome(Aws::Client::AWSError<Aws::Client::CoreErrors>(Aws::Client::CoreErrors::INTERNAL_FAILURE, "", "Endpoint discovery did not complete", false))
+        {
+        }
+
+        ~InFlightDiscovery()
+        {
+            cache.CompleteDiscovery(key, outcome, nullptr);
+            promise.set_value(outcome);
+        }
+
+        EndpointDiscoveryCache& cache;
+        const Aws::String& key;
+        std::promise<DiscoverEndpointOutcome>& promise;
+        DiscoverEndpointOutcome outcome;
+    } inFlightDiscovery(*this, key, *promise);
+
+    // Another caller may have completed a discovery between the cache lookup and the in-flight registration.
+    inFlightDiscovery.outcome = m_cache.Get(key, cached) ?
+        DiscoverEndpointOutcome(DiscoveredEndpoint{cached.address, std::chrono::duration_cast<std::chrono::minutes>(cached.expiresAt - Clock::now())}) :
+        discover();
+    return inFlightDiscovery.outcome;
+}
+
+void EndpointDiscoveryCache::SetRefreshGuard(RefreshGuardFunction refreshGuard)
+{
+    m_refreshGuard = std::move(refreshGuard);
+}
+
+void EndpointDiscoveryCache::Put(const Aws::String& key, const Aws::String& address, std::chrono::minutes cachePeriod)
+{
+    const auto now = Clock::now();
+    const auto refreshAfter = std::chrono::duration_cast<Clock::duration>(cachePeriod * m_refreshAheadRatio);
+    m_cache.Put(key, CachedEndpoint{address, now + refreshAfter, now + cachePeriod}, cachePeriod);
+}
+
+void EndpointDiscoveryCache::ScheduleRefresh(const Aws::String& key, const CachedEndpoint& current,
+                                             const DiscoverEndpointFunction& discover, Aws::Utils::Threading::Executor* executor)
+{
+    std::shared_ptr<void> guard;
+    if (m_refreshGuard)
+    {
+        guard = m_refreshGuard();
+        if (!guard)
+        {
+            AWS_LOGSTREAM_TRACE(ENDPOINT_DISCOVERY_CACHE_TAG, "Skipping refresh of endpoint of key: " << key << ", the owner is shutting down.");
+            return;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightMutex);
+        if (m_inFlight.find(key) != m_inFlight.end() || !m_refreshing.insert(key).second)
+        {
+            return;
+        }
+    }
+
+    AWS_LOGSTREAM_TRACE(ENDPOINT_DISCOVERY_CACHE_TAG, "Refreshing endpoint of key: " << key << " ahead of its expiration.");
+    auto task = Aws::MakeShared<RefreshTask>(ENDPOINT_DISCOVERY_CACHE_TAG, *this, key, std::move(guard));
+    auto refresh = [this, task, current, discover]()
+    {
+        CompleteDiscovery(task->key, discover(), &current);
+    };
+
+    if (!executor || !executor->Submit(std::function<void()>(refresh)))
+    {
+        refresh();
+    }
+}
+
+void EndpointDiscoveryCache::CompleteDiscovery(const Aws::String& key, const DiscoverEndpointOutcome& outcome, const CachedEndpoint* current)
+{
+    if (outcome.IsSuccess())
+    {
+        Put(key, outcome.GetResult().address, outcome.GetResult().cachePeriod);
+        AWS_LOGSTREAM_TRACE(ENDPOINT_DISCOVERY_CACHE_TAG, "Endpoints cache updated. Address: " << outcome.GetResult().address
+            << ". Valid in: " << outcome.GetResult().cachePeriod.count() << " minutes.");
+    }
+    else if (current)
+    {
+        // Keep serving the still valid address, and retry the refresh later rather than on the next request.
+        const auto now = Clock::now();
+        if (now < current->expiresAt)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(current->expiresAt - now);
+            const auto retryAt = (std::min)(now + std::chrono::duration_cast<Clock::duration>(FAILED_REFRESH_RETRY_DELAY), current->expiresAt);
+            m_cache.Put(key, CachedEndpoint{current->address, retryAt, current->expiresAt}, remaining);
+        }
+        AWS_LOGSTREAM_WARN(ENDPOINT_DISCOVERY_CACHE_TAG, "Failed to refresh endpoint of key: " << key << ". " << outcome.GetError());
+    }
+
+    if (!current)
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightMutex);
+        m_inFlight.erase(key);
+    }
+}
+
+void EndpointDiscoveryCache::EndRefresh(const Aws::String& key)
+{
+    std::lock_guard<std::mutex> locker(m_inFlightMutex);
+    m_refreshing.erase(key);
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/endpoint/EndpointResolutionCache.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Endpoint;
+using namespace Aws::Utils::Threading;
+
+const char EndpointResolutionCache::ENDPOINT_CACHE_HIT_METRIC[] = "smithy.client.resolve_endpoint.cache_hits";
+const char EndpointResolutionCache::ENDPOINT_CACHE_MISS_METRIC[] = "smithy.client.resolve_endpoint.cache_misses";
+
+static const char ENDPOINT_CACHE_COUNT_UNIT[] = "Count";
+
+namespace
+{
+    // Length-prefixed serialization, so that no combination of names and values can produce the same key
+    // for two different parameter sets.
+    void AppendParameters(Aws::String& key, const EndpointParameters& parameters)
+    {
+        for (const auto& parameter : parameters)
+        {
+            key.append(Aws::Utils::StringUtils::to_string(parameter.GetName().size()));
+            key.push_back(':');
+            key.append(parameter.GetName());
+            if (parameter.GetStoredType() == EndpointParameter::ParameterType::BOOLEAN)
+            {
+                key.push_back(parameter.GetBoolValueNoCheck() ? 'T' : 'F');
+            }
+            else
+            {
+                key.push_back('S');
+                key.append(Aws::Utils::StringUtils::to_string(parameter.GetStrValueNoCheck().size()));
+                key.push_back(':');
+                key.append(parameter.GetStrValueNoCheck());
+            }
+        }
+        key.push_back(';');
+    }
+}
+
+void EndpointResolutionCache::Configure(size_t maxEntries, const std::shared_ptr<smithy::components::tracing::Meter>& meter)
+{
+    Invalidate();
+    m_hitCounter.reset();
+    m_missCounter.reset();
+    if (maxEntries > 0 && meter)
+    {
+        m_hitCounter = meter->CreateCounter(ENDPOINT_CACHE_HIT_METRIC, ENDPOINT_CACHE_COUNT_UNIT, "Number of endpoint resolutions served from the cache");
+        m_missCounter = meter->CreateCounter(ENDPOINT_CACHE_MISS_METRIC, ENDPOINT_CACHE_COUNT_UNIT, "Number of endpoint resolutions evaluated by the rules engine");
+    }
+    m_maxEntriesPerShard.store(maxEntries == 0 ? 0 : (maxEntries + SHARD_COUNT - 1) / SHARD_COUNT, std::memory_order_relaxed);
+}
+
+Aws::String EndpointResolutionCache::ComputeKey(const EndpointParameters& builtInParameters,
+                                                const EndpointParameters& clientContextParameters,
+                                                const EndpointParameters& endpointParameters)
+{
+    Aws::String key;
+    key.reserve(256);
+    AppendParameters(key, builtInParameters);
+    AppendParameters(key, clientContextParameters);
+    AppendParameters(key, endpointParameters);
+    return key;
+}
+
+EndpointResolutionCache::Shard& EndpointResolutionCache::GetShard(const Aws::String& key) const
+{
+    return m_shards[std::hash<Aws::String>()(key) % SHARD_COUNT];
+}
+
+bool EndpointResolutionCache::Get(const Aws::String& key, AWSEndpoint& endpoint) const
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    bool found = false;
+    {
+        const Shard& shard = GetShard(key);
+        ReaderLockGuard guard(shard.lock);
+        auto it = shard.entries.find(key);
+        if (it != shard.entries.end())
+        {
+            endpoint = it->second;
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        if (m_hitCounter)
+        {
+            m_hitCounter->add(1, {});
+        }
+    }
+    else
+    {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        if (m_missCounter)
+        {
+            m_missCounter->add(1, {});
+        }
+    }
+    return found;
+}
+
+void EndpointResolutionCache::Put(Aws::String key, const AWSEndpoint& endpoint, size_t generation)
+{
+    const size_t maxEntriesPerShard = m_maxEntriesPerShard.load(std::memory_order_relaxed);
+    if (maxEntriesPerShard == 0)
+    {
+        return;
+    }
+
+    Shard& shard = GetShard(key);
+    WriterLockGuard guard(shard.lock);
+    if (generation != m_generation.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end())
+    {
+        it->second = endpoint;
+        return;
+    }
+    if (shard.entries.size() >= maxEntriesPerShard)
+    {
+        shard.entries.erase(shard.entries.begin());
+    }
+    shard.entries.emplace(std::move(key), endpoint);
+}
+
+void EndpointResolutionCache::Invalidate()
+{
+    m_generation.fetch_add(1, std::memory_order_acq_rel);
+    for (auto& shard : m_shards)
+    {
+        WriterLockGuard guard(shard.lock);
+        shard.entries.clear();
+    }
+}
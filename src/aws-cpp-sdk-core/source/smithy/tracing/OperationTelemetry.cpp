@@ -0,0 +1,86 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <smithy/tracing/OperationTelemetry.h>
+#include <smithy/tracing/NoopMeterProvider.h>
+#include <smithy/tracing/NoopTracerProvider.h>
+#include <smithy/tracing/TracingUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+using namespace smithy::components::tracing;
+using namespace Aws::Utils::Threading;
+
+static const char OPERATION_TELEMETRY_TAG[] = "OperationTelemetry";
+
+OperationTelemetry::OperationTelemetry(TelemetryProvider& telemetryProvider,
+    const char* serviceName,
+    const char* operationName) :
+    m_operationName(operationName),
+    m_spanName(Aws::String(serviceName) + "." + operationName),
+    m_spanAttributes({
+        {TracingUtils::SMITHY_METHOD_DIMENSION, operationName},
+        {TracingUtils::SMITHY_SERVICE_DIMENSION, serviceName},
+        {TracingUtils::SMITHY_SYSTEM_DIMENSION, TracingUtils::SMITHY_METHOD_AWS_VALUE}}),
+    m_metricAttributes(Aws::MakeShared<Aws::Map<Aws::String, Aws::String>>(OPERATION_TELEMETRY_TAG,
+        Aws::Map<Aws::String, Aws::String>({
+            {TracingUtils::SMITHY_METHOD_DIMENSION, operationName},
+            {TracingUtils::SMITHY_SERVICE_DIMENSION, serviceName}}))),
+    m_tracer(telemetryProvider.getTracer(serviceName, {})),
+    m_meter(telemetryProvider.getMeter(serviceName, {}))
+{
+    if (!m_tracer) {
+        AWS_LOGSTREAM_ERROR(OPERATION_TELEMETRY_TAG, "No tracer for " << m_spanName << ", spans are not recorded");
+        m_tracer = Aws::MakeShared<NoopTracer>(OPERATION_TELEMETRY_TAG);
+    }
+    if (!m_meter) {
+        AWS_LOGSTREAM_ERROR(OPERATION_TELEMETRY_TAG, "No meter for " << m_spanName << ", metrics are not recorded");
+        m_meter = Aws::MakeShared<NoopMeter>(OPERATION_TELEMETRY_TAG);
+    }
+    m_durationHistogram = CreateHistogram(TracingUtils::SMITHY_CLIENT_DURATION_METRIC);
+    m_endpointResolutionHistogram = CreateHistogram(TracingUtils::SMITHY_CLIENT_ENDPOINT_RESOLUTION_METRIC);
+}
+
+std::shared_ptr<TraceSpan> OperationTelemetry::CreateSpan() const {
+    return m_tracer->CreateSpan(m_spanName, m_spanAttributes, SpanKind::CLIENT);
+}
+
+Aws::UniquePtr<Histogram> OperationTelemetry::CreateHistogram(const char* metricName) const {
+    auto histogram = m_meter->CreateHistogram(metricName, TracingUtils::MICROSECOND_METRIC_TYPE, "");
+    if (!histogram) {
+        AWS_LOGSTREAM_ERROR(OPERATION_TELEMETRY_TAG, "Failed to create histogram " << metricName);
+        histogram = Aws::MakeUnique<NoopHistogram>(OPERATION_TELEMETRY_TAG);
+    }
+    return histogram;
+}
+
+OperationTelemetryCache& OperationTelemetryCache::operator=(const OperationTelemetryCache& other) {
+    if (this != &other) {
+        WriterLockGuard guard(m_lock);
+        m_operations.clear();
+    }
+    return *this;
+}
+
+const OperationTelemetry& OperationTelemetryCache::Get(TelemetryProvider& telemetryProvider,
+    const char* serviceName,
+    const char* operationName) const {
+    {
+        ReaderLockGuard guard(m_lock);
+        auto it = m_operations.find(operationName);
+        if (it != m_operations.end()) {
+            return *it->second;
+        }
+    }
+
+    WriterLockGuard guard(m_lock);
+    auto it = m_operations.find(operationName);
+    if (it != m_operations.end()) {
+        return *it->second;
+    }
+    auto telemetry = Aws::MakeUnique<OperationTelemetry>(OPERATION_TELEMETRY_TAG, telemetryProvider, serviceName, operationName);
+    const OperationTelemetry& result = *telemetry;
+    m_operations.emplace(result.GetOperationName().c_str(), std::move(telemetry));
+    return result;
+}
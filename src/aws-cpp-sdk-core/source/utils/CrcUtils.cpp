@@ -0,0 +1,593 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/CrcUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <istream>
+#include <mutex>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define AWS_CRC_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AWS_TARGET_SSE42
+#define AWS_TARGET_PCLMUL
+#else
+#define AWS_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define AWS_TARGET_PCLMUL __attribute__((target("sse4.1,pclmul")))
+#endif
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_CRC32) && !defined(__AARCH64EB__)
+#define AWS_CRC_ARM
+#include <arm_acle.h>
+#endif
+
+using namespace Aws::Utils;
+
+namespace
+{
+    // bit-reflected polynomials
+    const uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+    const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+    // block size of the interleaved hardware loops, 3 blocks are checksummed at once then merged
+    const size_t INTERLEAVED_BLOCK_SIZE = 4096;
+    const size_t STREAM_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * Returns a * b modulo the polynomial, both in the bit-reflected representation. a must not be 0.
+     */
+    uint32_t MultiplyModulo(uint32_t a, uint32_t b, uint32_t polynomial)
+    {
+        uint32_t mask = 1u << 31;
+        uint32_t product = 0;
+        for (;;)
+        {
+            if (a & mask)
+            {
+                product ^= b;
+                if ((a & (mask - 1)) == 0)
+                {
+                    break;
+                }
+            }
+            mask >>= 1;
+            b = (b & 1) ? (b >> 1) ^ polynomial : b >> 1;
+        }
+        return product;
+    }
+
+    /**
+     * Lookup tables of one polynomial: slicing-by-8 tables, and x^(2^n) modulo the polynomial used to combine checksums.
+     */
+    struct CrcTables
+    {
+        explicit CrcTables(uint32_t crcPolynomial) : polynomial(crcPolynomial)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+                }
+                slices[0][i] = crc;
+            }
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (size_t slice = 1; slice < 8; ++slice)
+                {
+                    slices[slice][i] = (slices[slice - 1][i] >> 8) ^ slices[0][slices[slice - 1][i] & 0xFF];
+                }
+            }
+
+            // x^1, then successive squares
+            uint32_t power = 1u << 30;
+            for (size_t n = 0; n < POWER_COUNT; ++n)
+            {
+                powersOfTwo[n] = power;
+                power = MultiplyModulo(power, power, polynomial);
+            }
+            blockShift = ShiftOperator(INTERLEAVED_BLOCK_SIZE);
+            doubleBlockShift = ShiftOperator(2 * INTERLEAVED_BLOCK_SIZE);
+        }
+
+        /**
+         * Returns x^(8 * length) modulo the polynomial, the factor appending length zero bytes multiplies a checksum by.
+         */
+        uint32_t ShiftOperator(uint64_t length) const
+        {
+            uint32_t result = 1u << 31;
+            // 8 * length = length * 2^3
+            for (size_t n = 3; length != 0; length >>= 1, ++n)
+            {
+                if (length & 1)
+                {
+                    result = MultiplyModulo(powersOfTwo[n], result, polynomial);
+                }
+            }
+            return result;
+        }
+
+        uint32_t Combine(uint32_t crc1, uint32_t crc2, uint64_t length2) const
+        {
+            return MultiplyModulo(ShiftOperator(length2), crc1, polynomial) ^ crc2;
+        }
+
+        uint32_t polynomial;
+        uint32_t slices[8][256];
+        // enough for any 64-bit length in bytes
+        static const size_t POWER_COUNT = 67;
+        uint32_t powersOfTwo[POWER_COUNT];
+        uint32_t blockShift;
+        uint32_t doubleBlockShift;
+    };
+
+    const CrcTables& GetCRC32Tables()
+    {
+        static const CrcTables tables(CRC32_POLYNOMIAL);
+        return tables;
+    }
+
+    const CrcTables& GetCRC32CTables()
+    {
+        static const CrcTables tables(CRC32C_POLYNOMIAL);
+        return tables;
+    }
+
+    /*
+     * The update functions work on the raw crc register, without the initial and final inversion of the checksum.
+     */
+    typedef uint32_t (*CrcUpdateFunction)(uint32_t crc, const unsigned char* data, size_t length);
+
+    inline uint32_t SlicingBy8Update(const CrcTables& tables, uint32_t crc, const unsigned char* data, size_t length)
+    {
+        const uint32_t (&t)[8][256] = tables.slices;
+        for (; length >= 8; data += 8, length -= 8)
+        {
+            crc ^= static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+                (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+            crc = t[7][crc & 0xFF] ^ t[6][(crc >> 8) & 0xFF] ^ t[5][(crc >> 16) & 0xFF] ^ t[4][crc >> 24] ^
+                t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+        }
+        for (; length > 0; ++data, --length)
+        {
+            crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+        }
+        return crc;
+    }
+
+    uint32_t TableCRC32Update(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        return SlicingBy8Update(GetCRC32Tables(), crc, data, length);
+    }
+
+    uint32_t TableCRC32CUpdate(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        return SlicingBy8Update(GetCRC32CTables(), crc, data, length);
+    }
+
+    /**
+     * Merges the raw crcs of 3 consecutive blocks, the first one continuing the preceding data, the other two started from 0.
+     * This relies on the linearity of the crc: crc(c, A|B) = c * x^(8|B|) ^ crc(0, A|B), with |B| the length of B in bytes.
+     */
+    inline uint32_t MergeInterleaved(const CrcTables& tables, uint32_t first, uint32_t second, uint32_t third)
+    {
+        return MultiplyModulo(tables.doubleBlockShift, first, tables.polynomial) ^
+            MultiplyModulo(tables.blockShift, second, tables.polynomial) ^ third;
+    }
+
+#if defined(AWS_CRC_X86)
+    AWS_TARGET_SSE42 uint32_t Sse42CRC32CBlock(uint32_t crc, const unsigned char* data, size_t length)
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        uint64_t crc64 = crc;
+        for (; length >= 8; data += 8, length -= 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            crc64 = _mm_crc32_u64(crc64, value);
+        }
+        crc = static_cast<uint32_t>(crc64);
+#endif
+        for (; length >= 4; data += 4, length -= 4)
+        {
+            uint32_t value;
+            std::memcpy(&value, data, sizeof(value));
+            crc = _mm_crc32_u32(crc, value);
+        }
+        for (; length > 0; ++data, --length)
+        {
+            crc = _mm_crc32_u8(crc, *data);
+        }
+        return crc;
+    }
+
+    /**
+     * The crc32 instruction has a latency of 3 cycles but a throughput of 1, so 3 blocks are checksummed at once.
+     */
+    AWS_TARGET_SSE42 uint32_t Sse42CRC32CUpdate(uint32_t crc, const unsigned char* data, size_t length)
+    {
+#if defined(__x86_64__) || defined(_M_X64)
+        if (length >= 3 * INTERLEAVED_BLOCK_SIZE)
+        {
+            const CrcTables& tables = GetCRC32CTables();
+            for (; length >= 3 * INTERLEAVED_BLOCK_SIZE; data += 3 * INTERLEAVED_BLOCK_SIZE, length -= 3 * INTERLEAVED_BLOCK_SIZE)
+            {
+                uint64_t first = crc;
+                uint64_t second = 0;
+                uint64_t third = 0;
+                for (size_t i = 0; i < INTERLEAVED_BLOCK_SIZE; i += 8)
+                {
+                    uint64_t values[3];
+                    std::memcpy(&values[0], data + i, sizeof(uint64_t));
+                    std::memcpy(&values[1], data + INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                    std::memcpy(&values[2], data + 2 * INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                    first = _mm_crc32_u64(first, values[0]);
+                    second = _mm_crc32_u64(second, values[1]);
+                    third = _mm_crc32_u64(third, values[2]);
+                }
+                crc = MergeInterleaved(tables, static_cast<uint32_t>(first), static_cast<uint32_t>(second), static_cast<uint32_t>(third));
+            }
+        }
+#endif
+        return Sse42CRC32CBlock(crc, data, length);
+    }
+
+    /**
+     * Folds 64 byte blocks with carry-less multiplications down to 128 bits, then reduces them to the crc
+     * (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", constants for the bit-reflected CRC32).
+     * length must be at least 64 and a multiple of 16.
+     */
+    AWS_TARGET_PCLMUL uint32_t PclmulCRC32Fold(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+        const __m128i polynomial = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48));
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        data += 64;
+        length -= 64;
+
+        // fold 4 x 128 bits in parallel
+        for (; length >= 64; data += 64, length -= 64)
+        {
+            const __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+            const __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+            const __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+            const __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 32)));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 48)));
+        }
+
+        // fold into a single 128 bit value, then the remaining 16 byte blocks into it
+        const __m128i folded[3] = { x2, x3, x4 };
+        for (size_t i = 0; i < 3; ++i)
+        {
+            const __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, folded[i]), x5);
+        }
+        for (; length >= 16; data += 16, length -= 16)
+        {
+            const __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+            x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data))), x5);
+        }
+
+        // 128 to 64 bits
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_and_si128(x1, mask32);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k5k0, 0x00), x2);
+
+        // Barrett reduction to 32 bits
+        x2 = _mm_and_si128(x1, mask32);
+        x2 = _mm_clmulepi64_si128(x2, polynomial, 0x10);
+        x2 = _mm_and_si128(x2, mask32);
+        x2 = _mm_clmulepi64_si128(x2, polynomial, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+        return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+
+    uint32_t PclmulCRC32Update(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        if (length >= 64)
+        {
+            const size_t folded = length & ~static_cast<size_t>(15);
+            crc = PclmulCRC32Fold(crc, data, folded);
+            data += folded;
+            length -= folded;
+        }
+        return TableCRC32Update(crc, data, length);
+    }
+#endif // AWS_CRC_X86
+
+#if defined(AWS_CRC_ARM)
+    uint32_t ArmCRC32Block(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        for (; length >= 8; data += 8, length -= 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            crc = __crc32d(crc, value);
+        }
+        for (; length > 0; ++data, --length)
+        {
+            crc = __crc32b(crc, *data);
+        }
+        return crc;
+    }
+
+    uint32_t ArmCRC32CBlock(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        for (; length >= 8; data += 8, length -= 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            crc = __crc32cd(crc, value);
+        }
+        for (; length > 0; ++data, --length)
+        {
+            crc = __crc32cb(crc, *data);
+        }
+        return crc;
+    }
+
+    /**
+     * As on x86, the crc instructions are pipelined across 3 blocks.
+     */
+    uint32_t ArmCRC32Update(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        const CrcTables& tables = GetCRC32Tables();
+        for (; length >= 3 * INTERLEAVED_BLOCK_SIZE; data += 3 * INTERLEAVED_BLOCK_SIZE, length -= 3 * INTERLEAVED_BLOCK_SIZE)
+        {
+            uint32_t first = crc;
+            uint32_t second = 0;
+            uint32_t third = 0;
+            for (size_t i = 0; i < INTERLEAVED_BLOCK_SIZE; i += 8)
+            {
+                uint64_t values[3];
+                std::memcpy(&values[0], data + i, sizeof(uint64_t));
+                std::memcpy(&values[1], data + INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                std::memcpy(&values[2], data + 2 * INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                first = __crc32d(first, values[0]);
+                second = __crc32d(second, values[1]);
+                third = __crc32d(third, values[2]);
+            }
+            crc = MergeInterleaved(tables, first, second, third);
+        }
+        return ArmCRC32Block(crc, data, length);
+    }
+
+    uint32_t ArmCRC32CUpdate(uint32_t crc, const unsigned char* data, size_t length)
+    {
+        const CrcTables& tables = GetCRC32CTables();
+        for (; length >= 3 * INTERLEAVED_BLOCK_SIZE; data += 3 * INTERLEAVED_BLOCK_SIZE, length -= 3 * INTERLEAVED_BLOCK_SIZE)
+        {
+            uint32_t first = crc;
+            uint32_t second = 0;
+            uint32_t third = 0;
+            for (size_t i = 0; i < INTERLEAVED_BLOCK_SIZE; i += 8)
+            {
+                uint64_t values[3];
+                std::memcpy(&values[0], data + i, sizeof(uint64_t));
+                std::memcpy(&values[1], data + INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                std::memcpy(&values[2], data + 2 * INTERLEAVED_BLOCK_SIZE + i, sizeof(uint64_t));
+                first = __crc32cd(first, values[0]);
+                second = __crc32cd(second, values[1]);
+                third = __crc32cd(third, values[2]);
+            }
+            crc = MergeInterleaved(tables, first, second, third);
+        }
+        return ArmCRC32CBlock(crc, data, length);
+    }
+#endif // AWS_CRC_ARM
+
+    struct CrcImplementations
+    {
+        CrcImplementations() :
+            crc32(TableCRC32Update),
+            crc32c(TableCRC32CUpdate),
+            crc32Hardware(false),
+            crc32cHardware(false)
+        {
+#if defined(AWS_CRC_X86)
+#if defined(_MSC_VER)
+            int info[4] = {};
+            __cpuid(info, 1);
+            const bool sse41 = (info[2] & (1 << 19)) != 0;
+            const bool sse42 = (info[2] & (1 << 20)) != 0;
+            const bool pclmul = (info[2] & (1 << 1)) != 0;
+#else
+            __builtin_cpu_init();
+            const bool sse41 = __builtin_cpu_supports("sse4.1") != 0;
+            const bool sse42 = __builtin_cpu_supports("sse4.2") != 0;
+            const bool pclmul = __builtin_cpu_supports("pclmul") != 0;
+#endif
+            if (sse42)
+            {
+                crc32c = Sse42CRC32CUpdate;
+                crc32cHardware = true;
+            }
+            if (sse41 && pclmul)
+            {
+                crc32 = PclmulCRC32Update;
+                crc32Hardware = true;
+            }
+#elif defined(AWS_CRC_ARM)
+            crc32 = ArmCRC32Update;
+            crc32c = ArmCRC32CUpdate;
+            crc32Hardware = true;
+            crc32cHardware = true;
+#endif
+        }
+
+        CrcUpdateFunction crc32;
+        CrcUpdateFunction crc32c;
+        bool crc32Hardware;
+        bool crc32cHardware;
+    };
+
+    const CrcImplementations& GetImplementations()
+    {
+        static const CrcImplementations implementations;
+        return implementations;
+    }
+
+    uint32_t StreamCrc(CrcUpdateFunction update, Aws::IStream& stream)
+    {
+        auto currentPos = stream.tellg();
+        if (currentPos == std::streampos(std::streamoff(-1)))
+        {
+            currentPos = 0;
+            stream.clear();
+        }
+        stream.seekg(0, stream.beg);
+
+        Aws::String chunk(STREAM_CHUNK_SIZE, '\0');
+        uint32_t crc = ~0u;
+        while (stream.good())
+        {
+            stream.read(&chunk[0], static_cast<std::streamsize>(chunk.size()));
+            const size_t read = static_cast<size_t>(stream.gcount());
+            if (read == 0)
+            {
+                break;
+            }
+            crc = update(crc, reinterpret_cast<const unsigned char*>(chunk.data()), read);
+        }
+
+        stream.clear();
+        stream.seekg(currentPos, stream.beg);
+        return ~crc;
+    }
+
+    uint32_t ParallelCrc(uint32_t (*crcFunction)(const unsigned char*, size_t, uint32_t), const CrcTables& tables,
+                         const unsigned char* data, size_t length, Threading::Executor& executor, size_t chunkSize)
+    {
+        if (chunkSize == 0 || length <= chunkSize)
+        {
+            return crcFunction(data, length, 0);
+        }
+
+        const size_t chunkCount = (length + chunkSize - 1) / chunkSize;
+        Aws::Vector<uint32_t> crcs(chunkCount);
+        std::mutex mutex;
+        std::condition_variable chunksDone;
+        size_t pendingChunks = chunkCount - 1;
+
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            std::function<void()> task = [&, chunk]()
+            {
+                const size_t offset = chunk * chunkSize;
+                crcs[chunk] = crcFunction(data + offset, (std::min)(chunkSize, length - offset), 0);
+                std::lock_guard<std::mutex> lock(mutex);
+                --pendingChunks;
+                // notified under the lock, the waiting thread destroys the condition variable as soon as it returns
+                chunksDone.notify_one();
+            };
+            if (!executor.Submit(std::function<void()>(task)))
+            {
+                task();
+            }
+        }
+        crcs[0] = crcFunction(data, chunkSize, 0);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            chunksDone.wait(lock, [&]() { return pendingChunks == 0; });
+        }
+
+        uint32_t crc = crcs[0];
+        for (size_t chunk = 1; chunk < chunkCount; ++chunk)
+        {
+            crc = tables.Combine(crc, crcs[chunk], (std::min)(chunkSize, length - chunk * chunkSize));
+        }
+        return crc;
+    }
+}
+
+uint32_t CrcUtils::CRC32(const unsigned char* data, size_t length, uint32_t crc)
+{
+    return ~GetImplementations().crc32(~crc, data, length);
+}
+
+uint32_t CrcUtils::CRC32C(const unsigned char* data, size_t length, uint32_t crc)
+{
+    return ~GetImplementations().crc32c(~crc, data, length);
+}
+
+uint32_t CrcUtils::CRC32(Aws::IStream& stream)
+{
+    return StreamCrc(GetImplementations().crc32, stream);
+}
+
+uint32_t CrcUtils::CRC32C(Aws::IStream& stream)
+{
+    return StreamCrc(GetImplementations().crc32c, stream);
+}
+
+uint32_t CrcUtils::CombineCRC32(uint32_t crc1, uint32_t crc2, uint64_t length2)
+{
+    return GetCRC32Tables().Combine(crc1, crc2, length2);
+}
+
+uint32_t CrcUtils::CombineCRC32C(uint32_t crc1, uint32_t crc2, uint64_t length2)
+{
+    return GetCRC32CTables().Combine(crc1, crc2, length2);
+}
+
+uint32_t CrcUtils::ParallelCRC32(const unsigned char* data, size_t length, Threading::Executor& executor, size_t chunkSize)
+{
+    return ParallelCrc(CrcUtils::CRC32, GetCRC32Tables(), data, length, executor, chunkSize);
+}
+
+uint32_t CrcUtils::ParallelCRC32C(const unsigned char* data, size_t length, Threading::Executor& executor, size_t chunkSize)
+{
+    return ParallelCrc(CrcUtils::CRC32C, GetCRC32CTables(), data, length, executor, chunkSize);
+}
+
+ByteBuffer CrcUtils::ToByteBuffer(uint32_t crc)
+{
+    ByteBuffer buffer(4);
+    buffer[0] = static_cast<unsigned char>(crc >> 24);
+    buffer[1] = static_cast<unsigned char>(crc >> 16);
+    buffer[2] = static_cast<unsigned char>(crc >> 8);
+    buffer[3] = static_cast<unsigned char>(crc);
+    return buffer;
+}
+
+bool CrcUtils::IsCRC32HardwareAccelerated()
+{
+    return GetImplementations().crc32Hardware;
+}
+
+bool CrcUtils::IsCRC32CHardwareAccelerated()
+{
+    return GetImplementations().crc32cHardware;
+}
@@ -0,0 +1,842 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/EncodingUtils.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define AWS_ENCODING_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC allows intrinsics of any instruction set without per function target attributes
+#define AWS_TARGET_SSE41
+#define AWS_TARGET_AVX2
+#else
+#define AWS_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define AWS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define AWS_ENCODING_NEON
+#include <arm_neon.h>
+#endif
+
+using namespace Aws::Utils;
+
+namespace
+{
+    const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    const char BASE64_PADDING = '=';
+    const char HEX_DIGITS[] = "0123456789abcdef";
+
+    // 6 bit values of the base64 alphabet, 0xFF for any other character
+    const uint8_t BASE64_VALUES[256] =
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+        0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    };
+
+    // streams are processed in chunks of this size, a multiple of 3 and 4 so that no partial group is carried over
+    const size_t STREAM_CHUNK_SIZE = 48 * 1024;
+
+    SimdLevel DetectSimdLevel()
+    {
+#if defined(AWS_ENCODING_X86)
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        const int maxLeaf = info[0];
+        __cpuid(info, 1);
+        const bool sse41 = (info[2] & (1 << 19)) != 0;
+        // AVX2 also needs the OS to save the ymm registers: OSXSAVE, AVX and the XCR0 SSE and AVX state bits
+        const bool avxEnabled = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+        bool avx2 = false;
+        if (maxLeaf >= 7 && avxEnabled)
+        {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+#else
+        __builtin_cpu_init();
+        const bool sse41 = __builtin_cpu_supports("sse4.1") != 0;
+        const bool avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+        return avx2 ? SimdLevel::Avx2 : (sse41 ? SimdLevel::Sse41 : SimdLevel::Scalar);
+#elif defined(AWS_ENCODING_NEON)
+        // NEON is part of the ARMv8-A baseline
+        return SimdLevel::Neon;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    SimdLevel SupportedSimdLevel()
+    {
+        static const SimdLevel supportedLevel = DetectSimdLevel();
+        return supportedLevel;
+    }
+
+    std::atomic<int>& ActiveSimdLevel()
+    {
+        static std::atomic<int> activeLevel(static_cast<int>(SupportedSimdLevel()));
+        return activeLevel;
+    }
+
+    inline SimdLevel CurrentSimdLevel()
+    {
+        return static_cast<SimdLevel>(ActiveSimdLevel().load(std::memory_order_relaxed));
+    }
+
+    /*
+     * Scalar codecs, also handling whatever the vectorized loops leave over.
+     */
+
+    size_t ScalarBase64Encode(const unsigned char* input, size_t length, char* output)
+    {
+        char* out = output;
+        size_t i = 0;
+        for (; i + 3 <= length; i += 3)
+        {
+            const uint32_t group = (static_cast<uint32_t>(input[i]) << 16) | (static_cast<uint32_t>(input[i + 1]) << 8) | input[i + 2];
+            *out++ = BASE64_ALPHABET[(group >> 18) & 0x3F];
+            *out++ = BASE64_ALPHABET[(group >> 12) & 0x3F];
+            *out++ = BASE64_ALPHABET[(group >> 6) & 0x3F];
+            *out++ = BASE64_ALPHABET[group & 0x3F];
+        }
+        if (i < length)
+        {
+            const bool twoBytes = i + 2 == length;
+            const uint32_t group = (static_cast<uint32_t>(input[i]) << 16) | (twoBytes ? static_cast<uint32_t>(input[i + 1]) << 8 : 0);
+            *out++ = BASE64_ALPHABET[(group >> 18) & 0x3F];
+            *out++ = BASE64_ALPHABET[(group >> 12) & 0x3F];
+            *out++ = twoBytes ? BASE64_ALPHABET[(group >> 6) & 0x3F] : BASE64_PADDING;
+            *out++ = BASE64_PADDING;
+        }
+        return static_cast<size_t>(out - output);
+    }
+
+    /**
+     * Decodes unpadded input, whose final group may have 2 or 3 characters.
+     */
+    bool ScalarBase64Decode(const char* input, size_t length, unsigned char* output, size_t& decodedLength)
+    {
+        const unsigned char* in = reinterpret_cast<const unsigned char*>(input);
+        unsigned char* out = output;
+        size_t i = 0;
+        for (; i + 4 <= length; i += 4)
+        {
+            const uint32_t a = BASE64_VALUES[in[i]];
+            const uint32_t b = BASE64_VALUES[in[i + 1]];
+            const uint32_t c = BASE64_VALUES[in[i + 2]];
+            const uint32_t d = BASE64_VALUES[in[i + 3]];
+            if ((a | b | c | d) & 0x80)
+            {
+                return false;
+            }
+            const uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+            *out++ = static_cast<unsigned char>(group >> 16);
+            *out++ = static_cast<unsigned char>(group >> 8);
+            *out++ = static_cast<unsigned char>(group);
+        }
+
+        const size_t remaining = length - i;
+        if (remaining == 1)
+        {
+            return false;
+        }
+        if (remaining > 1)
+        {
+            const uint32_t a = BASE64_VALUES[in[i]];
+            const uint32_t b = BASE64_VALUES[in[i + 1]];
+            const uint32_t c = remaining == 3 ? BASE64_VALUES[in[i + 2]] : 0;
+            if ((a | b | c) & 0x80)
+            {
+                return false;
+            }
+            const uint32_t group = (a << 18) | (b << 12) | (c << 6);
+            *out++ = static_cast<unsigned char>(group >> 16);
+            if (remaining == 3)
+            {
+                *out++ = static_cast<unsigned char>(group >> 8);
+            }
+        }
+        decodedLength += static_cast<size_t>(out - output);
+        return true;
+    }
+
+    size_t ScalarHexEncode(const unsigned char* input, size_t length, char* output)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            output[2 * i] = HEX_DIGITS[input[i] >> 4];
+            output[2 * i + 1] = HEX_DIGITS[input[i] & 0x0F];
+        }
+        return length * 2;
+    }
+
+    inline int HexValue(char c)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            return c - '0';
+        }
+        const char lower = static_cast<char>(c | 0x20);
+        if (lower >= 'a' && lower <= 'f')
+        {
+            return lower - 'a' + 10;
+        }
+        return -1;
+    }
+
+    bool ScalarHexDecode(const char* input, size_t length, unsigned char* output)
+    {
+        for (size_t i = 0; i + 1 < length; i += 2)
+        {
+            const int high = HexValue(input[i]);
+            const int low = HexValue(input[i + 1]);
+            if (high < 0 || low < 0)
+            {
+                return false;
+            }
+            output[i / 2] = static_cast<unsigned char>((high << 4) | low);
+        }
+        return true;
+    }
+
+#if defined(AWS_ENCODING_X86)
+    /*
+     * SSE4.1 and AVX2 codecs. The base64 ones use the pshufb based translations described by Wojciech Mula and Daniel Lemire,
+     * the AVX2 variants process two independent 128-bit lanes with the same shuffles.
+     * Each returns the number of input bytes or chars consumed, leaving the remainder to the scalar code.
+     */
+
+    AWS_TARGET_SSE41 inline __m128i Base64EncodeReshuffle(__m128i in)
+    {
+        // spread 12 input bytes to 16 bytes, each 32-bit lane holding one group of 3 bytes as [b1, b0, b2, b1]
+        in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        // then move the four 6 bit fields of every group into their own bytes
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(t1, t3);
+    }
+
+    AWS_TARGET_SSE41 inline __m128i Base64EncodeTranslate(__m128i in)
+    {
+        // map the 6 bit values to an index in the offset table: 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+        __m128i index = _mm_subs_epu8(in, _mm_set1_epi8(51));
+        const __m128i upperCase = _mm_cmpgt_epi8(_mm_set1_epi8(26), in);
+        index = _mm_or_si128(index, _mm_and_si128(upperCase, _mm_set1_epi8(13)));
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+        return _mm_add_epi8(_mm_shuffle_epi8(offsets, index), in);
+    }
+
+    AWS_TARGET_SSE41 size_t Sse41Base64Encode(const unsigned char* input, size_t length, char* output)
+    {
+        size_t i = 0;
+        // 16 bytes are loaded for every 12 consumed
+        for (; i + 16 <= length; i += 12, output += 16)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), Base64EncodeTranslate(Base64EncodeReshuffle(in)));
+        }
+        return i;
+    }
+
+    /**
+     * Translates 16 base64 characters to their 6 bit values, returns false if any is not in the alphabet.
+     */
+    AWS_TARGET_SSE41 inline bool Base64DecodeTranslate(__m128i& in)
+    {
+        // nibble lookups whose results have a common bit set for characters outside of the alphabet
+        const __m128i lowNibbleFlags = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i highNibbleFlags = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        // offset to add to each character, by high nibble, with index 1 for '/'
+        const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i slash = _mm_set1_epi8('/');
+        const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+
+        const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+        const __m128i lowNibbles = _mm_and_si128(in, nibbleMask);
+        const __m128i high = _mm_shuffle_epi8(highNibbleFlags, highNibbles);
+        const __m128i low = _mm_shuffle_epi8(lowNibbleFlags, lowNibbles);
+        if (!_mm_testz_si128(low, high))
+        {
+            return false;
+        }
+        const __m128i isSlash = _mm_cmpeq_epi8(in, slash);
+        in = _mm_add_epi8(in, _mm_shuffle_epi8(offsets, _mm_add_epi8(isSlash, highNibbles)));
+        return true;
+    }
+
+    AWS_TARGET_SSE41 inline __m128i Base64DecodeReshuffle(__m128i in)
+    {
+        // pack the four 6 bit values of each 32-bit lane into 24 bits, then gather the 3 bytes of every lane in order
+        const __m128i pairs = _mm_maddubs_epi16(in, _mm_set1_epi32(0x01400140));
+        const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        return _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+    AWS_TARGET_SSE41 size_t Sse41Base64Decode(const char* input, size_t length, unsigned char* output)
+    {
+        size_t i = 0;
+        // 16 bytes are stored for every 12 decoded, keep enough input left for the following output to cover the difference
+        for (; i + 24 <= length; i += 16, output += 12)
+        {
+            __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            if (!Base64DecodeTranslate(in))
+            {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), Base64DecodeReshuffle(in));
+        }
+        return i;
+    }
+
+    AWS_TARGET_SSE41 size_t Sse41HexEncode(const unsigned char* input, size_t length, char* output)
+    {
+        const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS));
+        const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16, output += 32)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), nibbleMask));
+            const __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(in, nibbleMask));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16), _mm_unpackhi_epi8(high, low));
+        }
+        return i;
+    }
+
+    AWS_TARGET_SSE41 size_t Sse41HexDecode(const char* input, size_t length, unsigned char* output)
+    {
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16, output += 8)
+        {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+            const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+            const __m128i letter = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+            if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xFFFF)
+            {
+                break;
+            }
+            const __m128i values = _mm_or_si128(_mm_and_si128(isDigit, digit), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+            // high * 16 + low for every pair of digits
+            const __m128i bytes = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(bytes, bytes));
+        }
+        return i;
+    }
+
+    AWS_TARGET_AVX2 inline __m256i Base64EncodeReshuffle(__m256i in)
+    {
+        in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        return _mm256_or_si256(t1, t3);
+    }
+
+    AWS_TARGET_AVX2 inline __m256i Base64EncodeTranslate(__m256i in)
+    {
+        __m256i index = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+        const __m256i upperCase = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), in);
+        index = _mm256_or_si256(index, _mm256_and_si256(upperCase, _mm256_set1_epi8(13)));
+        const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+        return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, index), in);
+    }
+
+    AWS_TARGET_AVX2 size_t Avx2Base64Encode(const unsigned char* input, size_t length, char* output)
+    {
+        size_t i = 0;
+        // each lane takes 12 bytes from a 16 byte load, the second one starting 12 bytes in
+        for (; i + 28 <= length; i += 24, output += 32)
+        {
+            const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+            const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12));
+            const __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), Base64EncodeTranslate(Base64EncodeReshuffle(in)));
+        }
+        return i;
+    }
+
+    AWS_TARGET_AVX2 inline bool Base64DecodeTranslate(__m256i& in)
+    {
+        const __m256i lowNibbleFlags = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i highNibbleFlags = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m256i offsets = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i slash = _mm256_set1_epi8('/');
+        const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+
+        const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), nibbleMask);
+        const __m256i lowNibbles = _mm256_and_si256(in, nibbleMask);
+        const __m256i high = _mm256_shuffle_epi8(highNibbleFlags, highNibbles);
+        const __m256i low = _mm256_shuffle_epi8(lowNibbleFlags, lowNibbles);
+        if (!_mm256_testz_si256(low, high))
+        {
+            return false;
+        }
+        const __m256i isSlash = _mm256_cmpeq_epi8(in, slash);
+        in = _mm256_add_epi8(in, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(isSlash, highNibbles)));
+        return true;
+    }
+
+    AWS_TARGET_AVX2 inline __m256i Base64DecodeReshuffle(__m256i in)
+    {
+        const __m256i pairs = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+        const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i lanes = _mm256_shuffle_epi8(groups, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        // join the 12 bytes of both lanes
+        return _mm256_permutevar8x32_epi32(lanes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    }
+
+    AWS_TARGET_AVX2 size_t Avx2Base64Decode(const char* input, size_t length, unsigned char* output)
+    {
+        size_t i = 0;
+        // 32 bytes are stored for every 24 decoded, keep enough input left for the following output to cover the difference
+        for (; i + 48 <= length; i += 32, output += 24)
+        {
+            __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+            if (!Base64DecodeTranslate(in))
+            {
+                break;
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), Base64DecodeReshuffle(in));
+        }
+        return i;
+    }
+
+    AWS_TARGET_AVX2 size_t Avx2HexEncode(const unsigned char* input, size_t length, char* output)
+    {
+        const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS)));
+        const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32, output += 64)
+        {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+            const __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibbleMask));
+            const __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, nibbleMask));
+            // the unpacks interleave within lanes: bytes 0-7 and 16-23, then 8-15 and 24-31
+            const __m256i first = _mm256_unpacklo_epi8(high, low);
+            const __m256i second = _mm256_unpackhi_epi8(high, low);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute2x128_si256(first, second, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 32), _mm256_permute2x128_si256(first, second, 0x31));
+        }
+        return i;
+    }
+
+    AWS_TARGET_AVX2 size_t Avx2HexDecode(const char* input, size_t length, unsigned char* output)
+    {
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32, output += 16)
+        {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+            const __m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+            const __m256i isDigit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+            const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+            const __m256i isLetter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+            if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) != -1)
+            {
+                break;
+            }
+            const __m256i values = _mm256_or_si256(_mm256_and_si256(isDigit, digit),
+                _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+            const __m256i bytes = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+            // each lane packs its 8 bytes into its low half, join both halves
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(packed));
+        }
+        return i;
+    }
+#endif // AWS_ENCODING_X86
+
+#if defined(AWS_ENCODING_NEON)
+    size_t NeonBase64Encode(const unsigned char* input, size_t length, char* output)
+    {
+        uint8x16x4_t alphabet;
+        alphabet.val[0] = vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET));
+        alphabet.val[1] = vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 16);
+        alphabet.val[2] = vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 32);
+        alphabet.val[3] = vld1q_u8(reinterpret_cast<const uint8_t*>(BASE64_ALPHABET) + 48);
+        const uint8x16_t mask = vdupq_n_u8(0x3F);
+        size_t i = 0;
+        for (; i + 48 <= length; i += 48, output += 64)
+        {
+            // de-interleaving load: val[n] holds byte n of 16 consecutive groups
+            const uint8x16x3_t in = vld3q_u8(input + i);
+            uint8x16x4_t out;
+            out.val[0] = vshrq_n_u8(in.val[0], 2);
+            out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+            out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+            out.val[3] = vandq_u8(in.val[2], mask);
+            out.val[0] = vqtbl4q_u8(alphabet, out.val[0]);
+            out.val[1] = vqtbl4q_u8(alphabet, out.val[1]);
+            out.val[2] = vqtbl4q_u8(alphabet, out.val[2]);
+            out.val[3] = vqtbl4q_u8(alphabet, out.val[3]);
+            vst4q_u8(reinterpret_cast<uint8_t*>(output), out);
+        }
+        return i;
+    }
+
+    size_t NeonHexEncode(const unsigned char* input, size_t length, char* output)
+    {
+        const uint8x16_t digits = vld1q_u8(reinterpret_cast<const uint8_t*>(HEX_DIGITS));
+        const uint8x16_t nibbleMask = vdupq_n_u8(0x0F);
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16, output += 32)
+        {
+            const uint8x16_t in = vld1q_u8(input + i);
+            uint8x16x2_t out;
+            out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+            out.val[1] = vqtbl1q_u8(digits, vandq_u8(in, nibbleMask));
+            vst2q_u8(reinterpret_cast<uint8_t*>(output), out);
+        }
+        return i;
+    }
+#endif // AWS_ENCODING_NEON
+}
+
+SimdLevel EncodingUtils::GetSimdLevel()
+{
+    return CurrentSimdLevel();
+}
+
+bool EncodingUtils::SetSimdLevel(SimdLevel level)
+{
+    const SimdLevel supportedLevel = SupportedSimdLevel();
+    if (level != SimdLevel::Scalar && level != supportedLevel && !(level == SimdLevel::Sse41 && supportedLevel == SimdLevel::Avx2))
+    {
+        return false;
+    }
+    ActiveSimdLevel().store(static_cast<int>(level), std::memory_order_relaxed);
+    return true;
+}
+
+size_t EncodingUtils::Base64Encode(const unsigned char* input, size_t length, char* output)
+{
+    size_t consumed = 0;
+    switch (CurrentSimdLevel())
+    {
+#if defined(AWS_ENCODING_X86)
+    case SimdLevel::Avx2:
+        consumed = Avx2Base64Encode(input, length, output);
+        break;
+    case SimdLevel::Sse41:
+        consumed = Sse41Base64Encode(input, length, output);
+        break;
+#elif defined(AWS_ENCODING_NEON)
+    case SimdLevel::Neon:
+        consumed = NeonBase64Encode(input, length, output);
+        break;
+#endif
+    default:
+        break;
+    }
+    const size_t written = consumed / 3 * 4;
+    return written + ScalarBase64Encode(input + consumed, length - consumed, output + written);
+}
+
+bool EncodingUtils::Base64Decode(const char* input, size_t length, unsigned char* output, size_t& decodedLength)
+{
+    decodedLength = 0;
+    // padding may only complete the final group
+    if (length % 4 == 0 && length > 0 && input[length - 1] == BASE64_PADDING)
+    {
+        length -= input[length - 2] == BASE64_PADDING ? 2 : 1;
+    }
+
+    size_t consumed = 0;
+    switch (CurrentSimdLevel())
+    {
+#if defined(AWS_ENCODING_X86)
+    case SimdLevel::Avx2:
+        consumed = Avx2Base64Decode(input, length, output);
+        break;
+    case SimdLevel::Sse41:
+        consumed = Sse41Base64Decode(input, length, output);
+        break;
+#endif
+    default:
+        break;
+    }
+    decodedLength = consumed / 4 * 3;
+    return ScalarBase64Decode(input + consumed, length - consumed, output + decodedLength, decodedLength);
+}
+
+size_t EncodingUtils::HexEncode(const unsigned char* input, size_t length, char* output)
+{
+    size_t consumed = 0;
+    switch (CurrentSimdLevel())
+    {
+#if defined(AWS_ENCODING_X86)
+    case SimdLevel::Avx2:
+        consumed = Avx2HexEncode(input, length, output);
+        break;
+    case SimdLevel::Sse41:
+        consumed = Sse41HexEncode(input, length, output);
+        break;
+#elif defined(AWS_ENCODING_NEON)
+    case SimdLevel::Neon:
+        consumed = NeonHexEncode(input, length, output);
+        break;
+#endif
+    default:
+        break;
+    }
+    return consumed * 2 + ScalarHexEncode(input + consumed, length - consumed, output + consumed * 2);
+}
+
+bool EncodingUtils::HexDecode(const char* input, size_t length, unsigned char* output)
+{
+    if (length % 2 != 0)
+    {
+        return false;
+    }
+
+    size_t consumed = 0;
+    switch (CurrentSimdLevel())
+    {
+#if defined(AWS_ENCODING_X86)
+    case SimdLevel::Avx2:
+        consumed = Avx2HexDecode(input, length, output);
+        break;
+    case SimdLevel::Sse41:
+        consumed = Sse41HexDecode(input, length, output);
+        break;
+#endif
+    default:
+        break;
+    }
+    return ScalarHexDecode(input + consumed, length - consumed, output + consumed / 2);
+}
+
+bool EncodingUtils::Base64Encode(Aws::IStream& input, Aws::OStream& output)
+{
+    Aws::String chunk(STREAM_CHUNK_SIZE, '\0');
+    Aws::String encoded;
+    Base64Encoder encoder;
+    while (input && output)
+    {
+        input.read(&chunk[0], static_cast<std::streamsize>(chunk.size()));
+        const size_t read = static_cast<size_t>(input.gcount());
+        if (read == 0)
+        {
+            break;
+        }
+        encoded.clear();
+        encoder.Update(reinterpret_cast<const unsigned char*>(chunk.data()), read, encoded);
+        output.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+    }
+    encoded.clear();
+    encoder.Finish(encoded);
+    output.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+    return !input.bad() && output.good();
+}
+
+bool EncodingUtils::Base64Decode(Aws::IStream& input, Aws::OStream& output)
+{
+    Aws::String chunk(STREAM_CHUNK_SIZE, '\0');
+    Aws::String decoded;
+    Base64Decoder decoder;
+    while (input && output)
+    {
+        input.read(&chunk[0], static_cast<std::streamsize>(chunk.size()));
+        const size_t read = static_cast<size_t>(input.gcount());
+        if (read == 0)
+        {
+            break;
+        }
+        decoded.clear();
+        if (!decoder.Update(chunk.data(), read, decoded))
+        {
+            return false;
+        }
+        output.write(decoded.data(), static_cast<std::streamsize>(decoded.size()));
+    }
+    decoded.clear();
+    if (!decoder.Finish(decoded))
+    {
+        return false;
+    }
+    output.write(decoded.data(), static_cast<std::streamsize>(decoded.size()));
+    return !input.bad() && output.good();
+}
+
+bool EncodingUtils::HexEncode(Aws::IStream& input, Aws::OStream& output)
+{
+    Aws::String chunk(STREAM_CHUNK_SIZE, '\0');
+    Aws::String encoded(HexEncodedLength(STREAM_CHUNK_SIZE), '\0');
+    while (input && output)
+    {
+        input.read(&chunk[0], static_cast<std::streamsize>(chunk.size()));
+        const size_t read = static_cast<size_t>(input.gcount());
+        if (read == 0)
+        {
+            break;
+        }
+        const size_t written = HexEncode(reinterpret_cast<const unsigned char*>(chunk.data()), read, &encoded[0]);
+        output.write(encoded.data(), static_cast<std::streamsize>(written));
+    }
+    return !input.bad() && output.good();
+}
+
+void Base64Encoder::Update(const unsigned char* data, size_t length, Aws::String& output)
+{
+    if (m_pendingLength > 0)
+    {
+        const size_t missing = 3 - m_pendingLength;
+        if (length < missing)
+        {
+            std::copy(data, data + length, m_pending + m_pendingLength);
+            m_pendingLength += length;
+            return;
+        }
+        unsigned char group[3];
+        std::copy(m_pending, m_pending + m_pendingLength, group);
+        std::copy(data, data + missing, group + m_pendingLength);
+        const size_t offset = output.size();
+        output.resize(offset + 4);
+        EncodingUtils::Base64Encode(group, 3, &output[offset]);
+        data += missing;
+        length -= missing;
+        m_pendingLength = 0;
+    }
+
+    const size_t wholeGroups = length - length % 3;
+    if (wholeGroups > 0)
+    {
+        const size_t offset = output.size();
+        output.resize(offset + EncodingUtils::Base64EncodedLength(wholeGroups));
+        EncodingUtils::Base64Encode(data, wholeGroups, &output[offset]);
+    }
+    m_pendingLength = length - wholeGroups;
+    std::copy(data + wholeGroups, data + length, m_pending);
+}
+
+void Base64Encoder::Finish(Aws::String& output)
+{
+    if (m_pendingLength > 0)
+    {
+        const size_t offset = output.size();
+        output.resize(offset + 4);
+        EncodingUtils::Base64Encode(m_pending, m_pendingLength, &output[offset]);
+        m_pendingLength = 0;
+    }
+}
+
+bool Base64Decoder::Update(const char* data, size_t length, Aws::String& output)
+{
+    if (m_failed || length == 0)
+    {
+        return !m_failed;
+    }
+    if (m_padded)
+    {
+        // nothing may follow the padded final group
+        m_failed = true;
+        return false;
+    }
+
+    if (m_pendingLength > 0)
+    {
+        const size_t missing = 4 - m_pendingLength;
+        if (length < missing)
+        {
+            std::copy(data, data + length, m_pending + m_pendingLength);
+            m_pendingLength += length;
+            return true;
+        }
+        char group[4];
+        std::copy(m_pending, m_pending + m_pendingLength, group);
+        std::copy(data, data + missing, group + m_pendingLength);
+        data += missing;
+        length -= missing;
+        m_pendingLength = 0;
+        if (!DecodeGroups(group, 4, output) || (m_padded && length > 0))
+        {
+            m_failed = true;
+            return false;
+        }
+    }
+
+    const size_t wholeGroups = length - length % 4;
+    if (wholeGroups > 0 && !DecodeGroups(data, wholeGroups, output))
+    {
+        return false;
+    }
+    m_pendingLength = length - wholeGroups;
+    if (m_padded && m_pendingLength > 0)
+    {
+        m_failed = true;
+        return false;
+    }
+    std::copy(data + wholeGroups, data + length, m_pending);
+    return true;
+}
+
+bool Base64Decoder::Finish(Aws::String& output)
+{
+    const bool success = !m_failed && (m_pendingLength == 0 || DecodeGroups(m_pending, m_pendingLength, output));
+    Reset();
+    return success;
+}
+
+void Base64Decoder::Reset()
+{
+    m_pendingLength = 0;
+    m_padded = false;
+    m_failed = false;
+}
+
+bool Base64Decoder::DecodeGroups(const char* data, size_t length, Aws::String& output)
+{
+    const size_t offset = output.size();
+    output.resize(offset + EncodingUtils::Base64DecodedLength(length));
+    size_t decodedLength = 0;
+    if (!EncodingUtils::Base64Decode(data, length, reinterpret_cast<unsigned char*>(&output[offset]), decodedLength))
+    {
+        output.resize(offset);
+        m_failed = true;
+        return false;
+    }
+    output.resize(offset + decodedLength);
+    m_padded = data[length - 1] == BASE64_PADDING;
+    return true;
+}
@@ -0,0 +1,355 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/cbor/CborReader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <istream>
+#include <limits>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
+
+// same limit as JsonReader
+static const size_t MAX_NESTING_DEPTH = 1000;
+// strings are read in chunks, so that a corrupted length does not allocate more than the input actually holds
+static const uint64_t STRING_CHUNK_SIZE = 64 * 1024;
+static const int BREAK = 0xFF;
+
+CborReader::CborReader(Aws::IStream& input) : m_input(input.rdbuf())
+{
+    if (!m_input)
+    {
+        Fail("Input stream has no buffer");
+    }
+}
+
+CborToken CborReader::Next()
+{
+    if (m_token == CborToken::Error || m_token == CborToken::End)
+    {
+        return m_token;
+    }
+
+    m_tag = NO_TAG;
+    if (m_containers.empty() && m_token != CborToken::None)
+    {
+        // the top level data item is complete
+        return m_input->sgetc() == std::char_traits<char>::eof() ? (m_token = CborToken::End) : Fail("Unexpected data after the CBOR data item");
+    }
+
+    if (!m_containers.empty())
+    {
+        const Container& container = m_containers.back();
+        if (!container.indefinite && container.itemsRead == container.itemCount)
+        {
+            const bool isMap = container.isMap;
+            m_containers.pop_back();
+            return m_token = (isMap ? CborToken::EndMap : CborToken::EndArray);
+        }
+    }
+
+    const int initialByte = m_input->sbumpc();
+    if (initialByte == std::char_traits<char>::eof())
+    {
+        return Fail("Unexpected end of input");
+    }
+
+    bool isKey = false;
+    if (!m_containers.empty())
+    {
+        Container& container = m_containers.back();
+        if (initialByte == BREAK)
+        {
+            if (!container.indefinite || (container.isMap && container.itemsRead % 2 != 0))
+            {
+                return Fail("Unexpected break");
+            }
+            const bool isMap = container.isMap;
+            m_containers.pop_back();
+            return m_token = (isMap ? CborToken::EndMap : CborToken::EndArray);
+        }
+        isKey = container.isMap && container.itemsRead % 2 == 0;
+        ++container.itemsRead;
+    }
+    return ReadItem(initialByte, isKey);
+}
+
+bool CborReader::SkipValue()
+{
+    if (m_token == CborToken::StartMap || m_token == CborToken::StartArray)
+    {
+        const size_t depth = m_containers.size();
+        while (m_containers.size() >= depth)
+        {
+            if (Next() == CborToken::Error)
+            {
+                return false;
+            }
+        }
+    }
+    return m_token != CborToken::Error;
+}
+
+ByteBuffer CborReader::GetBytes() const
+{
+    if ((m_token != CborToken::Bytes && m_token != CborToken::String) || m_text.empty())
+    {
+        return ByteBuffer();
+    }
+    return ByteBuffer(reinterpret_cast<const unsigned char*>(m_text.data()), m_text.size());
+}
+
+int CborReader::GetInteger() const
+{
+    return static_cast<int>(GetInt64());
+}
+
+long long CborReader::GetInt64() const
+{
+    if (m_token == CborToken::Integer)
+    {
+        return m_negative ? -1 - static_cast<long long>(m_integerValue) : static_cast<long long>(m_integerValue);
+    }
+    return m_token == CborToken::Float ? static_cast<long long>(m_floatValue) : 0;
+}
+
+double CborReader::GetDouble() const
+{
+    if (m_token == CborToken::Integer)
+    {
+        return m_negative ? -1.0 - static_cast<double>(m_integerValue) : static_cast<double>(m_integerValue);
+    }
+    return m_token == CborToken::Float ? m_floatValue : 0.0;
+}
+
+CborToken CborReader::ReadItem(int initialByte, bool isKey)
+{
+    int majorType = initialByte >> 5;
+    int additionalInformation = initialByte & 0x1F;
+    while (majorType == 6)
+    {
+        if (!ReadArgument(additionalInformation, m_tag))
+        {
+            return CborToken::Error;
+        }
+        initialByte = m_input->sbumpc();
+        if (initialByte == std::char_traits<char>::eof())
+        {
+            return Fail("Unexpected end of input");
+        }
+        majorType = initialByte >> 5;
+        additionalInformation = initialByte & 0x1F;
+    }
+
+    if (isKey && majorType != 3)
+    {
+        return Fail("Map keys must be text strings");
+    }
+
+    switch (majorType)
+    {
+    case 0:
+    case 1:
+        if (!ReadArgument(additionalInformation, m_integerValue))
+        {
+            return CborToken::Error;
+        }
+        m_negative = majorType == 1;
+        return m_token = CborToken::Integer;
+    case 2:
+    case 3:
+        if (!ReadString(majorType, additionalInformation))
+        {
+            return CborToken::Error;
+        }
+        return m_token = (majorType == 2 ? CborToken::Bytes : (isKey ? CborToken::Key : CborToken::String));
+    case 4:
+    case 5:
+    {
+        if (m_containers.size() >= MAX_NESTING_DEPTH)
+        {
+            return Fail("Maximum nesting depth exceeded");
+        }
+        Container container = { majorType == 5, additionalInformation == 31, 0, 0 };
+        if (!container.indefinite)
+        {
+            if (!ReadArgument(additionalInformation, container.itemCount))
+            {
+                return CborToken::Error;
+            }
+            if (container.isMap)
+            {
+                if (container.itemCount > (std::numeric_limits<uint64_t>::max)() / 2)
+                {
+                    return Fail("Invalid map length");
+                }
+                container.itemCount *= 2;
+            }
+        }
+        m_containers.push_back(container);
+        return m_token = (container.isMap ? CborToken::StartMap : CborToken::StartArray);
+    }
+    default:
+        return ReadSimpleValue(additionalInformation);
+    }
+}
+
+bool CborReader::ReadArgument(int additionalInformation, uint64_t& argument)
+{
+    if (additionalInformation < 24)
+    {
+        argument = static_cast<uint64_t>(additionalInformation);
+        return true;
+    }
+    if (additionalInformation > 27)
+    {
+        Fail(additionalInformation == 31 ? "Unexpected indefinite length" : "Invalid additional information");
+        return false;
+    }
+
+    argument = 0;
+    for (size_t byteCount = size_t(1) << (additionalInformation - 24); byteCount > 0; --byteCount)
+    {
+        const int c = m_input->sbumpc();
+        if (c == std::char_traits<char>::eof())
+        {
+            Fail("Unexpected end of input");
+            return false;
+        }
+        argument = (argument << 8) | static_cast<uint8_t>(c);
+    }
+    return true;
+}
+
+bool CborReader::ReadString(int majorType, int additionalInformation)
+{
+    m_text.clear();
+    uint64_t length = 0;
+    if (additionalInformation != 31)
+    {
+        return ReadArgument(additionalInformation, length) && ReadBytes(length);
+    }
+
+    // indefinite length strings are a sequence of definite length chunks of the same type
+    for (;;)
+    {
+        const int c = m_input->sbumpc();
+        if (c == BREAK)
+        {
+            return true;
+        }
+        if (c == std::char_traits<char>::eof())
+        {
+            Fail("Unexpected end of input");
+            return false;
+        }
+        if ((c >> 5) != majorType || (c & 0x1F) == 31)
+        {
+            Fail("Invalid chunk in indefinite length string");
+            return false;
+        }
+        if (!ReadArgument(c & 0x1F, length) || !ReadBytes(length))
+        {
+            return false;
+        }
+    }
+}
+
+bool CborReader::ReadBytes(uint64_t length)
+{
+    while (length > 0)
+    {
+        const size_t chunk = static_cast<size_t>((std::min)(length, STRING_CHUNK_SIZE));
+        const size_t offset = m_text.size();
+        m_text.resize(offset + chunk);
+        const std::streamsize read = m_input->sgetn(&m_text[offset], static_cast<std::streamsize>(chunk));
+        if (read != static_cast<std::streamsize>(chunk))
+        {
+            m_text.resize(offset + static_cast<size_t>((std::max)(read, std::streamsize(0))));
+            Fail("Unexpected end of input");
+            return false;
+        }
+        length -= chunk;
+    }
+    return true;
+}
+
+CborToken CborReader::ReadSimpleValue(int additionalInformation)
+{
+    switch (additionalInformation)
+    {
+    case 20:
+    case 21:
+        m_boolValue = additionalInformation == 21;
+        return m_token = CborToken::Bool;
+    case 22:
+    case 23:
+        return m_token = CborToken::Null;
+    case 25:
+    {
+        uint64_t bits = 0;
+        if (!ReadArgument(additionalInformation, bits))
+        {
+            return CborToken::Error;
+        }
+        const int exponent = static_cast<int>((bits >> 10) & 0x1F);
+        const double mantissa = static_cast<double>(bits & 0x3FF);
+        double value = 0.0;
+        if (exponent == 0)
+        {
+            value = std::ldexp(mantissa, -24);
+        }
+        else if (exponent != 31)
+        {
+            value = std::ldexp(mantissa + 1024.0, exponent - 25);
+        }
+        else
+        {
+            value = mantissa == 0.0 ? std::numeric_limits<double>::infinity() : std::numeric_limits<double>::quiet_NaN();
+        }
+        m_floatValue = (bits & 0x8000) ? -value : value;
+        return m_token = CborToken::Float;
+    }
+    case 26:
+    {
+        uint64_t bits = 0;
+        if (!ReadArgument(additionalInformation, bits))
+        {
+            return CborToken::Error;
+        }
+        const uint32_t singleBits = static_cast<uint32_t>(bits);
+        float value = 0.0f;
+        std::memcpy(&value, &singleBits, sizeof(value));
+        m_floatValue = value;
+        return m_token = CborToken::Float;
+    }
+    case 27:
+    {
+        uint64_t bits = 0;
+        if (!ReadArgument(additionalInformation, bits))
+        {
+            return CborToken::Error;
+        }
+        std::memcpy(&m_floatValue, &bits, sizeof(m_floatValue));
+        return m_token = CborToken::Float;
+    }
+    case 31:
+        return Fail("Unexpected break");
+    default:
+        return Fail("Unsupported simple value");
+    }
+}
+
+CborToken CborReader::Fail(const char* message)
+{
+    if (m_token != CborToken::Error)
+    {
+        m_errorMessage = message;
+    }
+    return m_token = CborToken::Error;
+}
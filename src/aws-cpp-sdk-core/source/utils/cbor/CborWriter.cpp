@@ -0,0 +1,176 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/cbor/CborWriter.h>
+#include <aws/core/utils/DateTime.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Cbor;
+
+namespace
+{
+    const uint8_t MAJOR_UNSIGNED_INTEGER = 0;
+    const uint8_t MAJOR_NEGATIVE_INTEGER = 1;
+    const uint8_t MAJOR_BYTE_STRING = 2;
+    const uint8_t MAJOR_TEXT_STRING = 3;
+    const uint8_t MAJOR_ARRAY = 4;
+    const uint8_t MAJOR_MAP = 5;
+    const uint8_t MAJOR_TAG = 6;
+
+    const char INDEFINITE_ARRAY = static_cast<char>(0x9F);
+    const char INDEFINITE_MAP = static_cast<char>(0xBF);
+    const char BREAK = static_cast<char>(0xFF);
+    const char FALSE_VALUE = static_cast<char>(0xF4);
+    const char TRUE_VALUE = static_cast<char>(0xF5);
+    const char NULL_VALUE = static_cast<char>(0xF6);
+    const char SINGLE_PRECISION_FLOAT = static_cast<char>(0xFA);
+    const char DOUBLE_PRECISION_FLOAT = static_cast<char>(0xFB);
+
+    const uint64_t EPOCH_DATE_TIME_TAG = 1;
+
+    void WriteBigEndian(Aws::String& output, uint64_t value, size_t byteCount)
+    {
+        for (size_t i = byteCount; i > 0; --i)
+        {
+            output.push_back(static_cast<char>((value >> ((i - 1) * 8)) & 0xFF));
+        }
+    }
+}
+
+void CborWriter::WriteHead(uint8_t majorType, uint64_t argument)
+{
+    const uint8_t type = static_cast<uint8_t>(majorType << 5);
+    if (argument < 24)
+    {
+        m_output.push_back(static_cast<char>(type | argument));
+    }
+    else if (argument <= 0xFF)
+    {
+        m_output.push_back(static_cast<char>(type | 24));
+        WriteBigEndian(m_output, argument, 1);
+    }
+    else if (argument <= 0xFFFF)
+    {
+        m_output.push_back(static_cast<char>(type | 25));
+        WriteBigEndian(m_output, argument, 2);
+    }
+    else if (argument <= 0xFFFFFFFF)
+    {
+        m_output.push_back(static_cast<char>(type | 26));
+        WriteBigEndian(m_output, argument, 4);
+    }
+    else
+    {
+        m_output.push_back(static_cast<char>(type | 27));
+        WriteBigEndian(m_output, argument, 8);
+    }
+}
+
+CborWriter& CborWriter::StartMap()
+{
+    m_output.push_back(INDEFINITE_MAP);
+    return *this;
+}
+
+CborWriter& CborWriter::StartMap(size_t pairCount)
+{
+    WriteHead(MAJOR_MAP, pairCount);
+    return *this;
+}
+
+CborWriter& CborWriter::EndMap()
+{
+    m_output.push_back(BREAK);
+    return *this;
+}
+
+CborWriter& CborWriter::StartArray()
+{
+    m_output.push_back(INDEFINITE_ARRAY);
+    return *this;
+}
+
+CborWriter& CborWriter::StartArray(size_t elementCount)
+{
+    WriteHead(MAJOR_ARRAY, elementCount);
+    return *this;
+}
+
+CborWriter& CborWriter::EndArray()
+{
+    m_output.push_back(BREAK);
+    return *this;
+}
+
+CborWriter& CborWriter::AsString(const char* value, size_t length)
+{
+    WriteHead(MAJOR_TEXT_STRING, length);
+    m_output.append(value, length);
+    return *this;
+}
+
+CborWriter& CborWriter::AsBytes(const unsigned char* value, size_t length)
+{
+    WriteHead(MAJOR_BYTE_STRING, length);
+    m_output.append(reinterpret_cast<const char*>(value), length);
+    return *this;
+}
+
+CborWriter& CborWriter::AsBool(bool value)
+{
+    m_output.push_back(value ? TRUE_VALUE : FALSE_VALUE);
+    return *this;
+}
+
+CborWriter& CborWriter::AsInt64(long long value)
+{
+    if (value >= 0)
+    {
+        WriteHead(MAJOR_UNSIGNED_INTEGER, static_cast<uint64_t>(value));
+    }
+    else
+    {
+        // -1 - n, computed without overflowing for the minimum value
+        WriteHead(MAJOR_NEGATIVE_INTEGER, static_cast<uint64_t>(-(value + 1)));
+    }
+    return *this;
+}
+
+CborWriter& CborWriter::AsDouble(double value)
+{
+    const float singlePrecision = static_cast<float>(value);
+    if (static_cast<double>(singlePrecision) == value || value != value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &singlePrecision, sizeof(bits));
+        m_output.push_back(SINGLE_PRECISION_FLOAT);
+        WriteBigEndian(m_output, bits, 4);
+    }
+    else
+    {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        m_output.push_back(DOUBLE_PRECISION_FLOAT);
+        WriteBigEndian(m_output, bits, 8);
+    }
+    return *this;
+}
+
+CborWriter& CborWriter::AsNull()
+{
+    m_output.push_back(NULL_VALUE);
+    return *this;
+}
+
+CborWriter& CborWriter::AsTimestamp(const DateTime& value)
+{
+    WriteHead(MAJOR_TAG, EPOCH_DATE_TIME_TAG);
+    const int64_t millis = value.Millis();
+    if (millis % 1000 == 0)
+    {
+        return AsInt64(millis / 1000);
+    }
+    return AsDouble(value.SecondsWithMSPrecision());
+}
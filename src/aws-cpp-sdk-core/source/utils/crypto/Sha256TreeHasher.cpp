@@ -0,0 +1,243 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/crypto/Sha256TreeHasher.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+namespace
+{
+    const char SHA256_TREE_HASHER_TAG[] = "Sha256TreeHasher";
+
+    ByteBuffer HashBytes(const unsigned char* data, size_t length)
+    {
+        Sha256 hash;
+        hash.Update(const_cast<unsigned char*>(data), length);
+        return hash.GetHash().GetResult();
+    }
+
+    ByteBuffer HashPair(const ByteBuffer& left, const ByteBuffer& right)
+    {
+        Sha256 hash;
+        hash.Update(left.GetUnderlyingData(), left.GetLength());
+        hash.Update(right.GetUnderlyingData(), right.GetLength());
+        return hash.GetHash().GetResult();
+    }
+}
+
+const size_t Sha256TreeHasher::LEAF_SIZE;
+const size_t Sha256TreeHasher::DEFAULT_MAX_LEAVES_IN_FLIGHT;
+
+Sha256TreeHasher::Sha256TreeHasher(Threading::Executor* executor, size_t maxLeavesInFlight) :
+    m_executor(executor),
+    m_maxLeavesInFlight((std::max)(maxLeavesInFlight, static_cast<size_t>(1))),
+    m_leafLength(0),
+    m_leafCount(0),
+    m_leavesInFlight(0),
+    m_nextLeafToReduce(0)
+{
+    Reset();
+}
+
+Sha256TreeHasher::~Sha256TreeHasher()
+{
+    WaitForLeaves();
+}
+
+void Sha256TreeHasher::Update(const unsigned char* data, size_t length)
+{
+    if (length == 0)
+    {
+        return;
+    }
+    m_payloadHash->Update(const_cast<unsigned char*>(data), length);
+
+    while (length > 0)
+    {
+        if (!m_leaf)
+        {
+            m_leaf = AcquireLeafBuffer();
+        }
+        const size_t copied = (std::min)(length, LEAF_SIZE - m_leafLength);
+        std::memcpy(m_leaf->GetUnderlyingData() + m_leafLength, data, copied);
+        m_leafLength += copied;
+        data += copied;
+        length -= copied;
+
+        if (m_leafLength == LEAF_SIZE)
+        {
+            SubmitLeaf();
+        }
+    }
+}
+
+bool Sha256TreeHasher::Update(Aws::IStream& stream)
+{
+    while (stream)
+    {
+        if (!m_leaf)
+        {
+            m_leaf = AcquireLeafBuffer();
+        }
+        unsigned char* buffer = m_leaf->GetUnderlyingData() + m_leafLength;
+        stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(LEAF_SIZE - m_leafLength));
+        const size_t read = static_cast<size_t>(stream.gcount());
+        if (read > 0)
+        {
+            m_payloadHash->Update(buffer, read);
+            m_leafLength += read;
+        }
+
+        if (m_leafLength == LEAF_SIZE)
+        {
+            SubmitLeaf();
+        }
+    }
+    return stream.eof() && !stream.bad();
+}
+
+Sha256TreeHasher::Result Sha256TreeHasher::Finalize()
+{
+    // a trailing partial leaf, or the single empty leaf of an empty payload
+    if (m_leafLength > 0 || m_leafCount == 0)
+    {
+        if (!m_leaf)
+        {
+            m_leaf = AcquireLeafBuffer();
+        }
+        SubmitLeaf();
+    }
+    WaitForLeaves();
+
+    Result result;
+    result.payloadHash = m_payloadHash->GetHash().GetResult();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // the remaining subtrees have strictly decreasing levels, the rightmost ones are combined first
+        // as in the level by level definition, where an unpaired hash is carried up unchanged
+        ByteBuffer treeHash = std::move(m_subtrees.back().hash);
+        for (size_t i = m_subtrees.size() - 1; i > 0; --i)
+        {
+            treeHash = HashPair(m_subtrees[i - 1].hash, treeHash);
+        }
+        result.treeHash = std::move(treeHash);
+    }
+
+    Reset();
+    return result;
+}
+
+Sha256TreeHasher::Result Sha256TreeHasher::Calculate(Aws::IStream& stream, Threading::Executor& executor, size_t maxLeavesInFlight)
+{
+    auto currentPos = stream.tellg();
+    if (currentPos == std::streampos(std::streamoff(-1)))
+    {
+        currentPos = 0;
+        stream.clear();
+    }
+    stream.seekg(0, stream.beg);
+
+    Sha256TreeHasher hasher(&executor, maxLeavesInFlight);
+    const bool succeeded = hasher.Update(stream);
+    Result result = hasher.Finalize();
+
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return succeeded ? result : Result();
+}
+
+std::shared_ptr<ByteBuffer> Sha256TreeHasher::AcquireLeafBuffer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_freeLeaves.empty())
+        {
+            auto leaf = std::move(m_freeLeaves.back());
+            m_freeLeaves.pop_back();
+            return leaf;
+        }
+    }
+    return Aws::MakeShared<ByteBuffer>(SHA256_TREE_HASHER_TAG, LEAF_SIZE);
+}
+
+void Sha256TreeHasher::SubmitLeaf()
+{
+    const size_t index = m_leafCount++;
+    const size_t length = m_leafLength;
+    std::shared_ptr<ByteBuffer> leaf = std::move(m_leaf);
+    m_leaf = nullptr;
+    m_leafLength = 0;
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_leafHashed.wait(lock, [this]() { return m_leavesInFlight < m_maxLeavesInFlight; });
+        ++m_leavesInFlight;
+    }
+
+    if (!m_executor || !m_executor->Submit([this, index, leaf, length]() { HashLeaf(index, leaf, length); }))
+    {
+        HashLeaf(index, leaf, length);
+    }
+}
+
+void Sha256TreeHasher::HashLeaf(size_t index, const std::shared_ptr<ByteBuffer>& leaf, size_t length)
+{
+    ByteBuffer hash = HashBytes(leaf->GetUnderlyingData(), length);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_completedLeaves.emplace(index, std::move(hash));
+    ReduceCompletedLeaves();
+    m_freeLeaves.push_back(leaf);
+    --m_leavesInFlight;
+    // notified under the lock, the hasher may be destroyed as soon as the waiting thread sees no leaf in flight
+    m_leafHashed.notify_all();
+}
+
+void Sha256TreeHasher::ReduceCompletedLeaves()
+{
+    // leaves are reduced in order, each one pushed as a level 0 subtree, merged with its left neighbour while both have the same level
+    auto next = m_completedLeaves.find(m_nextLeafToReduce);
+    while (next != m_completedLeaves.end())
+    {
+        m_subtrees.push_back({0, std::move(next->second)});
+        m_completedLeaves.erase(next);
+        ++m_nextLeafToReduce;
+
+        while (m_subtrees.size() >= 2 && m_subtrees[m_subtrees.size() - 2].level == m_subtrees.back().level)
+        {
+            Subtree right = std::move(m_subtrees.back());
+            m_subtrees.pop_back();
+            Subtree& left = m_subtrees.back();
+            left.hash = HashPair(left.hash, right.hash);
+            ++left.level;
+        }
+
+        next = m_completedLeaves.find(m_nextLeafToReduce);
+    }
+}
+
+void Sha256TreeHasher::WaitForLeaves()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_leafHashed.wait(lock, [this]() { return m_leavesInFlight == 0; });
+}
+
+void Sha256TreeHasher::Reset()
+{
+    m_payloadHash = Aws::MakeShared<Sha256>(SHA256_TREE_HASHER_TAG);
+    m_leafLength = 0;
+    m_leafCount = 0;
+    m_nextLeafToReduce = 0;
+    m_completedLeaves.clear();
+    m_subtrees.clear();
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/event/EventMessage.h>
+
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Event
+        {
+            static bool Matches(const char* name, size_t length, const char* expected)
+            {
+                return std::strlen(expected) == length && std::memcmp(name, expected, length) == 0;
+            }
+
+            Message::KnownHeader Message::GetKnownHeaderForName(const char* name, size_t length)
+            {
+                // every well-known header name starts with ':', so other headers are rejected on their first byte
+                if (length == 0 || name[0] != ':')
+                {
+                    return KnownHeader::UNKNOWN;
+                }
+                if (Matches(name, length, EVENT_TYPE_HEADER))
+                {
+                    return KnownHeader::EVENT_TYPE;
+                }
+                if (Matches(name, length, MESSAGE_TYPE_HEADER))
+                {
+                    return KnownHeader::MESSAGE_TYPE;
+                }
+                if (Matches(name, length, CONTENT_TYPE_HEADER))
+                {
+                    return KnownHeader::CONTENT_TYPE;
+                }
+                if (Matches(name, length, ERROR_CODE_HEADER))
+                {
+                    return KnownHeader::ERROR_CODE;
+                }
+                if (Matches(name, length, ERROR_MESSAGE_HEADER))
+                {
+                    return KnownHeader::ERROR_MESSAGE;
+                }
+                if (Matches(name, length, EXCEPTION_TYPE_HEADER))
+                {
+                    return KnownHeader::EXCEPTION_TYPE;
+                }
+                return KnownHeader::UNKNOWN;
+            }
+
+            Message::MessageType Message::GetMessageTypeForName(const char* name, size_t length)
+            {
+                if (Matches(name, length, "event"))
+                {
+                    return MessageType::EVENT;
+                }
+                if (Matches(name, length, "error"))
+                {
+                    return MessageType::REQUEST_LEVEL_ERROR;
+                }
+                if (Matches(name, length, "exception"))
+                {
+                    return MessageType::REQUEST_LEVEL_EXCEPTION;
+                }
+                return MessageType::UNKNOWN;
+            }
+        }
+    }
+}
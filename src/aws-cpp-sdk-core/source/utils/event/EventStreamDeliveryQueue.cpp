@@ -0,0 +1,190 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/event/EventStreamDeliveryQueue.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <smithy/tracing/TracingUtils.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Event
+        {
+            static const char TAG[] = "EventStreamDeliveryQueue";
+
+            const size_t DEFAULT_EVENT_QUEUE_CAPACITY = 64;
+            const char EVENT_STREAM_QUEUE_DEPTH_METRIC[] = "smithy.client.event_stream.queue_depth";
+            const char EVENT_STREAM_EVENT_LAG_METRIC[] = "smithy.client.event_stream.event_lag";
+
+            EventStreamDeliveryQueue::EventStreamDeliveryQueue(EventStreamHandler& handler,
+                                                               const std::shared_ptr<Aws::Utils::Threading::Executor>& executor,
+                                                               size_t capacity) :
+                m_handler(handler),
+                m_executor(executor ? executor : Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(TAG, 1)),
+                m_capacity(capacity > 0 ? capacity : 1),
+                m_delivering(false)
+            {
+            }
+
+            EventStreamDeliveryQueue::~EventStreamDeliveryQueue()
+            {
+                for (auto& gauge : m_gauges)
+                {
+                    gauge->Stop();
+                }
+                WaitUntilDrained();
+            }
+
+            void EventStreamDeliveryQueue::RegisterMetrics(const smithy::components::tracing::Meter& meter,
+                                                           const Aws::Map<Aws::String, Aws::String>& attributes)
+            {
+                using namespace smithy::components::tracing;
+                m_gauges.emplace_back(meter.CreateGauge(EVENT_STREAM_QUEUE_DEPTH_METRIC,
+                    [this, attributes](Aws::UniquePtr<AsyncMeasurement> measurement)
+                    {
+                        measurement->Record(static_cast<double>(GetDepth()), attributes);
+                    },
+                    TracingUtils::COUNT_METRIC_TYPE,
+                    "Number of event stream events decoded but not delivered to the handler yet"));
+                m_gauges.emplace_back(meter.CreateGauge(EVENT_STREAM_EVENT_LAG_METRIC,
+                    [this, attributes](Aws::UniquePtr<AsyncMeasurement> measurement)
+                    {
+                        measurement->Record(static_cast<double>(GetLag().count()), attributes);
+                    },
+                    TracingUtils::MICROSECOND_METRIC_TYPE,
+                    "Time spent in the queue by the oldest event stream event not delivered yet"));
+            }
+
+            size_t EventStreamDeliveryQueue::GetDepth() const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                return m_queue.size();
+            }
+
+            std::chrono::microseconds EventStreamDeliveryQueue::GetLag() const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_queue.empty())
+                {
+                    return std::chrono::microseconds(0);
+                }
+                return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_queue.front().enqueued);
+            }
+
+            void EventStreamDeliveryQueue::WaitUntilDrained()
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                m_signal.wait(locker, [this]() { return m_queue.empty() && !m_delivering; });
+            }
+
+            void EventStreamDeliveryQueue::Reset()
+            {
+                EventStreamHandler::Reset();
+                m_pending = QueuedEvent();
+            }
+
+            void EventStreamDeliveryQueue::SetMessageMetadata(size_t totalLength, size_t headersLength, size_t payloadLength)
+            {
+                m_pending.totalLength = totalLength;
+                m_pending.headersLength = headersLength;
+                m_pending.payloadLength = payloadLength;
+                m_pending.payload.reserve(payloadLength);
+            }
+
+            bool EventStreamDeliveryQueue::IsMessageCompleted()
+            {
+                return m_pending.headersLength == m_pending.headersBytesReceived && m_pending.payloadLength == m_pending.payload.size();
+            }
+
+            void EventStreamDeliveryQueue::WriteMessageEventPayload(const unsigned char* data, size_t dataLength)
+            {
+                m_pending.payload.insert(m_pending.payload.end(), data, data + dataLength);
+            }
+
+            void EventStreamDeliveryQueue::InsertMessageEventHeader(const Aws::String& eventHeaderName, size_t eventHeaderLength, const EventHeaderValue& eventHeaderValue)
+            {
+                m_pending.headers.push_back(QueuedHeader{eventHeaderName, eventHeaderLength, eventHeaderValue});
+                m_pending.headersBytesReceived += eventHeaderLength;
+            }
+
+            void EventStreamDeliveryQueue::OnEvent()
+            {
+                m_pending.failed = !*this;
+                m_pending.internalError = GetInternalError();
+                m_pending.enqueued = std::chrono::steady_clock::now();
+
+                bool submit = false;
+                {
+                    std::unique_lock<std::mutex> locker(m_lock);
+                    if (m_queue.size() >= m_capacity)
+                    {
+                        AWS_LOGSTREAM_DEBUG(TAG, "Event queue is full, pausing decoding until the handler catches up.");
+                        m_signal.wait(locker, [this]() { return m_queue.size() < m_capacity; });
+                    }
+                    m_queue.push_back(std::move(m_pending));
+                    if (!m_delivering)
+                    {
+                        m_delivering = true;
+                        submit = true;
+                    }
+                }
+                m_pending = QueuedEvent();
+
+                if (submit && !m_executor->Submit([this]() { DeliverQueuedEvents(); }))
+                {
+                    AWS_LOGSTREAM_WARN(TAG, "Failed to submit event delivery to the executor, delivering on the decoding thread.");
+                    DeliverQueuedEvents();
+                }
+            }
+
+            void EventStreamDeliveryQueue::DeliverQueuedEvents()
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                while (!m_queue.empty())
+                {
+                    QueuedEvent event = std::move(m_queue.front());
+                    m_queue.pop_front();
+                    locker.unlock();
+                    m_signal.notify_all();
+
+                    Deliver(event);
+
+                    locker.lock();
+                }
+                m_delivering = false;
+                // notify while holding the lock: once it is released, a waiting destructor may destroy the queue
+                m_signal.notify_all();
+            }
+
+            void EventStreamDeliveryQueue::Deliver(QueuedEvent& event)
+            {
+                m_handler.Reset();
+                // a decoding error may be reported before the prelude of the message is received
+                if (event.totalLength > 0)
+                {
+                    m_handler.SetMessageMetadata(event.totalLength, event.headersLength, event.payloadLength);
+                }
+                for (const auto& header : event.headers)
+                {
+                    m_handler.InsertMessageEventHeader(header.name, header.length, header.value);
+                }
+                if (!event.payload.empty())
+                {
+                    m_handler.WriteMessageEventPayload(event.payload.data(), event.payload.size());
+                }
+                if (event.failed)
+                {
+                    m_handler.SetFailure();
+                    m_handler.SetInternalError(static_cast<int>(event.internalError));
+                }
+                m_handler.OnEvent();
+                m_handler.Reset();
+            }
+        }
+    }
+}
@@ -0,0 +1,321 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/json/JsonReader.h>
+
+#include <cstdlib>
+#include <istream>
+
+using namespace Aws::Utils::Json;
+
+// same limit as cJSON
+static const size_t MAX_NESTING_DEPTH = 1000;
+
+JsonReader::JsonReader(Aws::IStream& input) : m_input(input.rdbuf())
+{
+    if (!m_input)
+    {
+        Fail("Input stream has no buffer");
+    }
+}
+
+JsonToken JsonReader::Next()
+{
+    if (m_token == JsonToken::Error || m_token == JsonToken::End)
+    {
+        return m_token;
+    }
+
+    int c = PeekSignificant();
+    if (m_containers.empty())
+    {
+        if (m_token == JsonToken::None)
+        {
+            return c == std::char_traits<char>::eof() ? (m_token = JsonToken::End) : ReadValue(c);
+        }
+        // the top level value is complete
+        return c == std::char_traits<char>::eof() ? (m_token = JsonToken::End) : Fail("Unexpected data after the JSON document");
+    }
+
+    if (m_token == JsonToken::Key)
+    {
+        if (c != ':')
+        {
+            return Fail("Expected ':' after member name");
+        }
+        Bump();
+        return ReadValue(PeekSignificant());
+    }
+
+    const bool inObject = m_containers.back();
+    if (c == (inObject ? '}' : ']'))
+    {
+        Bump();
+        m_containers.pop_back();
+        return m_token = (inObject ? JsonToken::EndObject : JsonToken::EndArray);
+    }
+
+    if (m_token != JsonToken::StartObject && m_token != JsonToken::StartArray)
+    {
+        if (c != ',')
+        {
+            return Fail(inObject ? "Expected ',' or '}'" : "Expected ',' or ']'");
+        }
+        Bump();
+        c = PeekSignificant();
+    }
+
+    if (!inObject)
+    {
+        return ReadValue(c);
+    }
+    if (c != '"')
+    {
+        return Fail("Expected member name");
+    }
+    Bump();
+    return ReadString() ? (m_token = JsonToken::Key) : JsonToken::Error;
+}
+
+bool JsonReader::SkipValue()
+{
+    if (m_token == JsonToken::StartObject || m_token == JsonToken::StartArray)
+    {
+        const size_t depth = m_containers.size();
+        while (m_containers.size() >= depth)
+        {
+            if (Next() == JsonToken::Error)
+            {
+                return false;
+            }
+        }
+    }
+    return m_token != JsonToken::Error;
+}
+
+int JsonReader::GetInteger() const
+{
+    return static_cast<int>(GetInt64());
+}
+
+long long JsonReader::GetInt64() const
+{
+    if (m_token != JsonToken::Number)
+    {
+        return 0;
+    }
+    char* end = nullptr;
+    const long long value = strtoll(m_text.c_str(), &end, 10);
+    // fractions and exponents are truncated, as JsonView does through double
+    return *end == '\0' ? value : static_cast<long long>(strtod(m_text.c_str(), nullptr));
+}
+
+double JsonReader::GetDouble() const
+{
+    return m_token == JsonToken::Number ? strtod(m_text.c_str(), nullptr) : 0.0;
+}
+
+JsonToken JsonReader::ReadValue(int c)
+{
+    switch (c)
+    {
+        case '{':
+        case '[':
+            if (m_containers.size() >= MAX_NESTING_DEPTH)
+            {
+                return Fail("Maximum nesting depth exceeded");
+            }
+            Bump();
+            m_containers.push_back(c == '{');
+            return m_token = (c == '{' ? JsonToken::StartObject : JsonToken::StartArray);
+        case '"':
+            Bump();
+            return ReadString() ? (m_token = JsonToken::String) : JsonToken::Error;
+        case 't':
+            return ReadLiteral("true", JsonToken::Bool, true);
+        case 'f':
+            return ReadLiteral("false", JsonToken::Bool, false);
+        case 'n':
+            return ReadLiteral("null", JsonToken::Null, false);
+        default:
+            if (c == '-' || (c >= '0' && c <= '9'))
+            {
+                return ReadNumber();
+            }
+            return c == std::char_traits<char>::eof() ? Fail("Unexpected end of input") : Fail("Unexpected character");
+    }
+}
+
+JsonToken JsonReader::ReadLiteral(const char* literal, JsonToken token, bool boolValue)
+{
+    for (; *literal; ++literal)
+    {
+        if (Bump() != *literal)
+        {
+            return Fail("Invalid literal");
+        }
+    }
+    m_boolValue = boolValue;
+    return m_token = token;
+}
+
+bool JsonReader::ReadString()
+{
+    m_text.clear();
+    for (;;)
+    {
+        const int c = Bump();
+        if (c == '"')
+        {
+            return true;
+        }
+        if (c == std::char_traits<char>::eof())
+        {
+            Fail("Unterminated string");
+            return false;
+        }
+        if (c != '\\')
+        {
+            m_text.push_back(static_cast<char>(c));
+            continue;
+        }
+
+        switch (Bump())
+        {
+            case '"':  m_text.push_back('"'); break;
+            case '\\': m_text.push_back('\\'); break;
+            case '/':  m_text.push_back('/'); break;
+            case 'b':  m_text.push_back('\b'); break;
+            case 'f':  m_text.push_back('\f'); break;
+            case 'n':  m_text.push_back('\n'); break;
+            case 'r':  m_text.push_back('\r'); break;
+            case 't':  m_text.push_back('\t'); break;
+            case 'u':
+                if (!ReadUnicodeEscape())
+                {
+                    return false;
+                }
+                break;
+            default:
+                Fail("Invalid escape sequence");
+                return false;
+        }
+    }
+}
+
+bool JsonReader::ReadUnicodeEscape()
+{
+    unsigned codePoint = 0;
+    if (!ReadHex4(codePoint))
+    {
+        return false;
+    }
+
+    if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+    {
+        Fail("Invalid unicode escape sequence");
+        return false;
+    }
+    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+    {
+        // high surrogate, must be followed by the low one
+        unsigned low = 0;
+        if (Bump() != '\\' || Bump() != 'u' || !ReadHex4(low) || low < 0xDC00 || low > 0xDFFF)
+        {
+            Fail("Invalid unicode surrogate pair");
+            return false;
+        }
+        codePoint = 0x10000 + (((codePoint & 0x3FF) << 10) | (low & 0x3FF));
+    }
+
+    // encode as UTF-8
+    if (codePoint < 0x80)
+    {
+        m_text.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        m_text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        m_text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        m_text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        m_text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        m_text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        m_text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        m_text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        m_text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        m_text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    return true;
+}
+
+bool JsonReader::ReadHex4(unsigned& codePoint)
+{
+    codePoint = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const int c = Bump();
+        unsigned digit = 0;
+        if (c >= '0' && c <= '9')
+        {
+            digit = static_cast<unsigned>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            digit = static_cast<unsigned>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            digit = static_cast<unsigned>(c - 'A' + 10);
+        }
+        else
+        {
+            Fail("Invalid unicode escape sequence");
+            return false;
+        }
+        codePoint = (codePoint << 4) | digit;
+    }
+    return true;
+}
+
+JsonToken JsonReader::ReadNumber()
+{
+    m_text.clear();
+    for (int c = Peek(); (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'; c = Peek())
+    {
+        m_text.push_back(static_cast<char>(Bump()));
+    }
+
+    char* end = nullptr;
+    strtod(m_text.c_str(), &end);
+    if (end != m_text.c_str() + m_text.size())
+    {
+        return Fail("Invalid number");
+    }
+    return m_token = JsonToken::Number;
+}
+
+JsonToken JsonReader::Fail(const char* message)
+{
+    m_errorMessage = message;
+    m_text.clear();
+    return m_token = JsonToken::Error;
+}
+
+int JsonReader::PeekSignificant()
+{
+    int c = Peek();
+    while (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+    {
+        Bump();
+        c = Peek();
+    }
+    return c;
+}
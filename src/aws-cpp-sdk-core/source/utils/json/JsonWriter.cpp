@@ -0,0 +1,175 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/json/JsonWriter.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/HashingUtils.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+JsonWriter& JsonWriter::StartObject()
+{
+    BeginValue();
+    m_output.push_back('{');
+    m_needsComma = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::EndObject()
+{
+    m_output.push_back('}');
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::StartArray()
+{
+    BeginValue();
+    m_output.push_back('[');
+    m_needsComma = false;
+    return *this;
+}
+
+JsonWriter& JsonWriter::EndArray()
+{
+    m_output.push_back(']');
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::Key(const char* key, size_t length)
+{
+    if (m_needsComma)
+    {
+        m_output.push_back(',');
+    }
+    WriteEscaped(key, length);
+    m_output.push_back(':');
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsString(const char* value, size_t length)
+{
+    BeginValue();
+    WriteEscaped(value, length);
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsBase64(const ByteBuffer& value)
+{
+    BeginValue();
+    m_output.push_back('"');
+    m_output.append(HashingUtils::Base64Encode(value));
+    m_output.push_back('"');
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsBool(bool value)
+{
+    BeginValue();
+    m_output.append(value ? "true" : "false");
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsInteger(int value)
+{
+    return AsInt64(value);
+}
+
+JsonWriter& JsonWriter::AsInt64(long long value)
+{
+    BeginValue();
+    char buffer[24];
+    const int length = snprintf(buffer, sizeof(buffer), "%lld", value);
+    m_output.append(buffer, static_cast<size_t>(length));
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsDouble(double value)
+{
+    BeginValue();
+    if (std::isnan(value) || std::isinf(value))
+    {
+        // same as cJSON, JSON has no representation for these
+        m_output.append("null");
+    }
+    else
+    {
+        char buffer[32];
+        // shortest of the two precisions that round-trips, as cJSON does
+        int length = snprintf(buffer, sizeof(buffer), "%1.15g", value);
+        if (strtod(buffer, nullptr) != value)
+        {
+            length = snprintf(buffer, sizeof(buffer), "%1.17g", value);
+        }
+        m_output.append(buffer, static_cast<size_t>(length));
+    }
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsNull()
+{
+    BeginValue();
+    m_output.append("null");
+    m_needsComma = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::AsJson(const JsonView& value)
+{
+    BeginValue();
+    m_output.append(value.WriteCompact());
+    m_needsComma = true;
+    return *this;
+}
+
+void JsonWriter::WriteEscaped(const char* value, size_t length)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    m_output.push_back('"');
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        // flush the run of characters which need no escaping
+        m_output.append(value + runStart, i - runStart);
+        runStart = i + 1;
+        m_output.push_back('\\');
+        switch (c)
+        {
+            case '"':  m_output.push_back('"'); break;
+            case '\\': m_output.push_back('\\'); break;
+            case '\b': m_output.push_back('b'); break;
+            case '\f': m_output.push_back('f'); break;
+            case '\n': m_output.push_back('n'); break;
+            case '\r': m_output.push_back('r'); break;
+            case '\t': m_output.push_back('t'); break;
+            default:
+                m_output.append("u00");
+                m_output.push_back(HEX_DIGITS[c >> 4]);
+                m_output.push_back(HEX_DIGITS[c & 0x0F]);
+                break;
+        }
+    }
+    m_output.append(value + runStart, length - runStart);
+    m_output.push_back('"');
+}
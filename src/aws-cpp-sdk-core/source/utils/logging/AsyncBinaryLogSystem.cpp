@@ -0,0 +1,885 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/logging/AsyncBinaryLogSystem.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <fstream>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char TAG[] = "AsyncBinaryLogSystem";
+
+namespace
+{
+    std::atomic<uint64_t> s_nextInstanceId(1);
+
+    enum class RecordKind : uint8_t
+    {
+        DEFERRED_FORMAT,
+        TEXT
+    };
+
+    enum class LengthModifier
+    {
+        NONE,
+        HH,
+        H,
+        L,
+        LL,
+        J,
+        Z,
+        T,
+        LONG_DOUBLE
+    };
+
+    /**
+     * A printf conversion specification, from '%' to the conversion character included.
+     */
+    struct Conversion
+    {
+        const char* begin;
+        const char* end;
+        bool widthStar;
+        bool precisionStar;
+        bool hasPrecision;
+        int precision;
+        LengthModifier length;
+        char type;
+    };
+
+    static const size_t MAX_CONVERSION_LENGTH = 32;
+
+    /**
+     * Parses the conversion starting at begin ('%'). Returns false if it can not be captured and formatted later.
+     */
+    bool ParseConversion(const char* begin, Conversion& conversion)
+    {
+        conversion.begin = begin;
+        conversion.widthStar = false;
+        conversion.precisionStar = false;
+        conversion.hasPrecision = false;
+        conversion.precision = 0;
+        conversion.length = LengthModifier::NONE;
+
+        const char* p = begin + 1;
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0' || *p == '\'')
+        {
+            ++p;
+        }
+        if (*p == '*')
+        {
+            conversion.widthStar = true;
+            ++p;
+        }
+        while (*p >= '0' && *p <= '9')
+        {
+            ++p;
+        }
+        if (*p == '.')
+        {
+            conversion.hasPrecision = true;
+            ++p;
+            if (*p == '*')
+            {
+                conversion.precisionStar = true;
+                ++p;
+            }
+            while (*p >= '0' && *p <= '9')
+            {
+                conversion.precision = conversion.precision * 10 + (*p - '0');
+                ++p;
+            }
+        }
+        switch (*p)
+        {
+        case 'h':
+            conversion.length = p[1] == 'h' ? LengthModifier::HH : LengthModifier::H;
+            p += p[1] == 'h' ? 2 : 1;
+            break;
+        case 'l':
+            conversion.length = p[1] == 'l' ? LengthModifier::LL : LengthModifier::L;
+            p += p[1] == 'l' ? 2 : 1;
+            break;
+        case 'j':
+            conversion.length = LengthModifier::J;
+            ++p;
+            break;
+        case 'z':
+            conversion.length = LengthModifier::Z;
+            ++p;
+            break;
+        case 't':
+            conversion.length = LengthModifier::T;
+            ++p;
+            break;
+        case 'L':
+            conversion.length = LengthModifier::LONG_DOUBLE;
+            ++p;
+            break;
+        default:
+            break;
+        }
+        conversion.type = *p;
+        conversion.end = *p ? p + 1 : p;
+        if (static_cast<size_t>(conversion.end - conversion.begin) >= MAX_CONVERSION_LENGTH)
+        {
+            return false;
+        }
+
+        switch (conversion.type)
+        {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            return conversion.length != LengthModifier::LONG_DOUBLE;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            return conversion.length == LengthModifier::NONE || conversion.length == LengthModifier::L ||
+                   conversion.length == LengthModifier::LONG_DOUBLE;
+        case 'c': case 's': case 'p':
+            // wide characters and strings are not supported
+            return conversion.length == LengthModifier::NONE;
+        default:
+            // %n and unknown conversions
+            return false;
+        }
+    }
+
+    bool IsSigned(char type)
+    {
+        return type == 'd' || type == 'i';
+    }
+
+    bool IsUnsigned(char type)
+    {
+        return type == 'u' || type == 'o' || type == 'x' || type == 'X';
+    }
+
+    bool IsFloatingPoint(char type)
+    {
+        return type == 'f' || type == 'F' || type == 'e' || type == 'E' || type == 'g' || type == 'G' || type == 'a' || type == 'A';
+    }
+
+    bool CanDefer(const char* formatStr)
+    {
+        for (const char* p = formatStr; *p; ++p)
+        {
+            if (*p != '%')
+            {
+                continue;
+            }
+            if (p[1] == '%')
+            {
+                ++p;
+                continue;
+            }
+            Conversion conversion;
+            if (!ParseConversion(p, conversion))
+            {
+                return false;
+            }
+            p = conversion.end - 1;
+        }
+        return true;
+    }
+
+    template<typename T>
+    void Append(Aws::Vector<unsigned char>& record, const T& value)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+        record.insert(record.end(), bytes, bytes + sizeof(T));
+    }
+
+    void AppendBytes(Aws::Vector<unsigned char>& record, const char* data, size_t length)
+    {
+        Append(record, static_cast<uint32_t>(length));
+        record.insert(record.end(), data, data + length);
+    }
+
+    static const uint32_t NULL_STRING = UINT32_MAX;
+
+    class RecordReader
+    {
+    public:
+        RecordReader(const unsigned char* data, size_t length) : m_cursor(data), m_end(data + length) {}
+
+        template<typename T>
+        T Read()
+        {
+            T value;
+            std::memset(&value, 0, sizeof(T));
+            if (static_cast<size_t>(m_end - m_cursor) >= sizeof(T))
+            {
+                std::memcpy(&value, m_cursor, sizeof(T));
+                m_cursor += sizeof(T);
+            }
+            return value;
+        }
+
+        /**
+         * Returns nullptr for a null string argument.
+         */
+        const char* ReadBytes(size_t& length)
+        {
+            const uint32_t header = Read<uint32_t>();
+            if (header == NULL_STRING)
+            {
+                length = 0;
+                return nullptr;
+            }
+            length = header;
+            if (static_cast<size_t>(m_end - m_cursor) < length)
+            {
+                length = static_cast<size_t>(m_end - m_cursor);
+            }
+            const char* data = reinterpret_cast<const char*>(m_cursor);
+            m_cursor += length;
+            return data;
+        }
+
+    private:
+        const unsigned char* m_cursor;
+        const unsigned char* m_end;
+    };
+
+    template<typename... Args>
+    void AppendPrintf(Aws::String& out, const char* spec, Args... args)
+    {
+        char buffer[256];
+        const int length = snprintf(buffer, sizeof(buffer), spec, args...);
+        if (length < 0)
+        {
+            return;
+        }
+        if (static_cast<size_t>(length) < sizeof(buffer))
+        {
+            out.append(buffer, static_cast<size_t>(length));
+            return;
+        }
+        const size_t offset = out.size();
+        out.resize(offset + static_cast<size_t>(length) + 1);
+        snprintf(&out[offset], static_cast<size_t>(length) + 1, spec, args...);
+        out.resize(offset + static_cast<size_t>(length));
+    }
+
+    template<typename T>
+    void AppendConversion(Aws::String& out, const char* spec, const Conversion& conversion, int width, int precision, T value)
+    {
+        if (conversion.widthStar && conversion.precisionStar)
+        {
+            AppendPrintf(out, spec, width, precision, value);
+        }
+        else if (conversion.widthStar)
+        {
+            AppendPrintf(out, spec, width, value);
+        }
+        else if (conversion.precisionStar)
+        {
+            AppendPrintf(out, spec, precision, value);
+        }
+        else
+        {
+            AppendPrintf(out, spec, value);
+        }
+    }
+
+    const char* GetLevelPrefix(LogLevel logLevel)
+    {
+        switch (logLevel)
+        {
+        case LogLevel::Fatal:
+            return "[FATAL] ";
+        case LogLevel::Error:
+            return "[ERROR] ";
+        case LogLevel::Warn:
+            return "[WARN] ";
+        case LogLevel::Info:
+            return "[INFO] ";
+        case LogLevel::Debug:
+            return "[DEBUG] ";
+        case LogLevel::Trace:
+            return "[TRACE] ";
+        default:
+            return "[UNKNOWN] ";
+        }
+    }
+}
+
+/**
+ * Single-producer/single-consumer ring of length-prefixed records, written by one logging thread and read by the
+ * background thread.
+ */
+class AsyncBinaryLogSystem::Ring
+{
+public:
+    explicit Ring(size_t size) :
+        m_buffer(Aws::MakeUniqueArray<unsigned char>(size, TAG)),
+        m_mask(size - 1),
+        m_writePos(0),
+        m_readPos(0),
+        m_dropped(0),
+        m_abandoned(false),
+        m_threadId(std::this_thread::get_id())
+    {
+    }
+
+    size_t GetSize() const { return m_mask + 1; }
+
+    bool TryWrite(const unsigned char* record, size_t length)
+    {
+        const uint32_t header = static_cast<uint32_t>(length);
+        const size_t writePos = m_writePos.load(std::memory_order_relaxed);
+        const size_t free = GetSize() - (writePos - m_readPos.load(std::memory_order_acquire));
+        if (free < sizeof(header) + length)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        CopyIn(writePos, reinterpret_cast<const unsigned char*>(&header), sizeof(header));
+        CopyIn(writePos + sizeof(header), record, length);
+        // sequentially consistent, so that the producer then sees the background thread going to sleep or the background
+        // thread sees this record
+        m_writePos.store(writePos + sizeof(header) + length);
+        return true;
+    }
+
+    bool TryRead(Aws::Vector<unsigned char>& record)
+    {
+        const size_t readPos = m_readPos.load(std::memory_order_relaxed);
+        if (readPos == m_writePos.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        uint32_t length = 0;
+        CopyOut(readPos, reinterpret_cast<unsigned char*>(&length), sizeof(length));
+        record.resize(length);
+        CopyOut(readPos + sizeof(length), record.data(), length);
+        m_readPos.store(readPos + sizeof(length) + length, std::memory_order_release);
+        return true;
+    }
+
+    bool IsEmpty() const { return m_readPos.load() == m_writePos.load(); }
+
+    uint64_t TakeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+    void Abandon() { m_abandoned.store(true, std::memory_order_release); }
+    bool IsAbandoned() const { return m_abandoned.load(std::memory_order_acquire); }
+
+    std::thread::id GetThreadId() const { return m_threadId; }
+
+private:
+    void CopyIn(size_t position, const unsigned char* data, size_t length)
+    {
+        const size_t offset = position & m_mask;
+        const size_t first = (std::min)(length, GetSize() - offset);
+        std::memcpy(m_buffer.get() + offset, data, first);
+        std::memcpy(m_buffer.get(), data + first, length - first);
+    }
+
+    void CopyOut(size_t position, unsigned char* data, size_t length) const
+    {
+        const size_t offset = position & m_mask;
+        const size_t first = (std::min)(length, GetSize() - offset);
+        std::memcpy(data, m_buffer.get() + offset, first);
+        std::memcpy(data + first, m_buffer.get(), length - first);
+    }
+
+    Aws::UniqueArrayPtr<unsigned char> m_buffer;
+    const size_t m_mask;
+    std::atomic<size_t> m_writePos;
+    std::atomic<size_t> m_readPos;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<bool> m_abandoned;
+    const std::thread::id m_threadId;
+};
+
+/**
+ * The ring of the calling thread, abandoned when the thread exits.
+ */
+struct AsyncBinaryLogSystem::ThreadRing
+{
+    uint64_t ownerId = 0;
+    std::shared_ptr<Ring> ring;
+
+    ~ThreadRing()
+    {
+        if (ring)
+        {
+            ring->Abandon();
+        }
+    }
+};
+
+static size_t RoundUpRingSize(size_t ringSize)
+{
+    size_t size = 1024;
+    while (size < ringSize)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+static std::shared_ptr<Aws::OStream> MakeLogFile(const Aws::String& filenamePrefix)
+{
+    Aws::String newFileName = filenamePrefix + DateTime::CalculateLocalTimestampAsString("%Y-%m-%d-%H") + ".log";
+    return Aws::MakeShared<Aws::OFStream>(TAG, newFileName.c_str(), std::ios_base::out | std::ios_base::app);
+}
+
+AsyncBinaryLogSystem::AsyncBinaryLogSystem(LogLevel logLevel, const std::shared_ptr<Aws::OStream>& logFile, size_t ringSize) :
+    m_logLevel(logLevel),
+    m_logFile(logFile),
+    m_ringSize(RoundUpRingSize(ringSize)),
+    m_instanceId(s_nextInstanceId.fetch_add(1)),
+    m_droppedCount(0),
+    m_writerSleeping(false),
+    m_stop(false),
+    m_flushRequested(0),
+    m_flushCompleted(0),
+    m_cachedSecond(-1)
+{
+    m_loggingThread = std::thread(&AsyncBinaryLogSystem::Run, this);
+}
+
+AsyncBinaryLogSystem::AsyncBinaryLogSystem(LogLevel logLevel, const Aws::String& filenamePrefix, size_t ringSize) :
+    AsyncBinaryLogSystem(logLevel, MakeLogFile(filenamePrefix), ringSize)
+{
+}
+
+AsyncBinaryLogSystem::~AsyncBinaryLogSystem()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_stop = true;
+    }
+    m_signal.notify_all();
+    m_loggingThread.join();
+}
+
+void AsyncBinaryLogSystem::Log(LogLevel logLevel, const char* tag, const char* formatStr, ...)
+{
+    Ring* ring = GetThreadRing();
+    // records reused by the calling thread, so that logging does not allocate once they have grown
+    static thread_local Aws::Vector<unsigned char> record;
+    record.clear();
+
+    const size_t tagLength = tag ? std::strlen(tag) : 0;
+    // leave room for the other records of the thread, longer strings are truncated
+    const size_t maxStringLength = ring->GetSize() / 8;
+
+    va_list args;
+    va_start(args, formatStr);
+
+    if (CanDefer(formatStr))
+    {
+        Append(record, RecordKind::DEFERRED_FORMAT);
+        Append(record, logLevel);
+        Append(record, static_cast<int64_t>(DateTime::CurrentTimeMillis()));
+        AppendBytes(record, tag, tagLength);
+        Append(record, formatStr);
+
+        for (const char* p = formatStr; *p; ++p)
+        {
+            if (*p != '%')
+            {
+                continue;
+            }
+            if (p[1] == '%')
+            {
+                ++p;
+                continue;
+            }
+            Conversion conversion;
+            ParseConversion(p, conversion);
+            p = conversion.end - 1;
+
+            if (conversion.widthStar)
+            {
+                Append(record, static_cast<int32_t>(va_arg(args, int)));
+            }
+            int precision = conversion.precision;
+            if (conversion.precisionStar)
+            {
+                precision = va_arg(args, int);
+                Append(record, static_cast<int32_t>(precision));
+            }
+
+            if (IsSigned(conversion.type) || conversion.type == 'c')
+            {
+                int64_t value = 0;
+                switch (conversion.length)
+                {
+                case LengthModifier::L: value = va_arg(args, long); break;
+                case LengthModifier::LL: value = va_arg(args, long long); break;
+                case LengthModifier::J: value = static_cast<int64_t>(va_arg(args, intmax_t)); break;
+                case LengthModifier::Z: value = static_cast<int64_t>(va_arg(args, std::make_signed<size_t>::type)); break;
+                case LengthModifier::T: value = static_cast<int64_t>(va_arg(args, ptrdiff_t)); break;
+                default: value = va_arg(args, int); break;
+                }
+                Append(record, value);
+            }
+            else if (IsUnsigned(conversion.type))
+            {
+                uint64_t value = 0;
+                switch (conversion.length)
+                {
+                case LengthModifier::L: value = va_arg(args, unsigned long); break;
+                case LengthModifier::LL: value = va_arg(args, unsigned long long); break;
+                case LengthModifier::J: value = static_cast<uint64_t>(va_arg(args, uintmax_t)); break;
+                case LengthModifier::Z: value = static_cast<uint64_t>(va_arg(args, size_t)); break;
+                case LengthModifier::T: value = static_cast<uint64_t>(va_arg(args, std::make_unsigned<ptrdiff_t>::type)); break;
+                default: value = va_arg(args, unsigned int); break;
+                }
+                Append(record, value);
+            }
+            else if (IsFloatingPoint(conversion.type))
+            {
+                if (conversion.length == LengthModifier::LONG_DOUBLE)
+                {
+                    Append(record, va_arg(args, long double));
+                }
+                else
+                {
+                    Append(record, va_arg(args, double));
+                }
+            }
+            else if (conversion.type == 'p')
+            {
+                Append(record, va_arg(args, void*));
+            }
+            else // 's'
+            {
+                const char* value = va_arg(args, const char*);
+                if (!value)
+                {
+                    Append(record, NULL_STRING);
+                    continue;
+                }
+                size_t length = 0;
+                const size_t maxLength = conversion.hasPrecision && precision >= 0 ?
+                    (std::min)(static_cast<size_t>(precision), maxStringLength) : maxStringLength;
+                while (length < maxLength && value[length])
+                {
+                    ++length;
+                }
+                AppendBytes(record, value, length);
+            }
+        }
+    }
+    else
+    {
+        // not deferrable, format on the calling thread as FormattedLogSystem does
+        va_list tmp_args;
+        va_copy(tmp_args, args);
+        const int requiredLength = vsnprintf(nullptr, 0, formatStr, tmp_args);
+        va_end(tmp_args);
+        const size_t length = requiredLength > 0 ? (std::min)(static_cast<size_t>(requiredLength), maxStringLength) : 0;
+
+        Append(record, RecordKind::TEXT);
+        Append(record, logLevel);
+        Append(record, static_cast<int64_t>(DateTime::CurrentTimeMillis()));
+        AppendBytes(record, tag, tagLength);
+        Append(record, static_cast<uint32_t>(length));
+        const size_t offset = record.size();
+        record.resize(offset + length + 1);
+        vsnprintf(reinterpret_cast<char*>(record.data() + offset), length + 1, formatStr, args);
+        record.resize(offset + length);
+    }
+
+    va_end(args);
+    Enqueue(record.data(), record.size());
+}
+
+void AsyncBinaryLogSystem::LogStream(LogLevel logLevel, const char* tag, const Aws::OStringStream& messageStream)
+{
+    Ring* ring = GetThreadRing();
+    static thread_local Aws::Vector<unsigned char> record;
+    record.clear();
+
+    const Aws::String message = messageStream.str();
+    Append(record, RecordKind::TEXT);
+    Append(record, logLevel);
+    Append(record, static_cast<int64_t>(DateTime::CurrentTimeMillis()));
+    AppendBytes(record, tag, tag ? std::strlen(tag) : 0);
+    AppendBytes(record, message.data(), (std::min)(message.size(), ring->GetSize() / 8));
+    Enqueue(record.data(), record.size());
+}
+
+void AsyncBinaryLogSystem::Flush()
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    const uint64_t flush = ++m_flushRequested;
+    m_signal.notify_all();
+    m_signal.wait(locker, [this, flush]() { return m_flushCompleted >= flush || m_stop; });
+}
+
+AsyncBinaryLogSystem::Ring* AsyncBinaryLogSystem::GetThreadRing()
+{
+    static thread_local ThreadRing threadRing;
+    if (threadRing.ownerId != m_instanceId)
+    {
+        if (threadRing.ring)
+        {
+            threadRing.ring->Abandon();
+        }
+        auto ring = Aws::MakeShared<Ring>(TAG, m_ringSize);
+        {
+            std::lock_guard<std::mutex> locker(m_ringsMutex);
+            m_rings.push_back(ring);
+        }
+        threadRing.ring = ring;
+        threadRing.ownerId = m_instanceId;
+    }
+    return threadRing.ring.get();
+}
+
+void AsyncBinaryLogSystem::Enqueue(const unsigned char* record, size_t length)
+{
+    if (GetThreadRing()->TryWrite(record, length))
+    {
+        WakeWriter();
+    }
+    else
+    {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AsyncBinaryLogSystem::WakeWriter()
+{
+    // only take the lock when the logging thread is idle, it drains every ring before going back to sleep
+    if (m_writerSleeping.load())
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+        }
+        m_signal.notify_all();
+    }
+}
+
+void AsyncBinaryLogSystem::Run()
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (true)
+    {
+        const uint64_t flushRequested = m_flushRequested;
+        const bool stop = m_stop;
+        locker.unlock();
+
+        const bool wrote = WritePendingRecords();
+        if (flushRequested != m_flushCompleted || stop)
+        {
+            while (WritePendingRecords()) {}
+            m_logFile->flush();
+        }
+
+        locker.lock();
+        if (flushRequested != m_flushCompleted)
+        {
+            m_flushCompleted = flushRequested;
+            m_signal.notify_all();
+        }
+        if (stop)
+        {
+            break;
+        }
+        if (!wrote)
+        {
+            m_writerSleeping.store(true);
+            m_signal.wait(locker, [this]()
+            {
+                return m_stop || m_flushRequested != m_flushCompleted || HasPendingRecords();
+            });
+            m_writerSleeping.store(false);
+        }
+    }
+}
+
+bool AsyncBinaryLogSystem::HasPendingRecords()
+{
+    std::lock_guard<std::mutex> locker(m_ringsMutex);
+    for (const auto& ring : m_rings)
+    {
+        if (!ring->IsEmpty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AsyncBinaryLogSystem::WritePendingRecords()
+{
+    Aws::Vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> locker(m_ringsMutex);
+        rings = m_rings;
+    }
+
+    bool wrote = false;
+    for (const auto& ring : rings)
+    {
+        const uint64_t dropped = ring->TakeDropped();
+        if (dropped > 0)
+        {
+            Aws::OStringStream message;
+            message << GetLevelPrefix(LogLevel::Warn) << DateTime::CalculateGmtTimeWithMsPrecision() << " " << TAG
+                    << " [" << ring->GetThreadId() << "] Dropped " << dropped << " log statements, the ring buffer of the thread was full.\n";
+            *m_logFile << message.str();
+            wrote = true;
+        }
+
+        // bound the records taken from a ring at once, so that a busy thread does not starve the other ones
+        for (size_t i = 0; i < 1024 && ring->TryRead(m_record); ++i)
+        {
+            WriteRecord(ring->GetThreadId(), m_record.data(), m_record.size());
+            wrote = true;
+        }
+
+        if (ring->IsAbandoned() && ring->IsEmpty())
+        {
+            std::lock_guard<std::mutex> locker(m_ringsMutex);
+            for (auto it = m_rings.begin(); it != m_rings.end(); ++it)
+            {
+                if (*it == ring)
+                {
+                    m_rings.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+    return wrote;
+}
+
+void AsyncBinaryLogSystem::WriteRecord(const std::thread::id& threadId, const unsigned char* data, size_t length)
+{
+    RecordReader reader(data, length);
+    const RecordKind kind = reader.Read<RecordKind>();
+    const LogLevel logLevel = reader.Read<LogLevel>();
+    const int64_t timestamp = reader.Read<int64_t>();
+    size_t tagLength = 0;
+    const char* tag = reader.ReadBytes(tagLength);
+
+    m_line.clear();
+    m_line += GetLevelPrefix(logLevel);
+    const int64_t second = timestamp / 1000;
+    if (second != m_cachedSecond)
+    {
+        m_cachedSecond = second;
+        m_cachedSecondString = DateTime(second * 1000).ToGmtString("%Y-%m-%d %H:%M:%S");
+    }
+    m_line += m_cachedSecondString;
+    AppendPrintf(m_line, ".%03d ", static_cast<int>(timestamp % 1000));
+    m_line.append(tag, tagLength);
+    Aws::OStringStream threadIdStream;
+    threadIdStream << " [" << threadId << "] ";
+    m_line += threadIdStream.str();
+
+    if (kind == RecordKind::TEXT)
+    {
+        size_t messageLength = 0;
+        const char* message = reader.ReadBytes(messageLength);
+        m_line.append(message, messageLength);
+    }
+    else
+    {
+        const char* formatStr = reader.Read<const char*>();
+        const char* literal = formatStr;
+        for (const char* p = formatStr; *p; ++p)
+        {
+            if (*p != '%')
+            {
+                continue;
+            }
+            m_line.append(literal, p);
+            if (p[1] == '%')
+            {
+                m_line += '%';
+                literal = p + 2;
+                ++p;
+                continue;
+            }
+
+            Conversion conversion;
+            ParseConversion(p, conversion);
+            char spec[MAX_CONVERSION_LENGTH];
+            const size_t specLength = static_cast<size_t>(conversion.end - conversion.begin);
+            std::memcpy(spec, conversion.begin, specLength);
+            spec[specLength] = '\0';
+            p = conversion.end - 1;
+            literal = conversion.end;
+
+            const int width = conversion.widthStar ? reader.Read<int32_t>() : 0;
+            const int precision = conversion.precisionStar ? reader.Read<int32_t>() : conversion.precision;
+
+            if (IsSigned(conversion.type) || conversion.type == 'c')
+            {
+                const int64_t value = reader.Read<int64_t>();
+                switch (conversion.length)
+                {
+                case LengthModifier::L: AppendConversion(m_line, spec, conversion, width, precision, static_cast<long>(value)); break;
+                case LengthModifier::LL: AppendConversion(m_line, spec, conversion, width, precision, static_cast<long long>(value)); break;
+                case LengthModifier::J: AppendConversion(m_line, spec, conversion, width, precision, static_cast<intmax_t>(value)); break;
+                case LengthModifier::Z: AppendConversion(m_line, spec, conversion, width, precision, static_cast<std::make_signed<size_t>::type>(value)); break;
+                case LengthModifier::T: AppendConversion(m_line, spec, conversion, width, precision, static_cast<ptrdiff_t>(value)); break;
+                default: AppendConversion(m_line, spec, conversion, width, precision, static_cast<int>(value)); break;
+                }
+            }
+            else if (IsUnsigned(conversion.type))
+            {
+                const uint64_t value = reader.Read<uint64_t>();
+                switch (conversion.length)
+                {
+                case LengthModifier::L: AppendConversion(m_line, spec, conversion, width, precision, static_cast<unsigned long>(value)); break;
+                case LengthModifier::LL: AppendConversion(m_line, spec, conversion, width, precision, static_cast<unsigned long long>(value)); break;
+                case LengthModifier::J: AppendConversion(m_line, spec, conversion, width, precision, static_cast<uintmax_t>(value)); break;
+                case LengthModifier::Z: AppendConversion(m_line, spec, conversion, width, precision, static_cast<size_t>(value)); break;
+                case LengthModifier::T: AppendConversion(m_line, spec, conversion, width, precision, static_cast<std::make_unsigned<ptrdiff_t>::type>(value)); break;
+                default: AppendConversion(m_line, spec, conversion, width, precision, static_cast<unsigned int>(value)); break;
+                }
+            }
+            else if (IsFloatingPoint(conversion.type))
+            {
+                if (conversion.length == LengthModifier::LONG_DOUBLE)
+                {
+                    AppendConversion(m_line, spec, conversion, width, precision, reader.Read<long double>());
+                }
+                else
+                {
+                    AppendConversion(m_line, spec, conversion, width, precision, reader.Read<double>());
+                }
+            }
+            else if (conversion.type == 'p')
+            {
+                AppendConversion(m_line, spec, conversion, width, precision, reader.Read<void*>());
+            }
+            else // 's'
+            {
+                size_t stringLength = 0;
+                const char* value = reader.ReadBytes(stringLength);
+                if (!value)
+                {
+                    AppendConversion(m_line, spec, conversion, width, precision, "(null)");
+                    continue;
+                }
+                // the copied string is not null-terminated, and at most as long as the precision
+                const Aws::String copy(value, stringLength);
+                AppendConversion(m_line, spec, conversion, width, precision, copy.c_str());
+            }
+        }
+        m_line.append(literal);
+    }
+
+    m_line += '\n';
+    m_logFile->write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
+}
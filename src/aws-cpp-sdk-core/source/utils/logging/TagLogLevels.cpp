@@ -0,0 +1,161 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/logging/TagLogLevels.h>
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Logging
+        {
+            std::atomic<size_t> TagLogLevelCount(0);
+
+            namespace
+            {
+                const int NO_LOG_LEVEL = -1;
+
+                /**
+                 * Slot of the open addressing table of tags. A slot is claimed by publishing the hash of its tag after
+                 * copying the tag, and is never released: clearing the level of a tag only resets the level, so lookups
+                 * can probe the table without locking.
+                 */
+                struct TagLogLevelEntry
+                {
+                    std::atomic<uint64_t> hash;
+                    char tag[MAX_LOG_TAG_LENGTH + 1];
+                    std::atomic<int> logLevel;
+                };
+
+                TagLogLevelEntry s_tagLogLevels[MAX_TAG_LOG_LEVELS];
+                std::mutex s_tagLogLevelsMutex;
+
+                // FNV-1a, 0 marks empty slots
+                uint64_t HashTag(const char* tag, size_t& length)
+                {
+                    uint64_t hash = 14695981039346656037ULL;
+                    for (length = 0; tag[length]; ++length)
+                    {
+                        hash ^= static_cast<unsigned char>(tag[length]);
+                        hash *= 1099511628211ULL;
+                    }
+                    return hash ? hash : 1;
+                }
+
+                TagLogLevelEntry* FindEntry(const char* tag, uint64_t hash)
+                {
+                    for (size_t i = 0; i < MAX_TAG_LOG_LEVELS; ++i)
+                    {
+                        TagLogLevelEntry& entry = s_tagLogLevels[(hash + i) % MAX_TAG_LOG_LEVELS];
+                        const uint64_t entryHash = entry.hash.load(std::memory_order_acquire);
+                        if (entryHash == 0)
+                        {
+                            return nullptr;
+                        }
+                        if (entryHash == hash && std::strcmp(entry.tag, tag) == 0)
+                        {
+                            return &entry;
+                        }
+                    }
+                    return nullptr;
+                }
+            }
+
+            bool SetLogLevelForTag(const char* tag, LogLevel logLevel)
+            {
+                if (!tag)
+                {
+                    return false;
+                }
+                size_t length = 0;
+                const uint64_t hash = HashTag(tag, length);
+                if (length > MAX_LOG_TAG_LENGTH)
+                {
+                    return false;
+                }
+
+                std::lock_guard<std::mutex> locker(s_tagLogLevelsMutex);
+                TagLogLevelEntry* entry = FindEntry(tag, hash);
+                if (!entry)
+                {
+                    for (size_t i = 0; i < MAX_TAG_LOG_LEVELS && !entry; ++i)
+                    {
+                        TagLogLevelEntry& candidate = s_tagLogLevels[(hash + i) % MAX_TAG_LOG_LEVELS];
+                        if (candidate.hash.load(std::memory_order_relaxed) == 0)
+                        {
+                            std::memcpy(candidate.tag, tag, length + 1);
+                            candidate.logLevel.store(NO_LOG_LEVEL, std::memory_order_relaxed);
+                            candidate.hash.store(hash, std::memory_order_release);
+                            entry = &candidate;
+                        }
+                    }
+                    if (!entry)
+                    {
+                        return false;
+                    }
+                }
+
+                if (entry->logLevel.exchange(static_cast<int>(logLevel), std::memory_order_relaxed) == NO_LOG_LEVEL)
+                {
+                    TagLogLevelCount.fetch_add(1, std::memory_order_relaxed);
+                }
+                return true;
+            }
+
+            void ClearLogLevelForTag(const char* tag)
+            {
+                if (!tag)
+                {
+                    return;
+                }
+                size_t length = 0;
+                const uint64_t hash = HashTag(tag, length);
+
+                std::lock_guard<std::mutex> locker(s_tagLogLevelsMutex);
+                TagLogLevelEntry* entry = FindEntry(tag, hash);
+                if (entry && entry->logLevel.exchange(NO_LOG_LEVEL, std::memory_order_relaxed) != NO_LOG_LEVEL)
+                {
+                    TagLogLevelCount.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            void ClearLogLevelsForTags()
+            {
+                std::lock_guard<std::mutex> locker(s_tagLogLevelsMutex);
+                for (auto& entry : s_tagLogLevels)
+                {
+                    entry.logLevel.store(NO_LOG_LEVEL, std::memory_order_relaxed);
+                }
+                TagLogLevelCount.store(0, std::memory_order_relaxed);
+            }
+
+            bool GetLogLevelForTag(const char* tag, LogLevel& logLevel)
+            {
+                if (!tag)
+                {
+                    return false;
+                }
+                size_t length = 0;
+                const TagLogLevelEntry* entry = FindEntry(tag, HashTag(tag, length));
+                if (!entry)
+                {
+                    return false;
+                }
+                const int entryLogLevel = entry->logLevel.load(std::memory_order_relaxed);
+                if (entryLogLevel == NO_LOG_LEVEL)
+                {
+                    return false;
+                }
+                logLevel = static_cast<LogLevel>(entryLogLevel);
+                return true;
+            }
+
+        } // namespace Logging
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,198 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/AwsChunkedSigningStream.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char AWS_CHUNKED_SIGNING_STREAM_TAG[] = "AwsChunkedSigningStream";
+static const char CHUNK_SIGNATURE[] = ";chunk-signature=";
+static const char TRAILER_SIGNATURE[] = "x-amz-trailer-signature:";
+static const char CRLF[] = "\r\n";
+static const size_t SIGNATURE_LENGTH = 64;
+
+namespace
+{
+    size_t HexLength(uint64_t value)
+    {
+        size_t length = 1;
+        while (value >>= 4)
+        {
+            ++length;
+        }
+        return length;
+    }
+
+    void AppendHex(Aws::String& output, uint64_t value)
+    {
+        static const char HEX_DIGITS[] = "0123456789abcdef";
+        const size_t length = HexLength(value);
+        const size_t start = output.size();
+        output.resize(start + length);
+        for (size_t i = length; i > 0; --i, value >>= 4)
+        {
+            output[start + i - 1] = HEX_DIGITS[value & 0xf];
+        }
+    }
+
+    uint64_t ChunkLength(uint64_t dataLength)
+    {
+        return HexLength(dataLength) + sizeof(CHUNK_SIGNATURE) - 1 + SIGNATURE_LENGTH + 2 + dataLength + 2;
+    }
+}
+
+AwsChunkedSigningStreamBuf::AwsChunkedSigningStreamBuf(const std::shared_ptr<Aws::IOStream>& body,
+                                                       Aws::Auth::ChunkSigner&& signer,
+                                                       size_t chunkSize,
+                                                       const Aws::String& checksumHeaderName,
+                                                       const std::shared_ptr<Aws::Utils::Crypto::Hash>& checksum) :
+    m_body(body),
+    m_bodyStart(body ? body->tellg() : std::streampos(std::streamoff(-1))),
+    m_signer(std::move(signer)),
+    m_checksumHeaderName(checksumHeaderName),
+    m_checksum(checksum),
+    m_chunk(chunkSize > 0 ? chunkSize : 1),
+    m_segments(),
+    m_segmentCount(0),
+    m_nextSegment(0),
+    m_position(0),
+    m_finished(false)
+{
+    m_chunkHeader.reserve(HexLength(m_chunk.GetLength()) + sizeof(CHUNK_SIGNATURE) + SIGNATURE_LENGTH + 2);
+}
+
+uint64_t AwsChunkedSigningStreamBuf::GetEncodedLength(uint64_t decodedLength, size_t chunkSize,
+                                                      const Aws::String& checksumHeaderName, size_t checksumLength)
+{
+    chunkSize = chunkSize > 0 ? chunkSize : 1;
+    uint64_t length = (decodedLength / chunkSize) * ChunkLength(chunkSize);
+    if (decodedLength % chunkSize > 0)
+    {
+        length += ChunkLength(decodedLength % chunkSize);
+    }
+    // the final chunk has no data and no CRLF after it, the trailer or a lone CRLF follows
+    length += ChunkLength(0) - 2;
+    if (checksumLength > 0)
+    {
+        length += checksumHeaderName.size() + 1 + EncodingUtils::Base64EncodedLength(checksumLength) + 2;
+        length += sizeof(TRAILER_SIGNATURE) - 1 + SIGNATURE_LENGTH + 2;
+    }
+    return length + 2;
+}
+
+AwsChunkedSigningStreamBuf::int_type AwsChunkedSigningStreamBuf::underflow()
+{
+    if (gptr() < egptr())
+    {
+        return traits_type::to_int_type(*gptr());
+    }
+
+    for (;;)
+    {
+        m_position += static_cast<uint64_t>(egptr() - eback());
+        setg(nullptr, nullptr, nullptr);
+
+        while (m_nextSegment < m_segmentCount)
+        {
+            const Segment& segment = m_segments[m_nextSegment++];
+            if (segment.length > 0)
+            {
+                char* begin = const_cast<char*>(segment.data);
+                setg(begin, begin, begin + segment.length);
+                return traits_type::to_int_type(*gptr());
+            }
+        }
+
+        if (m_finished || !ReadNextChunk())
+        {
+            return traits_type::eof();
+        }
+    }
+}
+
+AwsChunkedSigningStreamBuf::pos_type AwsChunkedSigningStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    // only tellg() is supported, the signatures of a chunk depend on all the chunks before it
+    if (off == 0 && dir == std::ios_base::cur && (which & std::ios_base::in))
+    {
+        return pos_type(static_cast<off_type>(m_position + static_cast<uint64_t>(gptr() - eback())));
+    }
+    return pos_type(off_type(-1));
+}
+
+bool AwsChunkedSigningStreamBuf::ReadNextChunk()
+{
+    size_t read = 0;
+    if (m_body && *m_body)
+    {
+        m_body->read(m_chunk.GetUnderlyingData(), static_cast<std::streamsize>(m_chunk.GetLength()));
+        read = static_cast<size_t>(m_body->gcount());
+        if (m_body->bad() || (m_body->fail() && !m_body->eof()))
+        {
+            AWS_LOGSTREAM_ERROR(AWS_CHUNKED_SIGNING_STREAM_TAG, "Failed to read the request body, the upload is not terminated");
+            m_finished = true;
+            return false;
+        }
+    }
+
+    unsigned char* data = reinterpret_cast<unsigned char*>(m_chunk.GetUnderlyingData());
+    if (read > 0 && m_checksum)
+    {
+        m_checksum->Update(data, read);
+    }
+
+    m_chunkHeader.clear();
+    AppendHex(m_chunkHeader, read);
+    m_chunkHeader.append(CHUNK_SIGNATURE);
+    m_chunkHeader.append(m_signer.SignChunk(data, read));
+    m_chunkHeader.append(CRLF);
+
+    if (read > 0)
+    {
+        SetSegments({{m_chunkHeader.c_str(), m_chunkHeader.size()}, {m_chunk.GetUnderlyingData(), read}, {CRLF, 2}});
+        return true;
+    }
+
+    m_trailer.clear();
+    if (m_checksum)
+    {
+        Aws::String trailingHeader = m_checksumHeaderName;
+        trailingHeader.append(":").append(HashingUtils::Base64Encode(m_checksum->GetHash().GetResult()));
+        const Aws::String trailerSignature = m_signer.SignTrailer(trailingHeader + "\n");
+
+        m_trailer.append(trailingHeader).append(CRLF);
+        m_trailer.append(TRAILER_SIGNATURE).append(trailerSignature).append(CRLF);
+    }
+    m_trailer.append(CRLF);
+
+    SetSegments({{m_chunkHeader.c_str(), m_chunkHeader.size()}, {m_trailer.c_str(), m_trailer.size()}});
+    m_finished = true;
+    return true;
+}
+
+void AwsChunkedSigningStreamBuf::SetSegments(std::initializer_list<Segment> segments)
+{
+    m_segmentCount = 0;
+    m_nextSegment = 0;
+    for (const Segment& segment : segments)
+    {
+        m_segments[m_segmentCount++] = segment;
+    }
+}
+
+AwsChunkedSigningStream::AwsChunkedSigningStream(const std::shared_ptr<Aws::IOStream>& body,
+                                                 Aws::Auth::ChunkSigner&& signer,
+                                                 size_t chunkSize,
+                                                 const Aws::String& checksumHeaderName,
+                                                 const std::shared_ptr<Aws::Utils::Crypto::Hash>& checksum) :
+    Aws::IOStream(nullptr),
+    m_buffer(body, std::move(signer), chunkSize, checksumHeaderName, checksum)
+{
+    rdbuf(&m_buffer);
+}
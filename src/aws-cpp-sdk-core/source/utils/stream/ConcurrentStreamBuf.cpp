@@ -0,0 +1,275 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/ConcurrentStreamBuf.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            static const char TAG[] = "ConcurrentStreamBuf";
+
+            ConcurrentStreamBuf::ConcurrentStreamBuf(size_t bufferLength) :
+                m_capacity(1),
+                m_wakeWriterThreshold(1),
+                m_writePos(0),
+                m_readPos(0),
+                m_readerWaiting(false),
+                m_writerWaiting(false),
+                m_eofInput(false),
+                m_eofOutput(false)
+            {
+                while (m_capacity < bufferLength)
+                {
+                    m_capacity <<= 1;
+                }
+                m_wakeWriterThreshold = (std::max)(m_capacity / 4, static_cast<size_t>(1));
+                m_ring = Aws::MakeUniqueArray<unsigned char>(m_capacity, TAG);
+                setg(nullptr, nullptr, nullptr);
+                setp(nullptr, nullptr);
+            }
+
+            void ConcurrentStreamBuf::SetEofInput(Aws::IOStream* pStreamToClose)
+            {
+                if (pStreamToClose)
+                {
+                    pStreamToClose->flush();
+                }
+                FlushPutArea();
+                m_eofInput.store(true);
+                WakeReader();
+            }
+
+            void ConcurrentStreamBuf::CloseStream()
+            {
+                m_eofOutput.store(true);
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                }
+                m_signal.notify_all();
+            }
+
+            bool ConcurrentStreamBuf::WaitForDrain(int64_t timeoutMs)
+            {
+                FlushPutArea();
+                std::unique_lock<std::mutex> locker(m_lock);
+                m_writerWaiting.store(true);
+                const bool drained = m_signal.wait_for(locker, std::chrono::milliseconds(timeoutMs), [this]()
+                {
+                    return m_readPos.load() == m_writePos.load(std::memory_order_relaxed) || m_eofOutput.load();
+                });
+                m_writerWaiting.store(false);
+                return drained && m_readPos.load() == m_writePos.load(std::memory_order_relaxed);
+            }
+
+            bool ConcurrentStreamBuf::GetReadSpan(const unsigned char*& data, size_t& length)
+            {
+                if (gptr() == egptr() && underflow() == std::char_traits<char>::eof())
+                {
+                    data = nullptr;
+                    length = 0;
+                    return false;
+                }
+                data = reinterpret_cast<const unsigned char*>(gptr());
+                length = static_cast<size_t>(egptr() - gptr());
+                return true;
+            }
+
+            void ConcurrentStreamBuf::ConsumeReadSpan(size_t count)
+            {
+                assert(count <= static_cast<size_t>(egptr() - gptr()));
+                gbump(static_cast<int>(count));
+            }
+
+            bool ConcurrentStreamBuf::GetWriteSpan(unsigned char*& data, size_t& length)
+            {
+                if (pptr() == epptr())
+                {
+                    FlushPutArea();
+                    if (!AcquirePutArea())
+                    {
+                        data = nullptr;
+                        length = 0;
+                        return false;
+                    }
+                }
+                data = reinterpret_cast<unsigned char*>(pptr());
+                length = static_cast<size_t>(epptr() - pptr());
+                return true;
+            }
+
+            void ConcurrentStreamBuf::CommitWriteSpan(size_t count)
+            {
+                assert(count <= static_cast<size_t>(epptr() - pptr()));
+                pbump(static_cast<int>(count));
+                if (pptr() == epptr())
+                {
+                    FlushPutArea();
+                }
+            }
+
+            std::streampos ConcurrentStreamBuf::seekoff(std::streamoff, std::ios_base::seekdir, std::ios_base::openmode)
+            {
+                return std::streamoff(-1); // Seeking is not supported.
+            }
+
+            std::streampos ConcurrentStreamBuf::seekpos(std::streampos, std::ios_base::openmode)
+            {
+                return std::streamoff(-1); // Seeking is not supported.
+            }
+
+            int ConcurrentStreamBuf::underflow()
+            {
+                ReleaseGetArea();
+
+                const size_t readPos = m_readPos.load(std::memory_order_relaxed);
+                size_t available = m_writePos.load(std::memory_order_acquire) - readPos;
+                if (available == 0)
+                {
+                    std::unique_lock<std::mutex> locker(m_lock);
+                    m_readerWaiting.store(true);
+                    m_signal.wait(locker, [this, readPos]()
+                    {
+                        return m_writePos.load() != readPos || m_eofInput.load() || m_eofOutput.load();
+                    });
+                    m_readerWaiting.store(false);
+                    // the writer publishes its last bytes before setting m_eofInput, so read the position again
+                    available = m_writePos.load(std::memory_order_acquire) - readPos;
+                }
+
+                if (available == 0 || m_eofOutput.load(std::memory_order_relaxed))
+                {
+                    return std::char_traits<char>::eof();
+                }
+
+                const size_t offset = readPos & (m_capacity - 1);
+                char* begin = reinterpret_cast<char*>(m_ring.get() + offset);
+                setg(begin, begin, begin + (std::min)(available, m_capacity - offset));
+                return std::char_traits<char>::to_int_type(*gptr());
+            }
+
+            int ConcurrentStreamBuf::overflow(int ch)
+            {
+                FlushPutArea();
+                if (!AcquirePutArea())
+                {
+                    return std::char_traits<char>::eof();
+                }
+
+                if (ch == std::char_traits<char>::eof())
+                {
+                    return std::char_traits<char>::not_eof(ch);
+                }
+                *pptr() = std::char_traits<char>::to_char_type(ch);
+                pbump(1);
+                return ch;
+            }
+
+            int ConcurrentStreamBuf::sync()
+            {
+                FlushPutArea();
+                return m_eofOutput.load() ? -1 : 0;
+            }
+
+            std::streamsize ConcurrentStreamBuf::showmanyc()
+            {
+                const size_t readPos = m_readPos.load(std::memory_order_relaxed) + static_cast<size_t>(gptr() - eback());
+                const size_t available = m_writePos.load(std::memory_order_acquire) - readPos;
+                if (available == 0 && (m_eofInput.load() || m_eofOutput.load()))
+                {
+                    return -1;
+                }
+                return static_cast<std::streamsize>(available);
+            }
+
+            void ConcurrentStreamBuf::FlushPutArea()
+            {
+                const size_t written = static_cast<size_t>(pptr() - pbase());
+                if (written == 0)
+                {
+                    return;
+                }
+                // keep writing in place to what is left of the contiguous region
+                setp(pptr(), epptr());
+                m_writePos.fetch_add(written);
+                WakeReader();
+            }
+
+            void ConcurrentStreamBuf::ReleaseGetArea()
+            {
+                const size_t consumed = static_cast<size_t>(gptr() - eback());
+                setg(nullptr, nullptr, nullptr);
+                if (consumed == 0)
+                {
+                    return;
+                }
+                m_readPos.fetch_add(consumed);
+                WakeWriter();
+            }
+
+            bool ConcurrentStreamBuf::AcquirePutArea()
+            {
+                const size_t writePos = m_writePos.load(std::memory_order_relaxed);
+                size_t space = m_capacity - (writePos - m_readPos.load(std::memory_order_acquire));
+                if (space == 0 && !m_eofOutput.load())
+                {
+                    std::unique_lock<std::mutex> locker(m_lock);
+                    m_writerWaiting.store(true);
+                    m_signal.wait(locker, [this, writePos]()
+                    {
+                        return m_capacity - (writePos - m_readPos.load()) >= m_wakeWriterThreshold || m_eofOutput.load();
+                    });
+                    m_writerWaiting.store(false);
+                    space = m_capacity - (writePos - m_readPos.load(std::memory_order_acquire));
+                }
+
+                if (m_eofOutput.load(std::memory_order_relaxed))
+                {
+                    setp(nullptr, nullptr);
+                    return false;
+                }
+
+                const size_t offset = writePos & (m_capacity - 1);
+                char* begin = reinterpret_cast<char*>(m_ring.get() + offset);
+                setp(begin, begin + (std::min)(space, m_capacity - offset));
+                return true;
+            }
+
+            // Positions are updated with sequentially consistent operations before the waiting flag of the other side is
+            // read, and each side sets its flag before checking its wait condition, so one of them always sees the other.
+            void ConcurrentStreamBuf::WakeReader()
+            {
+                if (m_readerWaiting.load())
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                    }
+                    m_signal.notify_all();
+                }
+            }
+
+            void ConcurrentStreamBuf::WakeWriter()
+            {
+                if (!m_writerWaiting.load())
+                {
+                    return;
+                }
+                const size_t used = m_writePos.load() - m_readPos.load(std::memory_order_relaxed);
+                if (used == 0 || m_capacity - used >= m_wakeWriterThreshold)
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_lock);
+                    }
+                    m_signal.notify_all();
+                }
+            }
+        }
+    }
+}
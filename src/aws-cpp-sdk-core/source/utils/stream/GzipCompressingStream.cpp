@@ -0,0 +1,397 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/stream/GzipCompressingStream.h>
+#include <aws/core/utils/CrcUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+#include "zlib.h"
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Stream;
+
+static const char GZIP_COMPRESSING_STREAM_TAG[] = "GzipCompressingStream";
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+namespace
+{
+    const size_t DICTIONARY_SIZE = 32 * 1024;
+    const size_t DEFLATE_OUTPUT_SIZE = 64 * 1024;
+    // magic, deflate, no flags, no modification time, no extra flags, unknown OS
+    const unsigned char GZIP_HEADER[] = {0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff};
+    // an empty final block with fixed codes, ending the deflate stream after the blocks all ended with Z_SYNC_FLUSH
+    const unsigned char DEFLATE_FINAL_BLOCK[] = {0x03, 0x00};
+
+    struct Block
+    {
+        // the dictionary, the end of the input before this block, followed by the data of the block
+        Aws::Vector<unsigned char> input;
+        size_t dictionaryLength = 0;
+        Aws::Vector<unsigned char> output;
+        uint32_t crc = 0;
+        bool done = false;
+        bool failed = false;
+    };
+
+    // shared with the compression tasks, which may still be running after the stream is destroyed
+    struct Pipeline
+    {
+        std::mutex mutex;
+        std::condition_variable blockDone;
+    };
+
+    bool CompressBlock(Block& block)
+    {
+        const unsigned char* data = block.input.data() + block.dictionaryLength;
+        const size_t dataLength = block.input.size() - block.dictionaryLength;
+        block.crc = CrcUtils::CRC32(data, dataLength);
+
+        z_stream stream;
+        std::memset(&stream, 0, sizeof(stream));
+        // raw deflate, the gzip framing is written once around all the blocks
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            return false;
+        }
+        if (block.dictionaryLength > 0 &&
+            deflateSetDictionary(&stream, block.input.data(), static_cast<uInt>(block.dictionaryLength)) != Z_OK)
+        {
+            deflateEnd(&stream);
+            return false;
+        }
+
+        // the sync flush marker and block headers come on top of the bound
+        block.output.resize(deflateBound(&stream, static_cast<uLong>(dataLength)) + 16);
+        stream.next_in = const_cast<Bytef*>(data);
+        stream.avail_in = static_cast<uInt>(dataLength);
+        stream.next_out = block.output.data();
+        stream.avail_out = static_cast<uInt>(block.output.size());
+
+        bool succeeded = true;
+        for (;;)
+        {
+            // the sync flush ends the block on a byte boundary so the blocks can be concatenated
+            const int result = deflate(&stream, Z_SYNC_FLUSH);
+            if (result != Z_OK && result != Z_BUF_ERROR)
+            {
+                succeeded = false;
+                break;
+            }
+            if (stream.avail_in == 0 && stream.avail_out > 0)
+            {
+                break;
+            }
+            const size_t written = block.output.size() - stream.avail_out;
+            block.output.resize(block.output.size() + block.output.size() / 2);
+            stream.next_out = block.output.data() + written;
+            stream.avail_out = static_cast<uInt>(block.output.size() - written);
+        }
+        block.output.resize(block.output.size() - stream.avail_out);
+        deflateEnd(&stream);
+        return succeeded;
+    }
+
+    void AppendLittleEndian(Aws::Vector<unsigned char>& output, uint32_t value)
+    {
+        for (size_t i = 0; i < 4; ++i, value >>= 8)
+        {
+            output.push_back(static_cast<unsigned char>(value & 0xff));
+        }
+    }
+}
+#endif
+
+struct GzipCompressingStreamBuf::CompressionState
+{
+    CompressionState(const std::shared_ptr<Aws::IOStream>& inputStream, size_t inputBlockSize,
+                     Threading::Executor* blockExecutor, size_t blocksInFlight) :
+        input(inputStream),
+        blockSize((std::max)(inputBlockSize, static_cast<size_t>(1))),
+        executor(blockExecutor),
+        maxBlocksInFlight(blocksInFlight)
+    {
+        if (maxBlocksInFlight == 0)
+        {
+            maxBlocksInFlight = (std::max)(2 * static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(2));
+        }
+    }
+
+    std::shared_ptr<Aws::IOStream> input;
+    size_t blockSize;
+    Threading::Executor* executor;
+    size_t maxBlocksInFlight;
+    bool inputEnded = false;
+    bool finished = false;
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+    ~CompressionState()
+    {
+        if (deflateInitialized)
+        {
+            deflateEnd(&deflateStream);
+        }
+    }
+
+    /**
+     * Reads up to size bytes of input, setting inputEnded at its end. Returns false if reading failed.
+     */
+    bool ReadInput(unsigned char* buffer, size_t size, size_t& read)
+    {
+        read = 0;
+        if (input && *input)
+        {
+            input->read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(size));
+            read = static_cast<size_t>(input->gcount());
+        }
+        // an input already failed when handed over is an error as well, only its end is a clean end
+        if (input && (input->bad() || (input->fail() && !input->eof())))
+        {
+            AWS_LOGSTREAM_ERROR(GZIP_COMPRESSING_STREAM_TAG, "Failed to read the input to compress, the compressed stream is not terminated");
+            inputEnded = true;
+            finished = true;
+            return false;
+        }
+        inputEnded = !input || input->eof();
+        return true;
+    }
+
+    /**
+     * Produces the next piece of a single deflate stream.
+     */
+    bool NextDeflateOutput(const unsigned char*& data, size_t& length)
+    {
+        if (!deflateInitialized)
+        {
+            std::memset(&deflateStream, 0, sizeof(deflateStream));
+            // 15 window bits, + 16 for the gzip header and trailer
+            if (deflateInit2(&deflateStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 31, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            {
+                AWS_LOGSTREAM_ERROR(GZIP_COMPRESSING_STREAM_TAG, "Failed to initialize zlib");
+                finished = true;
+                return false;
+            }
+            deflateInitialized = true;
+            inputBuffer.resize(blockSize);
+            outputBuffer.resize(DEFLATE_OUTPUT_SIZE);
+        }
+        if (finished)
+        {
+            return false;
+        }
+
+        deflateStream.next_out = outputBuffer.data();
+        deflateStream.avail_out = static_cast<uInt>(outputBuffer.size());
+        while (deflateStream.avail_out == outputBuffer.size())
+        {
+            if (deflateStream.avail_in == 0 && !inputEnded)
+            {
+                size_t read = 0;
+                if (!ReadInput(inputBuffer.data(), inputBuffer.size(), read))
+                {
+                    return false;
+                }
+                deflateStream.next_in = inputBuffer.data();
+                deflateStream.avail_in = static_cast<uInt>(read);
+            }
+
+            const int result = deflate(&deflateStream, inputEnded ? Z_FINISH : Z_NO_FLUSH);
+            if (result == Z_STREAM_END)
+            {
+                finished = true;
+                break;
+            }
+            if (result != Z_OK && result != Z_BUF_ERROR)
+            {
+                AWS_LOGSTREAM_ERROR(GZIP_COMPRESSING_STREAM_TAG, "Failed to compress the input, zlib error " << result);
+                finished = true;
+                return false;
+            }
+        }
+
+        data = outputBuffer.data();
+        length = outputBuffer.size() - deflateStream.avail_out;
+        return length > 0;
+    }
+
+    /**
+     * Reads the next block of input and submits its compression. Returns false at the end of the input.
+     */
+    bool SubmitNextBlock()
+    {
+        if (inputEnded)
+        {
+            return false;
+        }
+
+        auto block = Aws::MakeShared<Block>(GZIP_COMPRESSING_STREAM_TAG);
+        block->dictionaryLength = dictionary.size();
+        block->input.resize(dictionary.size() + blockSize);
+        std::copy(dictionary.begin(), dictionary.end(), block->input.begin());
+
+        size_t read = 0;
+        if (!ReadInput(block->input.data() + block->dictionaryLength, blockSize, read))
+        {
+            failed = true;
+            return false;
+        }
+        if (read == 0)
+        {
+            return false;
+        }
+        block->input.resize(block->dictionaryLength + read);
+        inputLength += read;
+
+        // the next block is primed with the last 32 KiB of input, which may reach into this block's own dictionary
+        const size_t windowLength = (std::min)(block->input.size(), DICTIONARY_SIZE);
+        dictionary.assign(block->input.end() - windowLength, block->input.end());
+
+        auto blockPipeline = pipeline;
+        std::function<void()> task = [blockPipeline, block]()
+        {
+            const bool succeeded = CompressBlock(*block);
+            std::lock_guard<std::mutex> lock(blockPipeline->mutex);
+            block->failed = !succeeded;
+            block->done = true;
+            blockPipeline->blockDone.notify_all();
+        };
+        if (!executor->Submit(std::function<void()>(task)))
+        {
+            task();
+        }
+        blocks.push_back(block);
+        return true;
+    }
+
+    /**
+     * Produces the gzip header, then each compressed block in order, then the trailer.
+     */
+    bool NextParallelOutput(const unsigned char*& data, size_t& length)
+    {
+        if (!pipeline)
+        {
+            pipeline = Aws::MakeShared<Pipeline>(GZIP_COMPRESSING_STREAM_TAG);
+            data = GZIP_HEADER;
+            length = sizeof(GZIP_HEADER);
+            return true;
+        }
+        if (finished)
+        {
+            return false;
+        }
+
+        while (blocks.size() < maxBlocksInFlight && SubmitNextBlock())
+        {
+        }
+        if (failed)
+        {
+            finished = true;
+            return false;
+        }
+        if (blocks.empty())
+        {
+            framing.assign(DEFLATE_FINAL_BLOCK, DEFLATE_FINAL_BLOCK + sizeof(DEFLATE_FINAL_BLOCK));
+            AppendLittleEndian(framing, crc);
+            AppendLittleEndian(framing, static_cast<uint32_t>(inputLength & 0xffffffff));
+            finished = true;
+            data = framing.data();
+            length = framing.size();
+            return true;
+        }
+
+        current = blocks.front();
+        blocks.pop_front();
+        {
+            std::unique_lock<std::mutex> lock(pipeline->mutex);
+            pipeline->blockDone.wait(lock, [this]() { return current->done; });
+        }
+        if (current->failed)
+        {
+            AWS_LOGSTREAM_ERROR(GZIP_COMPRESSING_STREAM_TAG, "Failed to compress a block of the input, the compressed stream is not terminated");
+            finished = true;
+            return false;
+        }
+
+        crc = CrcUtils::CombineCRC32(crc, current->crc, current->input.size() - current->dictionaryLength);
+        data = current->output.data();
+        length = current->output.size();
+        return true;
+    }
+
+    // single deflate stream
+    z_stream deflateStream;
+    bool deflateInitialized = false;
+    Aws::Vector<unsigned char> inputBuffer;
+    Aws::Vector<unsigned char> outputBuffer;
+
+    // parallel blocks
+    std::shared_ptr<Pipeline> pipeline;
+    Aws::Deque<std::shared_ptr<Block>> blocks;
+    std::shared_ptr<Block> current;
+    Aws::Vector<unsigned char> dictionary;
+    Aws::Vector<unsigned char> framing;
+    uint64_t inputLength = 0;
+    uint32_t crc = 0;
+    bool failed = false;
+#endif
+};
+
+const size_t GzipCompressingStreamBuf::DEFAULT_BLOCK_SIZE;
+
+GzipCompressingStreamBuf::GzipCompressingStreamBuf(const std::shared_ptr<Aws::IOStream>& input, size_t blockSize,
+                                                   Threading::Executor* executor, size_t maxBlocksInFlight) :
+    m_state(Aws::MakeShared<CompressionState>(GZIP_COMPRESSING_STREAM_TAG, input, blockSize, executor, maxBlocksInFlight))
+{
+}
+
+// blocks still being compressed only reference their own state, there is nothing to wait for
+GzipCompressingStreamBuf::~GzipCompressingStreamBuf() = default;
+
+GzipCompressingStreamBuf::int_type GzipCompressingStreamBuf::underflow()
+{
+    if (gptr() < egptr())
+    {
+        return traits_type::to_int_type(*gptr());
+    }
+
+#ifdef ENABLED_ZLIB_REQUEST_COMPRESSION
+    const unsigned char* data = nullptr;
+    size_t length = 0;
+    const bool produced = m_state->executor ? m_state->NextParallelOutput(data, length) : m_state->NextDeflateOutput(data, length);
+    if (produced)
+    {
+        char* begin = reinterpret_cast<char*>(const_cast<unsigned char*>(data));
+        setg(begin, begin, begin + length);
+        return traits_type::to_int_type(*gptr());
+    }
+#else
+    if (!m_state->finished)
+    {
+        AWS_LOGSTREAM_ERROR(GZIP_COMPRESSING_STREAM_TAG, "Compressed streams are not supported when ZLIB is not enabled");
+        m_state->finished = true;
+    }
+#endif
+    setg(nullptr, nullptr, nullptr);
+    return traits_type::eof();
+}
+
+GzipCompressingStream::GzipCompressingStream(const std::shared_ptr<Aws::IOStream>& input, size_t blockSize,
+                                             Threading::Executor* executor, size_t maxBlocksInFlight) :
+    Aws::IOStream(nullptr),
+    m_buffer(input, blockSize, executor, maxBlocksInFlight)
+{
+    rdbuf(&m_buffer);
+}
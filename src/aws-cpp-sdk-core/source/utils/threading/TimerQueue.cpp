@@ -0,0 +1,78 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/threading/TimerQueue.h>
+
+#include <cassert>
+
+using namespace Aws::Utils::Threading;
+
+TimerQueue::~TimerQueue()
+{
+    Stop();
+}
+
+bool TimerQueue::Schedule(std::chrono::milliseconds delay, std::function<void()>&& task)
+{
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        if (m_stopped)
+        {
+            return false;
+        }
+        if (!m_thread.joinable())
+        {
+            m_thread = std::thread(&TimerQueue::Run, this);
+        }
+        m_tasks.emplace(Clock::now() + delay, std::move(task));
+    }
+    m_signal.notify_one();
+    return true;
+}
+
+void TimerQueue::Stop()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_stopped = true;
+    }
+    m_signal.notify_one();
+
+    if (m_thread.joinable())
+    {
+        // joining from a task would deadlock
+        assert(m_thread.get_id() != std::this_thread::get_id());
+        m_thread.join();
+    }
+
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_tasks.clear();
+}
+
+void TimerQueue::Run()
+{
+    std::unique_lock<std::mutex> locker(m_mutex);
+    while (!m_stopped)
+    {
+        if (m_tasks.empty())
+        {
+            m_signal.wait(locker);
+            continue;
+        }
+
+        auto next = m_tasks.begin();
+        if (next->first > Clock::now())
+        {
+            m_signal.wait_until(locker, next->first);
+            continue;
+        }
+
+        std::function<void()> task = std::move(next->second);
+        m_tasks.erase(next);
+        locker.unlock();
+        task();
+        locker.lock();
+    }
+}
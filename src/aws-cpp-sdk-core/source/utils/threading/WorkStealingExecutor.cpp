@@ -0,0 +1,512 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/threading/WorkStealingExecutor.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <cstdint>
+
+using namespace Aws::Utils::Threading;
+
+static const char WORK_STEALING_EXECUTOR_TAG[] = "WorkStealingExecutor";
+// Initial number of slots of a worker deque, grows by doubling.
+static const std::int64_t INITIAL_DEQUE_CAPACITY = 256;
+// Number of task nodes a worker keeps for reuse.
+static const size_t MAX_CACHED_TASKS = 64;
+// Number of spare task nodes kept for the tasks submitted from outside the pool.
+static const size_t MAX_SPARE_TASKS = 256;
+// Number of times an idle worker yields and looks for work again before blocking.
+static const size_t IDLE_SPIN_COUNT = 16;
+
+// Identifies the pool worker running on the current thread, if any.
+static thread_local const WorkStealingExecutor* s_currentExecutor = nullptr;
+static thread_local size_t s_currentWorkerIndex = 0;
+
+namespace
+{
+    /**
+     * Chase-Lev work-stealing deque ("Correct and Efficient Work-Stealing for Weak Memory Models", Le et al. 2013).
+     * Push() and Take() may only be called by the owning worker, Steal() by any thread.
+     * Buffers replaced on growth are retired rather than freed, as a concurrent thief may still read from them.
+     */
+    template<typename T>
+    class WorkStealingDeque
+    {
+    public:
+        WorkStealingDeque() : m_buffer(Aws::New<Buffer>(WORK_STEALING_EXECUTOR_TAG, INITIAL_DEQUE_CAPACITY)) {}
+
+        ~WorkStealingDeque()
+        {
+            Aws::Delete(m_buffer.load(std::memory_order_relaxed));
+            for (auto buffer : m_retiredBuffers)
+            {
+                Aws::Delete(buffer);
+            }
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        void Push(T* item)
+        {
+            const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t top = m_top.load(std::memory_order_acquire);
+            Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+            if (bottom - top > buffer->mask)
+            {
+                buffer = Grow(buffer, top, bottom);
+            }
+            buffer->Put(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        T* Take()
+        {
+            const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t top = m_top.load(std::memory_order_relaxed);
+            if (top > bottom)
+            {
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            T* item = buffer->Get(bottom);
+            if (top == bottom)
+            {
+                // last item, race against thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    item = nullptr;
+                }
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            }
+            return item;
+        }
+
+        /**
+         * Returns nullptr when the deque is empty or when another thread won the race for the top item.
+         */
+        T* Steal()
+        {
+            std::int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            T* item = m_buffer.load(std::memory_order_acquire)->Get(top);
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+            return item;
+        }
+
+    private:
+        struct Buffer
+        {
+            explicit Buffer(std::int64_t capacity) : mask(capacity - 1), slots(static_cast<size_t>(capacity)) {}
+
+            inline T* Get(std::int64_t index) const { return slots[static_cast<size_t>(index & mask)].load(std::memory_order_relaxed); }
+            inline void Put(std::int64_t index, T* item) { slots[static_cast<size_t>(index & mask)].store(item, std::memory_order_relaxed); }
+
+            const std::int64_t mask;
+            Aws::Vector<std::atomic<T*>> slots;
+        };
+
+        Buffer* Grow(Buffer* buffer, std::int64_t top, std::int64_t bottom)
+        {
+            Buffer* grown = Aws::New<Buffer>(WORK_STEALING_EXECUTOR_TAG, (buffer->mask + 1) * 2);
+            for (std::int64_t i = top; i < bottom; ++i)
+            {
+                grown->Put(i, buffer->Get(i));
+            }
+            m_retiredBuffers.push_back(buffer);
+            m_buffer.store(grown, std::memory_order_release);
+            return grown;
+        }
+
+        std::atomic<std::int64_t> m_top{0};
+        std::atomic<std::int64_t> m_bottom{0};
+        std::atomic<Buffer*> m_buffer;
+        Aws::Vector<Buffer*> m_retiredBuffers;
+    };
+} // namespace
+
+struct WorkStealingExecutor::Task
+{
+    explicit Task(std::function<void()>&& function) : fn(std::move(function)) {}
+
+    std::function<void()> fn;
+    Task* next = nullptr;
+    // submitted from outside the pool, the node is returned to the spare nodes once executed
+    bool external = false;
+};
+
+class WorkStealingExecutor::Worker
+{
+public:
+    explicit Worker(size_t workerIndex) : index(workerIndex) {}
+
+    ~Worker()
+    {
+        while (Task* task = deque.Take())
+        {
+            Aws::Delete(task);
+        }
+        DeleteList(TakeInbox());
+        DeleteList(m_cachedTasks);
+    }
+
+    /**
+     * Lock-free push of a task submitted from outside the pool.
+     */
+    void PushInbox(Task* task)
+    {
+        Task* head = m_inbox.load(std::memory_order_relaxed);
+        do
+        {
+            task->next = head;
+        } while (!m_inbox.compare_exchange_weak(head, task));
+    }
+
+    /**
+     * Takes all tasks of the inbox at once, most recently submitted first. Safe to call from any thread.
+     */
+    Task* TakeInbox()
+    {
+        return m_inbox.load(std::memory_order_relaxed) ? m_inbox.exchange(nullptr, std::memory_order_acquire) : nullptr;
+    }
+
+    /**
+     * Only called by the thread of this worker.
+     */
+    Task* NewTask(std::function<void()>&& fn)
+    {
+        if (!m_cachedTasks)
+        {
+            return Aws::New<Task>(WORK_STEALING_EXECUTOR_TAG, std::move(fn));
+        }
+        Task* task = m_cachedTasks;
+        m_cachedTasks = task->next;
+        --m_cachedTaskCount;
+        task->fn = std::move(fn);
+        task->next = nullptr;
+        return task;
+    }
+
+    /**
+     * Only called by the thread of this worker.
+     */
+    void RecycleTask(Task* task)
+    {
+        if (m_cachedTaskCount >= MAX_CACHED_TASKS)
+        {
+            Aws::Delete(task);
+            return;
+        }
+        task->next = m_cachedTasks;
+        m_cachedTasks = task;
+        ++m_cachedTaskCount;
+    }
+
+    const size_t index;
+    WorkStealingDeque<Task> deque;
+
+    static void DeleteList(Task* task)
+    {
+        while (task)
+        {
+            Task* next = task->next;
+            Aws::Delete(task);
+            task = next;
+        }
+    }
+
+private:
+    std::atomic<Task*> m_inbox{nullptr};
+    Task* m_cachedTasks = nullptr;
+    size_t m_cachedTaskCount = 0;
+};
+
+WorkStealingExecutor::WorkStealingExecutor(size_t poolSize, size_t maxQueuedTasks, OverflowPolicy overflowPolicy) :
+    m_maxQueuedTasks(maxQueuedTasks), m_overflowPolicy(overflowPolicy)
+{
+    poolSize = poolSize > 0 ? poolSize : 1;
+    m_workers.reserve(poolSize);
+    for (size_t index = 0; index < poolSize; ++index)
+    {
+        m_workers.push_back(Aws::New<Worker>(WORK_STEALING_EXECUTOR_TAG, index));
+    }
+
+    m_threads.reserve(poolSize);
+    for (auto worker : m_workers)
+    {
+        m_threads.emplace_back(&WorkStealingExecutor::WorkerLoop, this, std::ref(*worker));
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+    WaitUntilStopped();
+
+    for (auto worker : m_workers)
+    {
+        Aws::Delete(worker);
+    }
+    m_workers.clear();
+    Worker::DeleteList(m_spareTasks.exchange(nullptr));
+}
+
+void WorkStealingExecutor::WaitUntilStopped()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_sleepMutex);
+        m_stopped.store(true);
+    }
+    m_workAvailable.notify_all();
+    {
+        std::lock_guard<std::mutex> locker(m_capacityMutex);
+    }
+    m_capacityAvailable.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+}
+
+bool WorkStealingExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    if (m_stopped.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    Worker* currentWorker = s_currentExecutor == this ? m_workers[s_currentWorkerIndex] : nullptr;
+    if (currentWorker || m_maxQueuedTasks == 0)
+    {
+        m_queuedTasks.fetch_add(1);
+    }
+    else if (!AcquireQueueSlot())
+    {
+        return false;
+    }
+
+    if (currentWorker)
+    {
+        currentWorker->deque.Push(currentWorker->NewTask(std::move(fn)));
+    }
+    else
+    {
+        m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) % m_workers.size()]->PushInbox(NewSpareTask(std::move(fn)));
+    }
+
+    // only counted once pushed, so that the worker it wakes up does not spin until the task is visible
+    m_pendingTasks.fetch_add(1);
+    WakeWorker();
+    return true;
+}
+
+WorkStealingExecutor::Task* WorkStealingExecutor::NewSpareTask(std::function<void()>&& fn)
+{
+    Task* task = nullptr;
+    // Submitters racing for the spare nodes do not wait for each other, the loser allocates.
+    if (m_spareTasks.load(std::memory_order_relaxed) && m_spareTasksMutex.try_lock())
+    {
+        task = m_spareTasks.load(std::memory_order_acquire);
+        while (task && !m_spareTasks.compare_exchange_weak(task, task->next, std::memory_order_acquire, std::memory_order_acquire))
+        {
+        }
+        m_spareTasksMutex.unlock();
+    }
+
+    if (!task)
+    {
+        task = Aws::New<Task>(WORK_STEALING_EXECUTOR_TAG, std::move(fn));
+    }
+    else
+    {
+        m_spareTaskCount.fetch_sub(1, std::memory_order_relaxed);
+        task->fn = std::move(fn);
+        task->next = nullptr;
+    }
+    task->external = true;
+    return task;
+}
+
+void WorkStealingExecutor::RecycleTask(Worker& worker, Task* task)
+{
+    // release whatever the function captured right away
+    task->fn = nullptr;
+    if (!task->external)
+    {
+        worker.RecycleTask(task);
+        return;
+    }
+
+    if (m_spareTaskCount.load(std::memory_order_relaxed) >= MAX_SPARE_TASKS)
+    {
+        Aws::Delete(task);
+        return;
+    }
+    m_spareTaskCount.fetch_add(1, std::memory_order_relaxed);
+    task->external = false;
+    Task* head = m_spareTasks.load(std::memory_order_relaxed);
+    do
+    {
+        task->next = head;
+    } while (!m_spareTasks.compare_exchange_weak(head, task, std::memory_order_release, std::memory_order_relaxed));
+}
+
+bool WorkStealingExecutor::AcquireQueueSlot()
+{
+    size_t queuedTasks = m_queuedTasks.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (queuedTasks < m_maxQueuedTasks)
+        {
+            if (m_queuedTasks.compare_exchange_weak(queuedTasks, queuedTasks + 1))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        if (m_overflowPolicy == OverflowPolicy::REJECT_IMMEDIATELY)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> locker(m_capacityMutex);
+        m_blockedSubmitters.fetch_add(1);
+        m_capacityAvailable.wait(locker, [this]()
+        {
+            return m_queuedTasks.load() < m_maxQueuedTasks || m_stopped.load();
+        });
+        m_blockedSubmitters.fetch_sub(1);
+        if (m_stopped.load())
+        {
+            return false;
+        }
+        queuedTasks = m_queuedTasks.load(std::memory_order_relaxed);
+    }
+}
+
+void WorkStealingExecutor::ReleaseQueueSlot()
+{
+    m_queuedTasks.fetch_sub(1);
+    if (m_maxQueuedTasks > 0 && m_blockedSubmitters.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_capacityMutex);
+        m_capacityAvailable.notify_one();
+    }
+}
+
+void WorkStealingExecutor::WakeWorker()
+{
+    // Pairs with WaitForWork(): either the sleeping worker sees the pending task count, or this sees the sleeping worker.
+    if (m_sleepingWorkers.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_sleepMutex);
+        m_workAvailable.notify_one();
+    }
+}
+
+void WorkStealingExecutor::WaitForWork()
+{
+    std::unique_lock<std::mutex> locker(m_sleepMutex);
+    m_sleepingWorkers.fetch_add(1);
+    m_workAvailable.wait(locker, [this]()
+    {
+        return m_pendingTasks.load() > 0 || m_stopped.load();
+    });
+    m_sleepingWorkers.fetch_sub(1);
+}
+
+WorkStealingExecutor::Task* WorkStealingExecutor::TakeInbox(Worker& from, Worker& to)
+{
+    Task* task = from.TakeInbox();
+    if (!task)
+    {
+        return nullptr;
+    }
+
+    // The inbox is a stack, run its oldest task now and queue the others so the owner takes the older ones first.
+    while (task->next)
+    {
+        Task* next = task->next;
+        task->next = nullptr;
+        to.deque.Push(task);
+        task = next;
+    }
+    return task;
+}
+
+WorkStealingExecutor::Task* WorkStealingExecutor::FindTask(Worker& worker)
+{
+    if (Task* task = worker.deque.Take())
+    {
+        return task;
+    }
+    if (Task* task = TakeInbox(worker, worker))
+    {
+        return task;
+    }
+
+    const size_t workerCount = m_workers.size();
+    for (size_t offset = 1; offset < workerCount; ++offset)
+    {
+        Worker& victim = *m_workers[(worker.index + offset) % workerCount];
+        if (Task* task = victim.deque.Steal())
+        {
+            return task;
+        }
+        if (Task* task = TakeInbox(victim, worker))
+        {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingExecutor::WorkerLoop(Worker& worker)
+{
+    s_currentExecutor = this;
+    s_currentWorkerIndex = worker.index;
+
+    while (!m_stopped.load(std::memory_order_acquire))
+    {
+        Task* task = FindTask(worker);
+        for (size_t spin = 0; !task && spin < IDLE_SPIN_COUNT; ++spin)
+        {
+            std::this_thread::yield();
+            task = FindTask(worker);
+        }
+
+        if (!task)
+        {
+            WaitForWork();
+            continue;
+        }
+
+        m_pendingTasks.fetch_sub(1);
+        ReleaseQueueSlot();
+        task->fn();
+        RecycleTask(worker, task);
+    }
+
+    s_currentExecutor = nullptr;
+}
@@ -0,0 +1,635 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/core/utils/xml/XmlReader.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+
+using namespace Aws::Utils::Xml;
+
+// well beyond the nesting of any service response
+static const size_t MAX_ELEMENT_DEPTH = 1000;
+static const size_t MAX_REFERENCE_LENGTH = 10;
+static const char WHITESPACE[] = " \t\n\v\f\r";
+
+namespace
+{
+    const int END_OF_INPUT = std::char_traits<char>::eof();
+
+    inline bool IsWhitespace(int c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    inline bool IsNameTerminator(int c)
+    {
+        return c == END_OF_INPUT || IsWhitespace(c) || c == '/' || c == '>' || c == '=' || c == '<' || c == '"' || c == '\'';
+    }
+
+    bool AppendUtf8(Aws::String& text, unsigned long codePoint)
+    {
+        if (codePoint == 0 || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+        {
+            return false;
+        }
+        if (codePoint < 0x80)
+        {
+            text.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800)
+        {
+            text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x10000)
+        {
+            text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        return true;
+    }
+}
+
+XmlReader::XmlReader(Aws::IStream& input) : m_input(input.rdbuf()), m_elements(1)
+{
+    if (!m_input)
+    {
+        Fail("Input stream has no buffer");
+    }
+}
+
+XmlToken XmlReader::ReadToken(TextMode mode)
+{
+    if (m_token == XmlToken::Error || m_token == XmlToken::End)
+    {
+        return m_token;
+    }
+
+    if (m_emptyElement)
+    {
+        m_emptyElement = false;
+        --m_depth;
+        return m_token = XmlToken::EndElement;
+    }
+
+    for (;;)
+    {
+        int c = Peek();
+        if (c == END_OF_INPUT)
+        {
+            if (m_depth > 0)
+            {
+                return Fail("Unexpected end of the document in an element");
+            }
+            return m_rootRead ? (m_token = XmlToken::End) : Fail("The document has no root element");
+        }
+
+        if (c != '<')
+        {
+            if (m_depth == 0)
+            {
+                if (!IsWhitespace(c))
+                {
+                    return Fail("Text outside of the root element");
+                }
+                Bump();
+                continue;
+            }
+            if (mode == TextMode::Replace)
+            {
+                m_text.clear();
+            }
+            return ReadCharacterData(mode == TextMode::Discard ? nullptr : &m_text) ? (m_token = XmlToken::Text) : XmlToken::Error;
+        }
+
+        Bump();
+        c = Peek();
+        if (c == '/')
+        {
+            Bump();
+            return ReadEndTag();
+        }
+        if (c == '?')
+        {
+            // the XML declaration or a processing instruction
+            if (!SkipUntil("?>"))
+            {
+                return XmlToken::Error;
+            }
+            continue;
+        }
+        if (c == '!')
+        {
+            Bump();
+            c = Peek();
+            if (c == '-')
+            {
+                if (!SkipComment())
+                {
+                    return XmlToken::Error;
+                }
+                continue;
+            }
+            if (c == '[')
+            {
+                if (m_depth == 0)
+                {
+                    return Fail("CDATA section outside of the root element");
+                }
+                if (mode == TextMode::Replace)
+                {
+                    m_text.clear();
+                }
+                return ReadCData(mode == TextMode::Discard ? nullptr : &m_text) ? (m_token = XmlToken::Text) : XmlToken::Error;
+            }
+            if (m_depth > 0 || m_rootRead)
+            {
+                return Fail("Unexpected declaration in the document");
+            }
+            if (!SkipDeclaration())
+            {
+                return XmlToken::Error;
+            }
+            continue;
+        }
+
+        if (m_depth == 0 && m_rootRead)
+        {
+            return Fail("Unexpected element after the root element");
+        }
+        return ReadStartTag();
+    }
+}
+
+bool XmlReader::NextChild()
+{
+    for (;;)
+    {
+        switch (ReadToken(TextMode::Discard))
+        {
+            case XmlToken::Text:
+                break;
+            case XmlToken::StartElement:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+bool XmlReader::SkipElement()
+{
+    if (m_token == XmlToken::StartElement)
+    {
+        const size_t depth = m_depth;
+        while (m_depth >= depth)
+        {
+            const XmlToken token = ReadToken(TextMode::Discard);
+            if (token == XmlToken::Error || token == XmlToken::End)
+            {
+                return false;
+            }
+        }
+    }
+    return m_token != XmlToken::Error;
+}
+
+bool XmlReader::ReadElementText()
+{
+    m_text.clear();
+    if (m_token != XmlToken::StartElement)
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        switch (ReadToken(TextMode::Append))
+        {
+            case XmlToken::Text:
+                break;
+            case XmlToken::StartElement:
+                if (!SkipElement())
+                {
+                    return false;
+                }
+                break;
+            case XmlToken::EndElement:
+                // the end tags of children are consumed by SkipElement, this one closes the element
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+const Aws::String& XmlReader::GetAttributeValue(const char* name) const
+{
+    static const Aws::String EMPTY_VALUE;
+    for (size_t i = 0; i < m_attributeCount; ++i)
+    {
+        if (m_attributes[i].first == name)
+        {
+            return m_attributes[i].second;
+        }
+    }
+    return EMPTY_VALUE;
+}
+
+const Aws::String& XmlReader::GetTrimmedText()
+{
+    const size_t end = m_text.find_last_not_of(WHITESPACE);
+    if (end == Aws::String::npos)
+    {
+        m_text.clear();
+        return m_text;
+    }
+    m_text.erase(end + 1);
+    m_text.erase(0, m_text.find_first_not_of(WHITESPACE));
+    return m_text;
+}
+
+XmlToken XmlReader::ReadStartTag()
+{
+    if (m_depth >= MAX_ELEMENT_DEPTH)
+    {
+        return Fail("Maximum element depth exceeded");
+    }
+    if (m_elements.size() <= m_depth)
+    {
+        m_elements.resize(m_depth + 1);
+    }
+    if (!ReadName(m_elements[m_depth]) || !ReadAttributes())
+    {
+        return XmlToken::Error;
+    }
+    m_nameIndex = m_depth++;
+    m_rootRead = true;
+    return m_token = XmlToken::StartElement;
+}
+
+XmlToken XmlReader::ReadEndTag()
+{
+    if (m_depth == 0)
+    {
+        return Fail("Unexpected end tag");
+    }
+
+    // compared as it is read, the name of the element is already known
+    const Aws::String& name = m_elements[m_depth - 1];
+    size_t matched = 0;
+    for (int c = Peek(); !IsNameTerminator(c); c = Peek())
+    {
+        if (matched >= name.size() || name[matched] != static_cast<char>(c))
+        {
+            return Fail("Mismatched end tag");
+        }
+        ++matched;
+        Bump();
+    }
+    if (matched != name.size())
+    {
+        return Fail("Mismatched end tag");
+    }
+    SkipWhitespace();
+    if (Bump() != '>')
+    {
+        return Fail("Expected '>' at the end of the end tag");
+    }
+
+    m_nameIndex = --m_depth;
+    return m_token = XmlToken::EndElement;
+}
+
+bool XmlReader::ReadName(Aws::String& name)
+{
+    name.clear();
+    for (int c = Peek(); !IsNameTerminator(c); c = Peek())
+    {
+        name.push_back(static_cast<char>(c));
+        Bump();
+    }
+    if (name.empty())
+    {
+        Fail("Expected a name");
+        return false;
+    }
+    return true;
+}
+
+bool XmlReader::ReadAttributes()
+{
+    m_attributeCount = 0;
+    for (;;)
+    {
+        SkipWhitespace();
+        int c = Peek();
+        if (c == '>')
+        {
+            Bump();
+            return true;
+        }
+        if (c == '/')
+        {
+            Bump();
+            if (Bump() != '>')
+            {
+                Fail("Expected '>' after '/'");
+                return false;
+            }
+            m_emptyElement = true;
+            return true;
+        }
+
+        if (m_attributes.size() <= m_attributeCount)
+        {
+            m_attributes.resize(m_attributeCount + 1);
+        }
+        auto& attribute = m_attributes[m_attributeCount];
+        if (!ReadName(attribute.first))
+        {
+            return false;
+        }
+        SkipWhitespace();
+        if (Bump() != '=')
+        {
+            Fail("Expected '=' after attribute name");
+            return false;
+        }
+        SkipWhitespace();
+        const int quote = Bump();
+        if (quote != '"' && quote != '\'')
+        {
+            Fail("Expected quoted attribute value");
+            return false;
+        }
+
+        attribute.second.clear();
+        for (c = Bump(); c != quote; c = Bump())
+        {
+            if (c == END_OF_INPUT || c == '<')
+            {
+                Fail("Unterminated attribute value");
+                return false;
+            }
+            if (c == '&')
+            {
+                if (!ReadReference(&attribute.second))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                attribute.second.push_back(static_cast<char>(c));
+            }
+        }
+        ++m_attributeCount;
+    }
+}
+
+bool XmlReader::ReadCharacterData(Aws::String* text)
+{
+    for (int c = Peek(); c != '<' && c != END_OF_INPUT; c = Peek())
+    {
+        Bump();
+        if (c == '&')
+        {
+            if (!ReadReference(text))
+            {
+                return false;
+            }
+        }
+        else if (c == '\r')
+        {
+            // line ends are normalized to '\n'
+            if (Peek() == '\n')
+            {
+                Bump();
+            }
+            if (text)
+            {
+                text->push_back('\n');
+            }
+        }
+        else if (text)
+        {
+            text->push_back(static_cast<char>(c));
+        }
+    }
+    return true;
+}
+
+bool XmlReader::ReadReference(Aws::String* text)
+{
+    char reference[MAX_REFERENCE_LENGTH + 1];
+    size_t length = 0;
+    for (;;)
+    {
+        const int c = Peek();
+        if (c == ';')
+        {
+            Bump();
+            break;
+        }
+        if (length == MAX_REFERENCE_LENGTH || !(isalnum(c) || c == '#'))
+        {
+            // not a reference, kept as is like tinyxml2 does
+            if (text)
+            {
+                text->push_back('&');
+                text->append(reference, length);
+            }
+            return true;
+        }
+        reference[length++] = static_cast<char>(c);
+        Bump();
+    }
+    reference[length] = '\0';
+
+    if (!text)
+    {
+        return true;
+    }
+
+    if (std::strcmp(reference, "lt") == 0)
+    {
+        text->push_back('<');
+    }
+    else if (std::strcmp(reference, "gt") == 0)
+    {
+        text->push_back('>');
+    }
+    else if (std::strcmp(reference, "amp") == 0)
+    {
+        text->push_back('&');
+    }
+    else if (std::strcmp(reference, "quot") == 0)
+    {
+        text->push_back('"');
+    }
+    else if (std::strcmp(reference, "apos") == 0)
+    {
+        text->push_back('\'');
+    }
+    else
+    {
+        bool decoded = false;
+        if (reference[0] == '#' && length > 1)
+        {
+            const bool hex = reference[1] == 'x';
+            const char* digits = reference + (hex ? 2 : 1);
+            char* end = nullptr;
+            const unsigned long codePoint = strtoul(digits, &end, hex ? 16 : 10);
+            decoded = *digits != '\0' && *end == '\0' && AppendUtf8(*text, codePoint);
+        }
+        if (!decoded)
+        {
+            // unknown entities are kept as is like tinyxml2 does
+            text->push_back('&');
+            text->append(reference, length);
+            text->push_back(';');
+        }
+    }
+    return true;
+}
+
+bool XmlReader::ReadCData(Aws::String* text)
+{
+    static const char CDATA_START[] = "[CDATA[";
+    for (const char* expected = CDATA_START; *expected != '\0'; ++expected)
+    {
+        if (Bump() != *expected)
+        {
+            Fail("Malformed CDATA section");
+            return false;
+        }
+    }
+
+    // ']' are held back until it is known whether they start the "]]>" terminator
+    size_t brackets = 0;
+    for (;;)
+    {
+        const int c = Bump();
+        if (c == END_OF_INPUT)
+        {
+            Fail("Unterminated CDATA section");
+            return false;
+        }
+        if (c == ']')
+        {
+            ++brackets;
+            continue;
+        }
+        if (c == '>' && brackets >= 2)
+        {
+            if (text)
+            {
+                text->append(brackets - 2, ']');
+            }
+            return true;
+        }
+        if (text)
+        {
+            text->append(brackets, ']');
+            text->push_back(static_cast<char>(c));
+        }
+        brackets = 0;
+    }
+}
+
+bool XmlReader::SkipComment()
+{
+    if (Bump() != '-' || Bump() != '-')
+    {
+        Fail("Malformed comment");
+        return false;
+    }
+    return SkipUntil("-->");
+}
+
+bool XmlReader::SkipUntil(const char* terminator)
+{
+    // terminators are at most 3 characters long, the last ones read are compared to it
+    char window[3] = {};
+    const size_t length = std::strlen(terminator);
+    size_t read = 0;
+    for (;;)
+    {
+        const int c = Bump();
+        if (c == END_OF_INPUT)
+        {
+            Fail("Unterminated markup");
+            return false;
+        }
+        std::memmove(window, window + 1, length - 1);
+        window[length - 1] = static_cast<char>(c);
+        if (++read >= length && std::memcmp(window, terminator, length) == 0)
+        {
+            return true;
+        }
+    }
+}
+
+bool XmlReader::SkipDeclaration()
+{
+    // <!DOCTYPE ...>, possibly with an internal subset in brackets
+    int quote = 0;
+    int brackets = 0;
+    for (;;)
+    {
+        const int c = Bump();
+        if (c == END_OF_INPUT)
+        {
+            Fail("Unterminated declaration");
+            return false;
+        }
+        if (quote)
+        {
+            quote = c == quote ? 0 : quote;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if (c == '[')
+        {
+            ++brackets;
+        }
+        else if (c == ']')
+        {
+            --brackets;
+        }
+        else if (c == '>' && brackets <= 0)
+        {
+            return true;
+        }
+    }
+}
+
+void XmlReader::SkipWhitespace()
+{
+    while (IsWhitespace(Peek()))
+    {
+        Bump();
+    }
+}
+
+XmlToken XmlReader::Fail(const char* message)
+{
+    m_errorMessage = message;
+    return m_token = XmlToken::Error;
+}
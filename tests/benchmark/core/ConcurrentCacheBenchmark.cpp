@@ -0,0 +1,163 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/**
+ * Throughput of ConcurrentCache and ShardedConcurrentCache under contention.
+ *
+ * Threads look up and insert string keys, as the endpoint discovery cache does, with 1 Put every 10 operations.
+ * Two key sets are used:
+ *  - hits: the keys fit in the cache, almost all lookups hit;
+ *  - evictions: the keys are 4 times the cache size, most inserts evict an entry.
+ *
+ * Usage: concurrent-cache-benchmark [max threads] [operations per thread] [cache size]
+ */
+
+#include <aws/core/Aws.h>
+#include <aws/core/utils/ConcurrentCache.h>
+#include <aws/core/utils/ShardedConcurrentCache.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils;
+
+namespace
+{
+    const size_t PUT_INTERVAL = 10;
+    const std::chrono::milliseconds ENTRY_DURATION = std::chrono::minutes(10);
+
+    struct Options
+    {
+        size_t maxThreads = std::max<size_t>(2, std::thread::hardware_concurrency());
+        size_t operations = 1000000;
+        size_t cacheSize = 1000;
+    };
+
+    Aws::Vector<Aws::String> CreateKeys(size_t count)
+    {
+        Aws::Vector<Aws::String> keys;
+        keys.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            keys.push_back("dynamodb.us-east-1.amazonaws.com/" + StringUtils::to_string(i));
+        }
+        return keys;
+    }
+
+    template <typename CacheT>
+    double Run(CacheT& cache, const Aws::Vector<Aws::String>& keys, size_t threadCount, size_t operations)
+    {
+        std::atomic<size_t> ready{0};
+        std::atomic<bool> go{false};
+        std::atomic<size_t> hits{0};
+        std::vector<std::thread> threads;
+        for (size_t thread = 0; thread < threadCount; ++thread)
+        {
+            threads.emplace_back([&, thread]()
+            {
+                // each thread walks the keys with its own stride, so that the threads do not use the same key in lockstep
+                size_t index = thread * 7919 % keys.size();
+                const size_t stride = 2 * thread + 1;
+                size_t threadHits = 0;
+                Aws::String value;
+                ready.fetch_add(1);
+                while (!go.load())
+                {
+                    std::this_thread::yield();
+                }
+                for (size_t i = 0; i < operations; ++i)
+                {
+                    const Aws::String& key = keys[index];
+                    if (i % PUT_INTERVAL == 0)
+                    {
+                        cache.Put(key, key, ENTRY_DURATION);
+                    }
+                    else if (cache.Get(key, value))
+                    {
+                        ++threadHits;
+                    }
+                    index = (index + stride) % keys.size();
+                }
+                hits.fetch_add(threadHits);
+            });
+        }
+        while (ready.load() < threadCount)
+        {
+            std::this_thread::yield();
+        }
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true);
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        // keeps the lookups from being optimized away
+        if (hits.load() > threadCount * operations)
+        {
+            std::abort();
+        }
+        return seconds;
+    }
+
+    template <typename CacheT>
+    void Benchmark(const char* cacheName, const char* workload, const Aws::Vector<Aws::String>& keys, const Options& options)
+    {
+        for (size_t threads = 1; threads <= options.maxThreads; threads *= 2)
+        {
+            CacheT cache(options.cacheSize);
+            // warm up: fill the cache before measuring
+            for (size_t i = 0; i < std::min(keys.size(), options.cacheSize); ++i)
+            {
+                cache.Put(keys[i], keys[i], ENTRY_DURATION);
+            }
+            const double seconds = Run(cache, keys, threads, options.operations);
+            const double totalOperations = static_cast<double>(threads * options.operations);
+            printf("%-22s %-10s %3zu threads %10.1f ms %10.2f Mops/s\n", cacheName, workload, threads, seconds * 1000.0,
+                   totalOperations / seconds / 1000000.0);
+        }
+    }
+
+    size_t ParseArgument(int argc, char** argv, int index, size_t defaultValue)
+    {
+        if (index >= argc)
+        {
+            return defaultValue;
+        }
+        const long long value = std::atoll(argv[index]);
+        return value > 0 ? static_cast<size_t>(value) : defaultValue;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    options.maxThreads = ParseArgument(argc, argv, 1, options.maxThreads);
+    options.operations = ParseArgument(argc, argv, 2, options.operations);
+    options.cacheSize = ParseArgument(argc, argv, 3, options.cacheSize);
+
+    Aws::SDKOptions sdkOptions;
+    Aws::InitAPI(sdkOptions);
+    {
+        printf("cache size %zu, %zu operations per thread, 1 Put every %zu operations\n", options.cacheSize, options.operations,
+               PUT_INTERVAL);
+        const auto hitKeys = CreateKeys(std::max<size_t>(1, options.cacheSize / 2));
+        const auto evictionKeys = CreateKeys(options.cacheSize * 4);
+        Benchmark<ConcurrentCache<Aws::String, Aws::String>>("ConcurrentCache", "hits", hitKeys, options);
+        Benchmark<ShardedConcurrentCache<Aws::String, Aws::String>>("ShardedConcurrentCache", "hits", hitKeys, options);
+        Benchmark<ConcurrentCache<Aws::String, Aws::String>>("ConcurrentCache", "evictions", evictionKeys, options);
+        Benchmark<ShardedConcurrentCache<Aws::String, Aws::String>>("ShardedConcurrentCache", "evictions", evictionKeys, options);
+    }
+    Aws::ShutdownAPI(sdkOptions);
+    return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/**
+ * Throughput of the EncodingUtils base64 and hex codecs for inputs from 1 KB to 5 MB.
+ *
+ * Each codec is measured at every instruction set the CPU supports, Scalar being the baseline, and compared with the
+ * HashingUtils entry points taking a ByteBuffer or a String, which do not use EncodingUtils.
+ *
+ * Usage: encoding-utils-benchmark [MB processed per measurement]
+ */
+
+#include <aws/core/Aws.h>
+#include <aws/core/utils/EncodingUtils.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+
+using namespace Aws::Utils;
+
+namespace
+{
+    const size_t INPUT_SIZES[] = {1024, 16 * 1024, 256 * 1024, 1024 * 1024, 5 * 1024 * 1024};
+    const SimdLevel SIMD_LEVELS[] = {SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2, SimdLevel::Neon};
+
+    const char* GetSimdLevelName(SimdLevel level)
+    {
+        switch (level)
+        {
+        case SimdLevel::Scalar:
+            return "scalar";
+        case SimdLevel::Sse41:
+            return "sse4.1";
+        case SimdLevel::Avx2:
+            return "avx2";
+        case SimdLevel::Neon:
+            return "neon";
+        }
+        return "unknown";
+    }
+
+    /**
+     * Calls operation until bytesPerMeasurement input bytes were processed, at least 3 times, and returns the throughput
+     * in GB/s of input.
+     */
+    double Measure(size_t inputSize, size_t bytesPerMeasurement, const std::function<void()>& operation)
+    {
+        const size_t iterations = std::max<size_t>(3, bytesPerMeasurement / inputSize);
+        operation();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            operation();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(inputSize) * iterations / seconds / 1e9;
+    }
+
+    void Check(bool succeeded, const char* operation)
+    {
+        if (!succeeded)
+        {
+            fprintf(stderr, "%s failed\n", operation);
+            std::abort();
+        }
+    }
+
+    void Report(const char* codec, const char* implementation, size_t inputSize, double gbPerSecond)
+    {
+        printf("%-14s %-22s %8zu KB %8.2f GB/s\n", codec, implementation, inputSize / 1024, gbPerSecond);
+    }
+
+    void Benchmark(size_t inputSize, size_t bytesPerMeasurement)
+    {
+        Aws::Vector<unsigned char> input(inputSize);
+        std::mt19937 generator(static_cast<unsigned>(inputSize));
+        std::uniform_int_distribution<int> distribution(0, 255);
+        std::generate(input.begin(), input.end(), [&]() { return static_cast<unsigned char>(distribution(generator)); });
+
+        Aws::Vector<char> base64(EncodingUtils::Base64EncodedLength(inputSize));
+        Aws::Vector<char> hex(EncodingUtils::HexEncodedLength(inputSize));
+        Aws::Vector<unsigned char> decoded(std::max(EncodingUtils::Base64DecodedLength(base64.size()), inputSize));
+        const SimdLevel defaultLevel = EncodingUtils::GetSimdLevel();
+
+        for (SimdLevel level : SIMD_LEVELS)
+        {
+            if (!EncodingUtils::SetSimdLevel(level))
+            {
+                continue;
+            }
+            const char* levelName = GetSimdLevelName(level);
+            Report("base64 encode", levelName, inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+            {
+                EncodingUtils::Base64Encode(input.data(), input.size(), base64.data());
+            }));
+            Report("base64 decode", levelName, inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+            {
+                size_t decodedLength = 0;
+                Check(EncodingUtils::Base64Decode(base64.data(), base64.size(), decoded.data(), decodedLength), "Base64Decode");
+            }));
+            Report("hex encode", levelName, inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+            {
+                EncodingUtils::HexEncode(input.data(), input.size(), hex.data());
+            }));
+            Report("hex decode", levelName, inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+            {
+                Check(EncodingUtils::HexDecode(hex.data(), hex.size(), decoded.data()), "HexDecode");
+            }));
+        }
+        EncodingUtils::SetSimdLevel(defaultLevel);
+
+        // the existing entry points, which allocate their result and do not use EncodingUtils
+        const ByteBuffer inputBuffer(input.data(), input.size());
+        const Aws::String base64String(base64.data(), base64.size());
+        const Aws::String hexString(hex.data(), hex.size());
+        Report("base64 encode", "HashingUtils", inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+        {
+            Check(HashingUtils::Base64Encode(inputBuffer).size() == base64.size(), "HashingUtils::Base64Encode");
+        }));
+        Report("base64 decode", "HashingUtils", inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+        {
+            Check(HashingUtils::Base64Decode(base64String).GetLength() == inputSize, "HashingUtils::Base64Decode");
+        }));
+        Report("hex encode", "HashingUtils", inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+        {
+            Check(HashingUtils::HexEncode(inputBuffer).size() == hex.size(), "HashingUtils::HexEncode");
+        }));
+        Report("hex decode", "HashingUtils", inputSize, Measure(inputSize, bytesPerMeasurement, [&]()
+        {
+            Check(HashingUtils::HexDecode(hexString).GetLength() == inputSize, "HashingUtils::HexDecode");
+        }));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = 64;
+    if (argc > 1 && std::atoll(argv[1]) > 0)
+    {
+        megabytes = static_cast<size_t>(std::atoll(argv[1]));
+    }
+
+    Aws::SDKOptions sdkOptions;
+    Aws::InitAPI(sdkOptions);
+    {
+        printf("default instruction set: %s, %zu MB per measurement\n", GetSimdLevelName(EncodingUtils::GetSimdLevel()), megabytes);
+        for (size_t inputSize : INPUT_SIZES)
+        {
+            Benchmark(inputSize, megabytes * 1024 * 1024);
+        }
+    }
+    Aws::ShutdownAPI(sdkOptions);
+    return 0;
+}
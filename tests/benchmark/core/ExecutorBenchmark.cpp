@@ -0,0 +1,193 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/**
+ * Task throughput of PooledThreadExecutor and WorkStealingExecutor.
+ *
+ * Two workloads of empty tasks, so that the executor overhead dominates:
+ *  - external: producer threads outside the pool submit every task, as clients submitting async operations do;
+ *  - fan-out: every task submitted from outside submits further tasks from the worker running it, as the callbacks of
+ *    async operations do.
+ *
+ * Usage: executor-benchmark [pool size] [tasks] [producers] [repetitions]
+ */
+
+#include <aws/core/Aws.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <aws/core/utils/threading/WorkStealingExecutor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    const size_t FAN_OUT = 16;
+
+    struct Options
+    {
+        size_t poolSize = std::max<size_t>(2, std::thread::hardware_concurrency());
+        size_t tasks = 1000000;
+        size_t producers = 4;
+        size_t repetitions = 5;
+    };
+
+    /**
+     * Counts completed tasks and wakes up the waiting thread once the last one completed.
+     */
+    class Completion
+    {
+    public:
+        explicit Completion(size_t expected) : m_expected(expected), m_done(m_promise.get_future()) {}
+
+        void TaskDone()
+        {
+            if (m_completed.fetch_add(1, std::memory_order_acq_rel) + 1 == m_expected)
+            {
+                m_promise.set_value();
+            }
+        }
+
+        void Wait() { m_done.wait(); }
+
+    private:
+        const size_t m_expected;
+        std::atomic<size_t> m_completed{0};
+        std::promise<void> m_promise;
+        std::future<void> m_done;
+    };
+
+    std::unique_ptr<Executor> CreateExecutor(bool workStealing, size_t poolSize)
+    {
+        if (workStealing)
+        {
+            return std::unique_ptr<Executor>(new WorkStealingExecutor(poolSize));
+        }
+        return std::unique_ptr<Executor>(new PooledThreadExecutor(poolSize));
+    }
+
+    void Submit(Executor& executor, std::function<void()>&& task)
+    {
+        // both executors queue without bound by default, a rejected task would be a bug of the benchmark
+        if (!executor.Submit(std::move(task)))
+        {
+            fprintf(stderr, "Task rejected by the executor\n");
+            std::abort();
+        }
+    }
+
+    double RunExternal(Executor& executor, const Options& options)
+    {
+        Completion completion(options.tasks);
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> producers;
+        for (size_t producer = 0; producer < options.producers; ++producer)
+        {
+            const size_t count = options.tasks / options.producers + (producer < options.tasks % options.producers ? 1 : 0);
+            producers.emplace_back([&executor, &completion, count]()
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    Submit(executor, [&completion]() { completion.TaskDone(); });
+                }
+            });
+        }
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+        completion.Wait();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double RunFanOut(Executor& executor, const Options& options)
+    {
+        const size_t roots = std::max<size_t>(1, options.tasks / (FAN_OUT + 1));
+        Completion completion(roots * (FAN_OUT + 1));
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t root = 0; root < roots; ++root)
+        {
+            Submit(executor, [&executor, &completion]()
+            {
+                for (size_t child = 0; child < FAN_OUT; ++child)
+                {
+                    Submit(executor, [&completion]() { completion.TaskDone(); });
+                }
+                completion.TaskDone();
+            });
+        }
+        completion.Wait();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void Report(const char* executorName, const char* workload, size_t tasks, const std::vector<double>& seconds)
+    {
+        // the median is reported, the first runs also pay for warming up the allocator
+        std::vector<double> sorted(seconds);
+        std::sort(sorted.begin(), sorted.end());
+        const double median = sorted[sorted.size() / 2];
+        printf("%-22s %-10s %10zu tasks %10.1f ms %10.2f Mtasks/s\n", executorName, workload, tasks, median * 1000.0,
+               tasks / median / 1000000.0);
+    }
+
+    void Benchmark(bool workStealing, const Options& options)
+    {
+        const char* executorName = workStealing ? "WorkStealingExecutor" : "PooledThreadExecutor";
+        std::vector<double> external;
+        std::vector<double> fanOut;
+        for (size_t repetition = 0; repetition < options.repetitions; ++repetition)
+        {
+            // a new executor per run, so that no run inherits the queue of the previous one
+            {
+                auto executor = CreateExecutor(workStealing, options.poolSize);
+                external.push_back(RunExternal(*executor, options));
+            }
+            {
+                auto executor = CreateExecutor(workStealing, options.poolSize);
+                fanOut.push_back(RunFanOut(*executor, options));
+            }
+        }
+        Report(executorName, "external", options.tasks, external);
+        Report(executorName, "fan-out", std::max<size_t>(1, options.tasks / (FAN_OUT + 1)) * (FAN_OUT + 1), fanOut);
+    }
+
+    size_t ParseArgument(int argc, char** argv, int index, size_t defaultValue)
+    {
+        if (index >= argc)
+        {
+            return defaultValue;
+        }
+        const long long value = std::atoll(argv[index]);
+        return value > 0 ? static_cast<size_t>(value) : defaultValue;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    options.poolSize = ParseArgument(argc, argv, 1, options.poolSize);
+    options.tasks = ParseArgument(argc, argv, 2, options.tasks);
+    options.producers = ParseArgument(argc, argv, 3, options.producers);
+    options.repetitions = ParseArgument(argc, argv, 4, options.repetitions);
+
+    Aws::SDKOptions sdkOptions;
+    Aws::InitAPI(sdkOptions);
+    {
+        printf("pool size %zu, %zu producers, median of %zu runs\n", options.poolSize, options.producers, options.repetitions);
+        Benchmark(false, options);
+        Benchmark(true, options);
+    }
+    Aws::ShutdownAPI(sdkOptions);
+    return 0;
+}